@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef PACKET_H_
+#define PACKET_H_
+
+#include <systemc>
+#include <uvm>
+#include <sstream>
+#include <vector>
+
+class packet_header : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(packet_header);
+
+  unsigned int addr;
+  std::string cmd;
+
+  // back reference to the packet, which closes a cycle
+  uvm::uvm_object* owner;
+
+  packet_header( const std::string& name = "packet_header" )
+  : uvm::uvm_object(name), addr(0), owner(NULL)
+  {}
+
+  bool do_compare( const uvm::uvm_object& rhs, const uvm::uvm_comparer* comparer ) const
+  {
+    const packet_header* rhs_ = dynamic_cast<const packet_header*>(&rhs);
+    if (rhs_ == NULL)
+      return false;
+
+    bool equal = comparer->compare_field_int("addr", addr, rhs_->addr, 32);
+    equal = comparer->compare_string("cmd", cmd, rhs_->cmd) && equal;
+    if (owner != NULL && rhs_->owner != NULL)
+      equal = comparer->compare_object("owner", *owner, *rhs_->owner) && equal;
+    return equal;
+  }
+};
+
+class packet : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(packet);
+
+  packet_header hdr;
+  std::vector<unsigned int> payload;
+
+  packet( const std::string& name = "packet" )
+  : uvm::uvm_object(name), hdr("hdr")
+  {
+    hdr.owner = this;
+  }
+
+  bool do_compare( const uvm::uvm_object& rhs, const uvm::uvm_comparer* comparer ) const
+  {
+    const packet* rhs_ = dynamic_cast<const packet*>(&rhs);
+    if (rhs_ == NULL)
+      return false;
+
+    bool equal = comparer->compare_object("hdr", hdr, rhs_->hdr);
+    equal = comparer->compare_field_int("size", payload.size(), rhs_->payload.size(), 32) && equal;
+
+    for (unsigned int i = 0; i < payload.size() && i < rhs_->payload.size(); i++)
+    {
+      // the comparer stops at the first miscompare in early exit mode
+      if (!equal && comparer->get_early_exit())
+        break;
+
+      if (payload[i] != rhs_->payload[i])
+      {
+        std::ostringstream str;
+        str << "payload[" << i << "]";
+        equal = comparer->compare_field_int(str.str(), payload[i], rhs_->payload[i], 32) && equal;
+      }
+    }
+    return equal;
+  }
+};
+
+#endif /* PACKET_H_ */
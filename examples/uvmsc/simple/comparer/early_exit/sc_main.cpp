@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Boolean comparisons with the early exit mode of the comparer.
+//
+// Two packets, whose headers refer back to the packet, are compared with
+// a comparer in the default mode and with a comparer in early exit mode.
+// The example checks that the cycle does not cause an endless recursion,
+// that the default comparer counts all miscompares, and that the early
+// exit comparer stops at the first one and formats its message only when
+// asked. A cycle which leads back to the first packet on one side but to
+// another packet on the other side must still be compared. It then compares the time needed for many comparisons of packets
+// which differ in the header.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <sstream>
+
+#include "packet.h"
+
+class early_exit_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(early_exit_test);
+
+  early_exit_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name)
+  {}
+
+  static void fill( packet& p, unsigned int size )
+  {
+    p.hdr.addr = 0x100;
+    p.hdr.cmd = "WRITE";
+    p.payload.clear();
+    for (unsigned int i = 0; i < size; i++)
+      p.payload.push_back(i);
+  }
+
+  void check()
+  {
+    packet a("a"), b("b");
+    fill(a, 16);
+    fill(b, 16);
+
+    uvm::uvm_comparer full;
+    full.set_max_messages(0);
+
+    uvm::uvm_comparer fast;
+    fast.set_early_exit();
+    fast.set_max_messages(0);
+
+    if (!a.compare(b, &full) || !a.compare(b, &fast))
+      uvm_report_error("EQUAL", "Equal packets do not compare equal");
+
+    b.hdr.addr = 0x104;
+    b.payload[3] = 0;
+    b.payload[7] = 0;
+
+    if (a.compare(b, &full) || full.get_result() != 3)
+      uvm_report_error("FULL", "Default comparer did not count all miscompares");
+
+    if (a.compare(b, &fast) || fast.get_result() != 1)
+      uvm_report_error("FAST", "Early exit comparer did not stop at the first miscompare");
+
+    std::string msg = fast.get_miscompare_string();
+    if (msg.find("addr") == std::string::npos || msg.find("payload") != std::string::npos)
+      uvm_report_error("FAST", "Unexpected miscompare string: " + msg);
+
+    uvm_report_info("MISCMP", "Early exit miscompare: " + msg, uvm::UVM_NONE);
+
+    // the owner of the header of d is not d itself, but a packet which
+    // differs from c; the comparer must not take c as already compared
+    packet c("c"), d("d"), e("e");
+    fill(c, 16);
+    fill(d, 16);
+    fill(e, 16);
+    e.hdr.cmd = "READ";
+    d.hdr.owner = &e;
+
+    if (c.compare(d, &full) || c.compare(d, &fast))
+      uvm_report_error("CYCLE", "Packets with different owners compare equal");
+
+    // the compare member functions called directly, rather than through
+    // uvm_object::compare, need a reset of the previous miscompare
+    fast.reset();
+    if (!fast.compare_field_int("x", 1, 1, 32) || fast.get_result() != 0)
+      uvm_report_error("RESET", "Reset comparer still skips its fields");
+  }
+
+  void measure( uvm::uvm_comparer& comparer, const std::string& kind )
+  {
+    packet a("a"), b("b");
+    fill(a, 256);
+    fill(b, 256);
+    b.hdr.addr = 0x104;
+    for (unsigned int i = 0; i < b.payload.size(); i += 2)
+      b.payload[i] = 0;
+
+    const unsigned int n = 20000;
+    unsigned int miscompares = 0;
+
+    std::clock_t start = std::clock();
+    for (unsigned int i = 0; i < n; i++)
+      if (!a.compare(b, &comparer))
+        miscompares++;
+    double t = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    if (miscompares != n)
+      uvm_report_error("TIME", "Different packets compared equal");
+
+    std::ostringstream str;
+    str << kind << " comparer, " << n << " comparisons: " << t << " s";
+    uvm_report_info("TIME", str.str(), uvm::UVM_NONE);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    check();
+
+    uvm::uvm_comparer full;
+    full.set_max_messages(0);
+    measure(full, "default");
+
+    uvm::uvm_comparer fast;
+    fast.set_early_exit();
+    fast.set_max_messages(0);
+    measure(fast, "early exit");
+
+    phase.drop_objection(this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("early_exit_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
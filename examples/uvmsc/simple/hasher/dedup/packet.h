@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef PACKET_H_
+#define PACKET_H_
+
+#include <systemc>
+#include <uvm>
+#include <vector>
+
+// Packet which only implements do_pack; its hash is computed from the
+// packed stream by the default do_hash.
+
+class packed_packet : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(packed_packet);
+
+  unsigned int addr;
+  sc_dt::sc_uint<12> len;
+  std::vector<unsigned char> data;
+
+  packed_packet( const std::string& name = "packed_packet" )
+  : uvm::uvm_object(name), addr(0), len(0)
+  {}
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    packer << addr << len << data;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    packer >> addr >> len >> data;
+  }
+
+  bool do_compare( const uvm::uvm_object& rhs, const uvm::uvm_comparer* comparer ) const
+  {
+    const packed_packet* rhs_ = dynamic_cast<const packed_packet*>(&rhs);
+    return rhs_ != NULL && addr == rhs_->addr && len == rhs_->len && data == rhs_->data;
+  }
+};
+
+// Packet which feeds its fields to the hasher directly. The name is not
+// compared, so it is not hashed either.
+
+class hashed_packet : public packed_packet
+{
+ public:
+  UVM_OBJECT_UTILS(hashed_packet);
+
+  hashed_packet( const std::string& name = "hashed_packet" )
+  : packed_packet(name)
+  {}
+
+  virtual void do_hash( uvm::uvm_hasher& hasher ) const
+  {
+    hasher << addr << len << data;
+  }
+};
+
+#endif /* PACKET_H_ */
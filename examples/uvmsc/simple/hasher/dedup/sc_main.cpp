@@ -0,0 +1,158 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Removing duplicate packets with the content hash of uvm_object.
+//
+// Packets are drawn from a small set of distinct contents and bucketed
+// by their hash; within a bucket, compare tells duplicates apart from
+// collisions. The example checks that equal packets hash equally, that
+// the duplicates are found, and compares the time needed to hash a
+// packet from its packed stream with the time needed when its do_hash
+// feeds the fields to the hasher directly.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include "packet.h"
+
+class dedup_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(dedup_test);
+
+  dedup_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name)
+  {}
+
+  static void fill( packed_packet& p, unsigned int seed )
+  {
+    p.addr = 0x1000 + 16 * (seed % 64);
+    p.len = 8 + seed % 5;
+    p.data.clear();
+    for (unsigned int i = 0; i < p.len; i++)
+      p.data.push_back((unsigned char)(seed * 31 + i));
+  }
+
+  template <typename PACKET>
+  unsigned int count_unique( unsigned int num, unsigned int distinct )
+  {
+    typedef std::map<sc_dt::uint64, std::vector<PACKET*> > bucket_mapT;
+    bucket_mapT buckets;
+    std::vector<PACKET*> all;
+    unsigned int unique = 0;
+
+    for (unsigned int i = 0; i < num; i++)
+    {
+      PACKET* p = new PACKET("p");
+      fill(*p, (i * 7919) % distinct);
+      all.push_back(p);
+
+      std::vector<PACKET*>& bucket = buckets[p->hash()];
+      bool duplicate = false;
+      for (unsigned int j = 0; j < bucket.size() && !duplicate; j++)
+        duplicate = p->compare(*bucket[j]);
+
+      if (!duplicate)
+      {
+        bucket.push_back(p);
+        unique++;
+      }
+    }
+
+    if (buckets.size() != unique)
+      uvm_report_warning("DEDUP", "Hash collision between different packets");
+
+    for (unsigned int i = 0; i < all.size(); i++)
+      delete all[i];
+
+    return unique;
+  }
+
+  void check()
+  {
+    hashed_packet a("a"), b("b");
+    fill(a, 3);
+    fill(b, 3);
+
+    if (a.hash() != b.hash())
+      uvm_report_error("HASH", "Equal packets have different hashes");
+
+    b.data[2]++;
+    if (a.hash() == b.hash())
+      uvm_report_error("HASH", "Packets differing in one byte have equal hashes");
+
+    packed_packet c("c"), d("d");
+    fill(c, 3);
+    fill(d, 3);
+    if (c.hash() != d.hash())
+      uvm_report_error("HASH", "Equal packed packets have different hashes");
+
+    if (count_unique<packed_packet>(2000, 500) != 500 ||
+        count_unique<hashed_packet>(2000, 500) != 500)
+      uvm_report_error("DEDUP", "Wrong number of unique packets");
+  }
+
+  template <typename PACKET>
+  void measure( const std::string& kind )
+  {
+    PACKET p("p");
+    fill(p, 11);
+
+    const unsigned int n = 100000;
+    sc_dt::uint64 sum = 0;
+
+    std::clock_t start = std::clock();
+    for (unsigned int i = 0; i < n; i++)
+      sum += p.hash();
+    double t = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ostringstream str;
+    str << kind << ", " << n << " hashes: " << t << " s"
+        << " (check 0x" << std::hex << sum << ")";
+    uvm_report_info("TIME", str.str(), uvm::UVM_NONE);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    check();
+
+    measure<packed_packet>("packed stream");
+    measure<hashed_packet>("do_hash");
+
+    phase.drop_objection(this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("dedup_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
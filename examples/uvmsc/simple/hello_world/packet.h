@@ -44,6 +44,16 @@ class packet : public uvm::uvm_transaction
     printer.print_field_int("addr", addr);
   }
 
+  virtual void do_pack(uvm::uvm_packer& packer) const
+  {
+    packer << addr;
+  }
+
+  virtual void do_unpack(uvm::uvm_packer& packer)
+  {
+    packer >> addr;
+  }
+
 };
 
 #endif /* PACKET_H_ */
@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+
+#ifndef FRAME_H_
+#define FRAME_H_
+
+#include <systemc>
+#include <uvm>
+
+// Frame whose fields are not byte aligned: addr starts at bit 17 and
+// data at bit 49, so data spans 9 bytes of the packed stream. The frame
+// is 121 bits long, so the last byte is only partly used.
+
+class frame : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(frame);
+
+  sc_dt::sc_uint<3> type;
+  bool valid;
+  sc_dt::sc_bv<13> len;
+  unsigned int addr;
+  sc_dt::uint64 data;
+  char tag;
+
+  frame( const std::string& name = "frame" )
+  : uvm::uvm_object(name), type(0), valid(false), len(0), addr(0),
+    data(0), tag(0)
+  {}
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    packer << type << valid << len << addr << data << tag;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    packer >> type >> valid >> len >> addr >> data >> tag;
+  }
+
+  bool equals( const frame& rhs ) const
+  {
+    return type == rhs.type && valid == rhs.valid && len == rhs.len &&
+           addr == rhs.addr && data == rhs.data && tag == rhs.tag;
+  }
+};
+
+#endif /* FRAME_H_ */
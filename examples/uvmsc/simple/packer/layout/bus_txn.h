@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BUS_TXN_H_
+#define BUS_TXN_H_
+
+#include <systemc>
+#include <uvm>
+#include <vector>
+
+// Bus transaction whose header fields are packed, unpacked, compared and
+// printed through a compile-time layout; the payload is packed after the
+// layout with the packer operators.
+
+class bus_txn : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(bus_txn);
+
+  unsigned int addr;
+  unsigned int wdata;
+  unsigned char be;
+  bool last;
+  sc_dt::sc_uint<3> burst;
+  double delay;
+  float weight;
+  std::vector<unsigned char> data;
+
+  UVM_LAYOUT_FIELD(unsigned int, addr)
+  UVM_LAYOUT_FIELD(unsigned int, wdata)
+  UVM_LAYOUT_FIELD_BITS(unsigned char, be, 4)
+  UVM_LAYOUT_FIELD(bool, last)
+  UVM_LAYOUT_FIELD(sc_dt::sc_uint<3>, burst)
+  UVM_LAYOUT_FIELD(double, delay)
+  UVM_LAYOUT_FIELD(float, weight)
+
+  typedef uvm::uvm_layout< uvm_layout_field_addr,
+                           uvm_layout_field_wdata,
+                           uvm_layout_field_be,
+                           uvm_layout_field_last,
+                           uvm_layout_field_burst,
+                           uvm_layout_field_delay,
+                           uvm_layout_field_weight > layout;
+
+  bus_txn( const std::string& name = "bus_txn" )
+  : uvm::uvm_object(name), addr(0), wdata(0), be(0), last(false), burst(0),
+    delay(0.0), weight(0.0f)
+  {}
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    layout::pack(*this, packer);
+    packer << data;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    layout::unpack(*this, packer);
+    packer >> data;
+  }
+
+  virtual bool do_compare( const uvm::uvm_object& rhs, const uvm::uvm_comparer* comparer ) const
+  {
+    const bus_txn* rhs_ = dynamic_cast<const bus_txn*>(&rhs);
+    if(rhs_ == NULL)
+      UVM_FATAL("do_compare", "cast failed, check type compatibility");
+
+    return layout::compare(*this, *rhs_) && (data == rhs_->data);
+  }
+
+  void do_print( const uvm::uvm_printer& printer ) const
+  {
+    layout::print(*this, printer);
+  }
+};
+
+// The same transaction, packed field by field with the packer.
+
+class bus_txn_classic : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(bus_txn_classic);
+
+  unsigned int addr;
+  unsigned int wdata;
+  unsigned char be;
+  bool last;
+  sc_dt::sc_uint<3> burst;
+  double delay;
+  float weight;
+  std::vector<unsigned char> data;
+
+  bus_txn_classic( const std::string& name = "bus_txn_classic" )
+  : uvm::uvm_object(name), addr(0), wdata(0), be(0), last(false), burst(0),
+    delay(0.0), weight(0.0f)
+  {}
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    packer << addr << wdata;
+    packer.pack_field_int(be, 4);
+    packer << last << burst << delay << weight << data;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    packer >> addr >> wdata;
+    be = (unsigned char)packer.unpack_field_int(4);
+    packer >> last >> burst >> delay >> weight >> data;
+  }
+};
+
+#endif /* BUS_TXN_H_ */
@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Compile-time serialization layouts.
+//
+// The header fields of bus_txn are packed through a uvm_layout, and the
+// same fields of bus_txn_classic one by one with the packer. The example
+// checks, in little-endian and big-endian order, that both produce the
+// same stream and unpack each other's stream. It then compares the time
+// taken to pack and unpack both transactions.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <sstream>
+
+#include "bus_txn.h"
+
+class layout_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(layout_test);
+
+  int n_txns;
+
+  layout_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name), n_txns(200000)
+  {}
+
+  template <class T>
+  void fill( T& t )
+  {
+    t.addr = 0x12345678;
+    t.wdata = 0xcafef00d;
+    t.be = 0xa;
+    t.last = true;
+    t.burst = 5;
+    t.delay = -2.5e-9;
+    t.weight = 0.375f;
+    t.data.clear();
+    for (int i = 0; i < 8; i++)
+      t.data.push_back((unsigned char)(i * 3));
+  }
+
+  template <class A, class B>
+  bool same( const A& a, const B& b )
+  {
+    return a.addr == b.addr && a.wdata == b.wdata && a.be == b.be &&
+           a.last == b.last && a.burst == b.burst && a.delay == b.delay &&
+           a.weight == b.weight && a.data == b.data;
+  }
+
+  void check( bool big_endian )
+  {
+    std::string order = big_endian ? "big-endian" : "little-endian";
+
+    bus_txn t, t2;
+    bus_txn_classic c, c2;
+    fill(t);
+    fill(c);
+
+    std::vector<unsigned char> tbytes, cbytes;
+    int tbits = t.pack_bytes(tbytes);
+    int cbits = c.pack_bytes(cbytes);
+
+    if (tbits != cbits || tbytes != cbytes)
+      uvm_report_error("STREAM", "Layout stream differs from the packer stream, " + order);
+
+    t2.unpack_bytes(cbytes);
+    c2.unpack_bytes(tbytes);
+
+    if (!same(t2, c) || !same(c2, t))
+      uvm_report_error("UNPACK", "Layout and packer streams do not unpack each other, " + order);
+
+    if (!t.compare(t2))
+      uvm_report_error("COMPARE", "Unpacked transaction does not compare equal, " + order);
+
+    t2.be = 0x5;
+    if (t.compare(t2))
+      uvm_report_error("COMPARE", "Modified transaction compares equal, " + order);
+
+    std::ostringstream str;
+    str << order << " stream of " << tbits << " bits, header layout of "
+        << bus_txn::layout::bits << " bits matches the packer";
+    uvm_report_info("LAYOUT", str.str(), uvm::UVM_NONE);
+  }
+
+  template <class T>
+  void measure( const std::string& kind )
+  {
+    T t, t2;
+    fill(t);
+
+    std::vector<unsigned char> bytes;
+
+    std::clock_t start = std::clock();
+    for (int i = 0; i < n_txns; i++)
+    {
+      bytes.clear();
+      t.pack_bytes(bytes);
+    }
+    double pack_time = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for (int i = 0; i < n_txns; i++)
+      t2.unpack_bytes(bytes);
+    double unpack_time = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ostringstream str;
+    str << kind << ", " << n_txns << " transactions: pack "
+        << pack_time * 1e9 / n_txns << " ns, unpack "
+        << unpack_time * 1e9 / n_txns << " ns per transaction";
+    uvm_report_info("TIME", str.str(), uvm::UVM_NONE);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    for (int k = 0; k < 2; k++)
+    {
+      uvm::uvm_default_packer->big_endian = (k == 1);
+      check(k == 1);
+    }
+    uvm::uvm_default_packer->big_endian = false;
+
+    bus_txn t;
+    fill(t);
+    t.print();
+
+    measure<bus_txn_classic>("packer");
+    measure<bus_txn>("layout");
+
+    phase.drop_objection(this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("layout_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BUS_PACKET_H_
+#define BUS_PACKET_H_
+
+#include <systemc>
+#include <uvm>
+#include <vector>
+
+// Bus transaction with fields of the kinds most often packed: integers,
+// a flag, a SystemC integer and a byte payload.
+
+class bus_packet : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(bus_packet);
+
+  unsigned int addr;
+  unsigned char cmd;
+  bool last;
+  sc_dt::sc_uint<12> len;
+  std::vector<unsigned char> data;
+
+  bus_packet( const std::string& name = "bus_packet" )
+  : uvm::uvm_object(name), addr(0), cmd(0), last(false), len(0)
+  {}
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    packer << addr << cmd << last << len << data;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    packer >> addr >> cmd >> last >> len >> data;
+  }
+
+  bool same( const bus_packet& rhs ) const
+  {
+    return addr == rhs.addr && cmd == rhs.cmd && last == rhs.last &&
+           len == rhs.len && data == rhs.data;
+  }
+};
+
+#endif /* BUS_PACKET_H_ */
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef FRAME_H_
+#define FRAME_H_
+
+#include <systemc>
+#include <uvm>
+#include <sstream>
+#include <vector>
+
+class frame_header : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(frame_header);
+
+  unsigned int len;
+  std::string tag;
+
+  frame_header( const std::string& name = "frame_header" )
+  : uvm::uvm_object(name), len(0)
+  {}
+
+  void do_print( const uvm::uvm_printer& printer ) const
+  {
+    printer.print_field_int("len", len, 16, uvm::UVM_DEC);
+    printer.print_string("tag", tag);
+  }
+};
+
+class frame : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(frame);
+
+  frame_header hdr;
+  std::vector<unsigned int> payload;
+
+  frame( const std::string& name = "frame" )
+  : uvm::uvm_object(name), hdr("hdr")
+  {}
+
+  void do_print( const uvm::uvm_printer& printer ) const
+  {
+    printer.print_object("hdr", hdr);
+    printer.print_array_header("payload", payload.size());
+    for (unsigned int i = 0; i < payload.size(); i++)
+    {
+      std::ostringstream str;
+      str << "[" << i << "]";
+      printer.print_field_int(str.str(), payload[i], 32, uvm::UVM_DEC, "[");
+    }
+    printer.print_array_footer(payload.size());
+  }
+};
+
+#endif /* FRAME_H_ */
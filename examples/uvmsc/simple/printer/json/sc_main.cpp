@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Machine-readable output with the JSON printer.
+//
+// A frame with a nested header object and a payload array is printed
+// with the uvm_json_printer, once into a string and once directly into
+// a stream. The example checks that both outputs are the same and hold
+// the expected JSON members, then compares the time needed to print a
+// large frame with the table printer and with the JSON printer.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <sstream>
+
+#include "frame.h"
+
+class json_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(json_test);
+
+  json_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name)
+  {}
+
+  void check()
+  {
+    frame f;
+    f.hdr.len = 3;
+    f.hdr.tag = "a\"b";
+    f.payload.push_back(10);
+    f.payload.push_back(20);
+
+    uvm::uvm_json_printer printer;
+    printer.knobs.reference = false;
+
+    std::string s = f.sprint(&printer);
+
+    std::ostringstream os;
+    printer.set_stream(&os);
+    f.sprint(&printer);
+    printer.set_stream(NULL);
+
+    if (os.str() != s)
+      uvm_report_error("STREAM", "Streamed JSON differs from the sprint string");
+
+    const char* expected[] = {
+      "{\"name\":\"frame\",\"type\":\"frame\",\"size\":\"-\",\"value\":\"-\",\"fields\":[",
+      "{\"name\":\"len\",\"type\":\"int\",\"size\":\"16\",\"value\":\"3\"}",
+      "\"value\":\"a\\\"b\"",
+      "\"size\":\"32\",\"value\":\"20\"}]}]}\n"
+    };
+
+    for (unsigned int i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+      if (s.find(expected[i]) == std::string::npos)
+        uvm_report_error("JSON", std::string("Missing in JSON output: ") + expected[i]);
+
+    uvm_report_info("JSON", s, uvm::UVM_NONE);
+  }
+
+  void measure( uvm::uvm_printer* printer, const std::string& kind )
+  {
+    frame f;
+    for (unsigned int i = 0; i < 20000; i++)
+      f.payload.push_back(i);
+
+    std::clock_t start = std::clock();
+    std::string s = f.sprint(printer);
+    double t = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ostringstream str;
+    str << kind << " printer, " << f.payload.size() << " elements: "
+        << s.size() << " characters in " << t << " s";
+    uvm_report_info("TIME", str.str(), uvm::UVM_NONE);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    check();
+    measure(uvm::uvm_default_table_printer, "table");
+    measure(uvm::uvm_default_json_printer, "json");
+
+    phase.drop_objection(this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("json_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Streaming output of the printers.
+//
+// An object holding a large array is printed with the table and tree
+// printers, once with sprint into a string and once with sprint directly
+// into a file. The example checks that both produce the same text and
+// reports the time taken by each.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+class big_array : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(big_array);
+
+  std::vector<unsigned int> values;
+
+  big_array( const std::string& name = "big_array" )
+  : uvm::uvm_object(name)
+  {}
+
+  void do_print( const uvm::uvm_printer& printer ) const
+  {
+    printer.print_array_header("values", values.size());
+    for (unsigned int i = 0; i < values.size(); i++)
+    {
+      std::ostringstream str;
+      str << "[" << i << "]";
+      printer.print_field_int(str.str(), values[i], 32, uvm::UVM_HEX, "[");
+    }
+    printer.print_array_footer(values.size());
+  }
+};
+
+class streaming_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(streaming_test);
+
+  streaming_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name)
+  {}
+
+  void measure( const big_array& obj, uvm::uvm_printer* printer, const std::string& kind )
+  {
+    std::string file = "streaming_" + kind + ".txt";
+
+    std::clock_t start = std::clock();
+    std::string s = obj.sprint(printer);
+    double string_time = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    {
+      std::ofstream out(file.c_str());
+      obj.sprint(out, printer);
+    }
+    double stream_time = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ifstream in(file.c_str());
+    std::ostringstream content;
+    content << in.rdbuf();
+
+    if (content.str() != s)
+      uvm_report_error("MISMATCH", "Output written to " + file + " differs from the sprint string");
+
+    std::ostringstream str;
+    str << kind << " printer, " << s.size() << " characters: sprint to string "
+        << string_time << " s, sprint to file " << stream_time << " s";
+    uvm_report_info("TIME", str.str(), uvm::UVM_NONE);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    big_array obj;
+    for (unsigned int i = 0; i < 10000; i++)
+      obj.values.push_back(i * 0x9e3779b9u);
+
+    measure(obj, uvm::uvm_default_table_printer, "table");
+    measure(obj, uvm::uvm_default_tree_printer, "tree");
+
+    phase.drop_objection(this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("streaming_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BUS_ITEM_H_
+#define BUS_ITEM_H_
+
+#include <systemc>
+#include <uvm>
+
+class bus_item : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(bus_item);
+
+  bus_item( const std::string& name = "bus_item" )
+  : uvm::uvm_object(name), addr(0), data(0), write(false)
+  {}
+
+  virtual void do_record( const uvm::uvm_recorder& recorder )
+  {
+    uvm::uvm_recorder* rec = const_cast<uvm::uvm_recorder*>(&recorder);
+    rec->record_field("addr", addr, 32);
+    rec->record_field("data", data, 32);
+    rec->record_string("kind", write ? "WRITE" : "READ");
+  }
+
+  unsigned int addr;
+  unsigned int data;
+  bool write;
+};
+
+#endif // BUS_ITEM_H_
@@ -0,0 +1,222 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Recording transactions into the binary transaction database.
+//
+// A test records bus transactions through a uvm_recorder and interrupt
+// transactions directly through the uvm_tr_database API, on two streams.
+// Each interrupt is linked to the bus transaction that caused it. After
+// the database is closed, the statistics of its background writer are
+// printed. The database is then opened again to record a third stream,
+// which continues the file. Finally the file is opened with the
+// uvm_tr_database_reader and queried by stream, by time range and by
+// attribute value.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <sstream>
+
+#include "bus_item.h"
+
+class tr_database_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(tr_database_test);
+
+  tr_database_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name), db(NULL)
+  {}
+
+  static const int num_items = 100;
+
+  void record()
+  {
+    db = new uvm::uvm_tr_database("db");
+    db->set_file_name("tr_database.bin");
+
+    // small buffers, so that the background writer is exercised
+    db->set_buffer_size(512);
+
+    if (!db->open_db())
+    {
+      uvm_report_fatal("OPEN", "Cannot open " + db->get_file_name());
+      return;
+    }
+
+    uvm::uvm_tr_stream* bus = db->open_stream("bus", get_full_name());
+    uvm::uvm_tr_stream* irq = db->open_stream("irq", get_full_name());
+
+    uvm::uvm_recorder rec;
+    rec.set_db(db);
+
+    bus_item item;
+
+    for (int i = 0; i < num_items; i++)
+    {
+      sc_core::wait(10, sc_core::SC_NS);
+
+      item.addr = 0x1000 + 4 * (i % 16);
+      item.data = i;
+      item.write = (i % 2) == 0;
+
+      int h = bus->begin_tr("bus_item");
+      rec.tr_handle = h;
+      item.record(&rec);
+
+      sc_core::wait(5, sc_core::SC_NS);
+      db->end_tr(h);
+
+      if (i % 10 == 9)
+      {
+        int ih = irq->begin_tr("irq");
+        db->set_attribute_int(ih, "line", i / 10, 8);
+        db->set_attribute_real(ih, "latency", 2.5);
+        db->establish_link(ih, h, "cause");
+        db->end_tr(ih, sc_core::sc_time_stamp() + sc_core::sc_time(1, sc_core::SC_NS));
+      }
+    }
+
+    db->close_db();
+
+    uvm::uvm_tr_db_write_statistics stats = db->get_statistics();
+    if (stats.buffers < 2)
+      uvm_report_error("WRITER", "Records were not written in multiple buffers");
+
+    std::ostringstream str;
+    db->print_statistics(str);
+    uvm_report_info("WRITER", str.str(), uvm::UVM_NONE);
+
+    // opening the database again continues the file
+    if (!db->open_db())
+    {
+      uvm_report_fatal("OPEN", "Cannot open " + db->get_file_name() + " again");
+      return;
+    }
+
+    uvm::uvm_tr_stream* late = db->open_stream("late", get_full_name());
+    db->end_tr(late->begin_tr("late"));
+    db->close_db();
+  }
+
+  void check()
+  {
+    uvm::uvm_tr_database_reader reader;
+
+    if (!reader.open(db->get_file_name()))
+    {
+      uvm_report_error("READ", "Cannot read database: " + reader.get_error());
+      return;
+    }
+
+    int bus = reader.find_stream("bus", get_full_name());
+    int irq = reader.find_stream("irq", get_full_name());
+    int late = reader.find_stream("late", get_full_name());
+
+    if (reader.get_num_streams() != 3 || bus == 0 || irq == 0 || late == 0)
+      uvm_report_error("STREAM", "Streams not found in the database");
+
+    std::vector<const uvm::uvm_tr_db_transaction*> q;
+
+    reader.get_transactions(q, bus);
+    if (q.size() != (unsigned int)num_items)
+      uvm_report_error("BUS", "Unexpected number of bus transactions");
+
+    // bus transactions start every 15 ns from 10 ns on, so seven of
+    // them overlap the range 10 ns .. 100 ns
+    sc_dt::uint64 from = sc_core::sc_time(10, sc_core::SC_NS).value();
+    sc_dt::uint64 to = sc_core::sc_time(100, sc_core::SC_NS).value();
+    reader.get_transactions(q, bus, from, to);
+    if (q.size() != 7)
+      uvm_report_error("RANGE", "Unexpected number of transactions in time range");
+
+    reader.find_transactions(q, "addr", 0x1004, bus);
+    if (q.size() != (unsigned int)num_items / 16 + 1)
+      uvm_report_error("FIND", "Unexpected number of transactions with addr 0x1004");
+
+    for (unsigned int i = 0; i < q.size(); i++)
+    {
+      const uvm::uvm_tr_db_attribute* kind = reader.find_attribute(*q[i], "kind");
+      const uvm::uvm_tr_db_attribute* data = reader.find_attribute(*q[i], "data");
+
+      if (kind == NULL || data == NULL)
+      {
+        uvm_report_error("ATTR", "Missing attributes");
+        continue;
+      }
+
+      std::string expected = (reader.get_int(*data) % 2) == 0 ? "WRITE" : "READ";
+      if (reader.get_string_value(*kind) != expected)
+        uvm_report_error("ATTR", "Unexpected kind attribute");
+    }
+
+    reader.get_transactions(q, late);
+    if (q.size() != 1)
+      uvm_report_error("LATE", "Transaction recorded after reopening not found");
+
+    reader.get_transactions(q, irq);
+    if (q.size() != (unsigned int)num_items / 10)
+      uvm_report_error("IRQ", "Unexpected number of interrupt transactions");
+
+    for (unsigned int i = 0; i < q.size(); i++)
+    {
+      std::vector<int> links;
+      std::vector<unsigned int> relations;
+      reader.get_links(q[i]->handle, links, relations);
+
+      const uvm::uvm_tr_db_attribute* latency = reader.find_attribute(*q[i], "latency");
+
+      if (links.size() != 1 || reader.get_string(relations[0]) != "cause")
+        uvm_report_error("LINK", "Interrupt is not linked to its bus transaction");
+      else if (reader.get_transaction(links[0])->stream != bus)
+        uvm_report_error("LINK", "Interrupt is linked to the wrong stream");
+
+      if (latency == NULL || reader.get_real(*latency) != 2.5)
+        uvm_report_error("ATTR", "Unexpected latency attribute");
+    }
+
+    std::ostringstream str;
+    str << reader.get_num_transactions() << " transactions read from "
+        << db->get_file_name();
+    uvm_report_info("READ", str.str(), uvm::UVM_NONE);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    record();
+    check();
+
+    phase.drop_objection(this);
+  }
+
+  uvm::uvm_tr_database* db;
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("tr_database_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Binary report log, decoded with uvm_binary_report_reader.
+//
+// This example installs a uvm_binary_report_server, runs a test which
+// issues messages at different simulation times, and then decodes the
+// log and checks that every message matches the text the
+// uvm_default_report_server would have displayed.
+//
+// A log is written by any simulation when the environment variable
+// UVM_SYSTEMC_REPORT_BINARY names the log file. It is decoded after the
+// simulation with the installed uvm-report-decode tool:
+//
+//   uvm-report-decode <log> [-id ID] [-severity SEVERITY]
+//                           [-from TIME] [-to TIME]
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace uvm;
+using namespace sc_core;
+
+// keeps the text of every logged message, for comparison with the decoder
+class checked_report_server : public uvm_binary_report_server
+{
+ public:
+  std::vector<std::string> expected;
+
+  checked_report_server( const std::string& filename )
+  : uvm_binary_report_server(filename) {}
+
+  virtual void execute_report_message( uvm_report_message* report_message,
+                                       const std::string& composed_message )
+  {
+    if (report_message->get_action() & (UVM_DISPLAY | UVM_LOG))
+      expected.push_back(compose_report_message(report_message));
+    uvm_binary_report_server::execute_report_message(report_message, composed_message);
+  }
+};
+
+class comp_a : public uvm_component
+{
+ public:
+  comp_a( uvm_component_name name ) : uvm_component(name) {}
+
+  UVM_COMPONENT_UTILS(comp_a);
+
+  void run_phase( uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    for (int i = 0; i < 5; i++)
+    {
+      UVM_INFO_STREAM("LOOP", "Iteration " << i, UVM_LOW);
+      sc_core::wait(1500, SC_PS);
+    }
+
+    uvm_report_info("NOFILE", "Message without file and line", UVM_NONE);
+    UVM_WARNING("LATE", "Warning after 7500 ps");
+
+    sc_core::wait(2, SC_MS);
+    uvm_report_info("LATE", "Message at a large time", UVM_MEDIUM);
+
+    phase.drop_objection(this);
+  }
+};
+
+class test : public uvm_test
+{
+ public:
+  comp_a* a;
+
+  test( uvm_component_name name ) : uvm_test(name), a(NULL) {}
+
+  UVM_COMPONENT_UTILS(test);
+
+  void build_phase( uvm_phase& phase )
+  {
+    a = comp_a::type_id::create("a", this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  checked_report_server* server = new checked_report_server("binary_log.bin");
+  uvm_coreservice_t::get()->set_report_server(server);
+
+  run_test("test");
+
+  server->flush();
+
+  uvm_binary_report_reader reader;
+  if (!reader.open(server->get_filename()))
+  {
+    std::cerr << reader.get_error() << std::endl;
+    return 1;
+  }
+
+  unsigned int n = 0;
+  unsigned int mismatches = 0;
+  uvm_binary_report_record rec;
+
+  while (reader.next(rec))
+  {
+    std::string text = reader.compose(rec);
+    std::cout << text << std::endl;
+
+    if (n >= server->expected.size() || text != server->expected[n])
+      mismatches++;
+    n++;
+  }
+
+  if (n != server->expected.size())
+    mismatches++;
+
+  std::cout << "Decoded " << n << " messages, "
+            << mismatches << " mismatches" << std::endl;
+
+  return (mismatches == 0) ? 0 : 1;
+}
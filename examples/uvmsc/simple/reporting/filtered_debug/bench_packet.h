@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BENCH_PACKET_H_
+#define BENCH_PACKET_H_
+
+#include <systemc>
+#include <uvm>
+
+// Object with a fixed number of integral fields and one string field.
+// Every field goes through the uvm_packer, which emits a UVM_DEBUG
+// message per field.
+
+class bench_packet : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(bench_packet);
+
+  static const int n_fields = 8;
+
+  int field[n_fields];
+  std::string tag;
+
+  bench_packet( const std::string& name = "bench_packet" )
+  : uvm::uvm_object(name), tag("bench")
+  {
+    for (int i = 0; i < n_fields; i++)
+      field[i] = i * 0x01010101;
+  }
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    for (int i = 0; i < n_fields; i++)
+      packer << field[i];
+    packer << tag;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    for (int i = 0; i < n_fields; i++)
+      packer >> field[i];
+    packer >> tag;
+  }
+};
+
+#endif /* BENCH_PACKET_H_ */
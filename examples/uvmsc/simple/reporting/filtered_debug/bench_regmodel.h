@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BENCH_REGMODEL_H_
+#define BENCH_REGMODEL_H_
+
+#include <systemc>
+#include <uvm>
+
+// Minimal register model with a single 32-bit register, accessed through
+// a zero-delay bus driver. Each access goes through uvm_reg_map::do_bus_write
+// or do_bus_read, which emit two UVM_FULL messages per bus beat.
+
+class bench_rw : public uvm::uvm_sequence_item
+{
+ public:
+  UVM_OBJECT_UTILS(bench_rw);
+
+  bool read;
+  sc_dt::uint64 addr;
+  sc_dt::uint64 data;
+
+  bench_rw( const std::string& name = "bench_rw" )
+  : uvm::uvm_sequence_item(name), read(false), addr(0), data(0)
+  {}
+};
+
+class bench_reg : public uvm::uvm_reg
+{
+ public:
+  UVM_OBJECT_UTILS(bench_reg);
+
+  uvm::uvm_reg_field* value;
+
+  bench_reg( const std::string& name = "bench_reg" )
+  : uvm::uvm_reg(name, 32, uvm::UVM_NO_COVERAGE), value(NULL)
+  {}
+
+  virtual void build()
+  {
+    value = uvm::uvm_reg_field::type_id::create("value");
+    value->configure(this, 32, 0, "RW", false, 0x0, true, true, true);
+  }
+};
+
+class bench_block : public uvm::uvm_reg_block
+{
+ public:
+  UVM_OBJECT_UTILS(bench_block);
+
+  bench_reg* R;
+
+  bench_block( const std::string& name = "bench_block" )
+  : uvm::uvm_reg_block(name, uvm::UVM_NO_COVERAGE), R(NULL)
+  {}
+
+  virtual void build()
+  {
+    default_map = create_map("default_map", 0x0, 4, uvm::UVM_LITTLE_ENDIAN);
+
+    R = bench_reg::type_id::create("R");
+    R->configure(this, NULL, "R_reg");
+    R->build();
+
+    default_map->add_reg(R, 0x10, "RW");
+  }
+};
+
+class bench_sequencer : public uvm::uvm_sequencer<bench_rw>
+{
+ public:
+  UVM_COMPONENT_UTILS(bench_sequencer);
+
+  bench_sequencer( uvm::uvm_component_name name )
+  : uvm::uvm_sequencer<bench_rw>(name)
+  {}
+};
+
+class bench_driver : public uvm::uvm_driver<bench_rw>
+{
+ public:
+  UVM_COMPONENT_UTILS(bench_driver);
+
+  int count;
+
+  bench_driver( uvm::uvm_component_name name )
+  : uvm::uvm_driver<bench_rw>(name), count(0)
+  {}
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    bench_rw req;
+
+    while(true)
+    {
+      seq_item_port->get_next_item(req);
+      count++;
+      seq_item_port->item_done();
+    }
+  }
+};
+
+class bench_adapter : public uvm::uvm_reg_adapter
+{
+ public:
+  UVM_OBJECT_UTILS(bench_adapter);
+
+  bench_adapter( const std::string& name = "bench_adapter" )
+  : uvm::uvm_reg_adapter(name)
+  {}
+
+  virtual uvm::uvm_sequence_item* reg2bus( const uvm::uvm_reg_bus_op& rw )
+  {
+    bench_rw* bus = bench_rw::type_id::create("rw");
+    bus->read = (rw.kind == uvm::UVM_READ);
+    bus->addr = rw.addr.to_uint64();
+    bus->data = rw.data.to_uint64();
+    return bus;
+  }
+
+  virtual void bus2reg( const uvm::uvm_sequence_item* bus_item,
+                        uvm::uvm_reg_bus_op& rw )
+  {
+    const bench_rw* bus = dynamic_cast<const bench_rw*>(bus_item);
+
+    if (bus == NULL)
+    {
+      UVM_FATAL("NOT_REG_TYPE", "Provided bus_item is not of the correct type.");
+      return;
+    }
+
+    rw.kind   = bus->read ? uvm::UVM_READ : uvm::UVM_WRITE;
+    rw.addr   = bus->addr;
+    rw.data   = bus->data;
+    rw.status = uvm::UVM_IS_OK;
+  }
+};
+
+#endif /* BENCH_REGMODEL_H_ */
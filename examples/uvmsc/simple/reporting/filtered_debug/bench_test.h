@@ -0,0 +1,130 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BENCH_TEST_H_
+#define BENCH_TEST_H_
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <sstream>
+
+#include "bench_packet.h"
+#include "bench_regmodel.h"
+
+class bench_test : public uvm::uvm_component
+{
+ public:
+  UVM_COMPONENT_UTILS(bench_test);
+
+  bench_block* regmodel;
+  bench_sequencer* m_sequencer;
+  bench_driver* m_driver;
+
+  int n_packs;
+  int n_accesses;
+
+  bench_test( uvm::uvm_component_name name )
+  : uvm::uvm_component(name),
+    regmodel(NULL), m_sequencer(NULL), m_driver(NULL),
+    n_packs(20000), n_accesses(20000)
+  {}
+
+  void build_phase( uvm::uvm_phase& phase )
+  {
+    regmodel = bench_block::type_id::create("regmodel");
+    regmodel->build();
+    regmodel->lock_model();
+
+    m_sequencer = bench_sequencer::type_id::create("m_sequencer", this);
+    m_driver = bench_driver::type_id::create("m_driver", this);
+  }
+
+  void connect_phase( uvm::uvm_phase& phase )
+  {
+    m_driver->seq_item_port.bind(m_sequencer->seq_item_export);
+    regmodel->default_map->set_sequencer(m_sequencer, new bench_adapter("adapter"));
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    bench_pack();
+    bench_reg_access();
+
+    phase.drop_objection(this);
+  }
+
+  // pack and unpack a packet; every field is one filtered debug message
+  void bench_pack()
+  {
+    bench_packet pkt, rcv;
+    std::vector<unsigned char> bytes;
+    int n_fields = n_packs * 2 * (bench_packet::n_fields + 1);
+
+    std::clock_t start = std::clock();
+    for (int i = 0; i < n_packs; i++)
+    {
+      bytes.clear();
+      pkt.pack_bytes(bytes);
+      rcv.unpack_bytes(bytes);
+    }
+    double elapsed = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ostringstream str;
+    str << n_fields << " fields packed/unpacked in " << elapsed << " s CPU time";
+    if (elapsed > 0)
+      str << " (" << elapsed * 1e9 / n_fields << " ns/field)";
+    uvm_report_info("BENCH/PACK", str.str(), uvm::UVM_NONE);
+
+    if (rcv.tag != pkt.tag || rcv.field[bench_packet::n_fields-1] != pkt.field[bench_packet::n_fields-1])
+      uvm_report_error("BENCH/PACK", "Unpacked packet does not match");
+  }
+
+  // frontdoor register writes and reads; every bus beat is two filtered
+  // debug messages in the register map
+  void bench_reg_access()
+  {
+    uvm::uvm_status_e status;
+    uvm::uvm_reg_data_t data;
+    uvm::uvm_sequence_base* seq = new uvm::uvm_sequence_base("seq");
+
+    std::clock_t start = std::clock();
+    for (int i = 0; i < n_accesses / 2; i++)
+    {
+      regmodel->R->write(status, i, uvm::UVM_FRONTDOOR, NULL, seq);
+      regmodel->R->read(status, data, uvm::UVM_FRONTDOOR, NULL, seq);
+    }
+    double elapsed = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ostringstream str;
+    str << m_driver->count << " register accesses in " << elapsed << " s CPU time";
+    if (elapsed > 0)
+      str << " (" << elapsed * 1e6 / m_driver->count << " us/access)";
+    uvm_report_info("BENCH/REG", str.str(), uvm::UVM_NONE);
+
+    if (m_driver->count != (n_accesses / 2) * 2)
+      uvm_report_error("BENCH/REG", "Not all register accesses reached the driver");
+
+    delete seq;
+  }
+};
+
+#endif /* BENCH_TEST_H_ */
@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Cost of filtered debug messages in library hot paths.
+//
+// The uvm_packer reports every packed field at UVM_DEBUG, and the register
+// map reports every bus beat at UVM_FULL. At the default verbosity these
+// messages are filtered, so their text should not be formatted at all.
+// This example packs a packet and performs frontdoor register accesses at
+// default verbosity, and reports the CPU time per packed field and per
+// register access.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+
+#include "bench_test.h"
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("bench_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
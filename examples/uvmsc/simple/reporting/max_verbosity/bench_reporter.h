@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BENCH_REPORTER_H_
+#define BENCH_REPORTER_H_
+
+#include <systemc>
+#include <uvm>
+
+// Issues UVM_INFO messages above the default verbosity in a loop. The
+// same loop is compiled twice: without a verbosity ceiling in sc_main.cpp
+// and with UVM_MAX_VERBOSITY set to UVM_MEDIUM in capped_loop.cpp.
+class bench_reporter : public uvm::uvm_component
+{
+ public:
+  UVM_COMPONENT_UTILS(bench_reporter);
+
+  int n_messages;
+
+  bench_reporter( uvm::uvm_component_name name )
+  : uvm::uvm_component(name), n_messages(2000000)
+  {}
+
+  void run_phase( uvm::uvm_phase& phase );
+
+  // both return the number of loop iterations in which the message
+  // arguments were evaluated, which must be zero
+  int uncapped_loop( int n );
+  int capped_loop( int n );
+};
+
+#endif /* BENCH_REPORTER_H_ */
@@ -0,0 +1,49 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// The loop of sc_main.cpp, compiled with a verbosity ceiling of
+// UVM_MEDIUM. The ceiling must be defined before the UVM headers are
+// included.
+//----------------------------------------------------------------------
+
+#define UVM_MAX_VERBOSITY 200
+
+#include <systemc>
+#include <uvm>
+
+#include "bench_reporter.h"
+
+static int evaluated = 0;
+
+static const char* counted_id()
+{
+  evaluated++;
+  return "BENCH/LOOP";
+}
+
+int bench_reporter::capped_loop( int n )
+{
+  evaluated = 0;
+  for (int i = 0; i < n; i++)
+  {
+    UVM_INFO(counted_id(), "filtered message", uvm::UVM_HIGH);
+    UVM_INFO_STREAM(counted_id(), "value " << i, uvm::UVM_DEBUG);
+  }
+  return evaluated;
+}
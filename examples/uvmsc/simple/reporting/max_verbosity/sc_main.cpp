@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Cost of filtered messages with and without a compile-time verbosity
+// ceiling.
+//
+// The same loop of UVM_INFO and UVM_INFO_STREAM messages at UVM_HIGH and
+// UVM_DEBUG verbosity is run twice at the default verbosity (UVM_MEDIUM).
+// This file compiles it as usual, so each message still calls
+// uvm_report_enabled. capped_loop.cpp compiles it with UVM_MAX_VERBOSITY
+// set to UVM_MEDIUM, so the messages compile to nothing. The example
+// reports the CPU time per message for both.
+//
+// To remove the debug messages of the library itself, build the library
+// with the same definition, e.g. CXXFLAGS=-DUVM_MAX_VERBOSITY=200, and
+// compare the filtered_debug example before and after.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <sstream>
+
+#include "bench_reporter.h"
+
+static int evaluated = 0;
+
+static const char* counted_id()
+{
+  evaluated++;
+  return "BENCH/LOOP";
+}
+
+int bench_reporter::uncapped_loop( int n )
+{
+  evaluated = 0;
+  for (int i = 0; i < n; i++)
+  {
+    UVM_INFO(counted_id(), "filtered message", uvm::UVM_HIGH);
+    UVM_INFO_STREAM(counted_id(), "value " << i, uvm::UVM_DEBUG);
+  }
+  return evaluated;
+}
+
+void bench_reporter::run_phase( uvm::uvm_phase& phase )
+{
+  phase.raise_objection(this);
+
+  const char* name[2] = { "without ceiling", "with UVM_MAX_VERBOSITY=UVM_MEDIUM" };
+  double ns[2];
+  int n_evaluated[2];
+
+  for (int k = 0; k < 2; k++)
+  {
+    std::clock_t start = std::clock();
+    n_evaluated[k] = (k == 0) ? uncapped_loop(n_messages) : capped_loop(n_messages);
+    double elapsed = double(std::clock() - start) / CLOCKS_PER_SEC;
+    ns[k] = elapsed * 1e9 / (2.0 * n_messages);
+
+    std::ostringstream str;
+    str << 2 * n_messages << " filtered messages " << name[k] << ": "
+        << ns[k] << " ns/message";
+    uvm_report_info("BENCH", str.str(), uvm::UVM_NONE);
+  }
+
+  // without a ceiling, only the id is evaluated, for uvm_report_enabled
+  if (n_evaluated[0] != 2 * n_messages || n_evaluated[1] != 0)
+    uvm_report_error("BENCH", "Unexpected evaluation of message arguments");
+
+  phase.drop_objection(this);
+}
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("bench_reporter");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef BUS_TXN_H_
+#define BUS_TXN_H_
+
+#include <systemc>
+#include <uvm>
+#include <sstream>
+
+// Bus transaction, identified by its tag. The packed fields serve as the
+// content key of the out-of-order comparator.
+
+class bus_txn : public uvm::uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(bus_txn);
+
+  unsigned int tag;
+  unsigned int addr;
+  unsigned int data;
+
+  bus_txn( const std::string& name = "bus_txn" )
+  : uvm::uvm_object(name), tag(0), addr(0), data(0)
+  {}
+
+  virtual void do_pack( uvm::uvm_packer& packer ) const
+  {
+    packer << tag << addr << data;
+  }
+
+  virtual void do_unpack( uvm::uvm_packer& packer )
+  {
+    packer >> tag >> addr >> data;
+  }
+
+  bool do_compare( const uvm::uvm_object& rhs, const uvm::uvm_comparer* comparer ) const
+  {
+    const bus_txn* rhs_ = dynamic_cast<const bus_txn*>(&rhs);
+    if (rhs_ == NULL)
+      return false;
+
+    bool equal = comparer->compare_field_int("tag", tag, rhs_->tag, 32);
+    equal = comparer->compare_field_int("addr", addr, rhs_->addr, 32) && equal;
+    equal = comparer->compare_field_int("data", data, rhs_->data, 32) && equal;
+    return equal;
+  }
+
+  std::string convert2string() const
+  {
+    std::ostringstream str;
+    str << "tag " << tag << " addr 0x" << std::hex << addr << " data 0x" << data;
+    return str.str();
+  }
+};
+
+// key policy matching transactions on their tag
+class bus_txn_tag_key
+{
+ public:
+  static sc_dt::uint64 key( const bus_txn& t )
+  {
+    return t.tag;
+  }
+};
+
+#endif /* BUS_TXN_H_ */
@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Matching expected and actual transactions with the built-in
+// comparators.
+//
+// An in-order comparator checks a stream of integers, one of which is
+// corrupted. An out-of-order comparator keyed by tag checks transactions
+// which come back in reverse order, one with a wrong data field. An
+// out-of-order comparator keyed by a hash of the contents checks
+// transactions which come back with neighbours swapped and one missing;
+// its window of four outstanding transactions drops the missing one as a
+// mismatch. The example checks the statistics of each comparator.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+#include <sstream>
+
+#include "bus_txn.h"
+
+class comparators_test : public uvm::uvm_test
+{
+ public:
+  UVM_COMPONENT_UTILS(comparators_test);
+
+  uvm::uvm_in_order_built_in_comparator<int> in_order;
+  uvm::uvm_out_of_order_class_comparator<bus_txn, bus_txn_tag_key> by_tag;
+  uvm::uvm_out_of_order_class_comparator<bus_txn> by_content;
+
+  comparators_test( uvm::uvm_component_name name )
+  : uvm::uvm_test(name),
+    in_order("in_order"),
+    by_tag("by_tag"),
+    by_content("by_content")
+  {
+    by_tag.set_unique_keys();
+    by_content.set_max_outstanding(4);
+  }
+
+  static bus_txn make( unsigned int tag )
+  {
+    bus_txn t;
+    t.tag = tag;
+    t.addr = 0x1000 + 4 * tag;
+    t.data = 0xa5a50000 + tag;
+    return t;
+  }
+
+  void expect( const std::string& comp,
+               const uvm::uvm_comparator_stats& stats,
+               unsigned long matches,
+               unsigned long mismatches,
+               unsigned long max_outstanding )
+  {
+    if (stats.matches != matches || stats.mismatches != mismatches ||
+        stats.max_outstanding != max_outstanding)
+    {
+      std::ostringstream str;
+      str << "Unexpected statistics:\n" << stats.convert2string();
+      uvm_report_error(comp, str.str());
+    }
+  }
+
+  void run_in_order()
+  {
+    for (int i = 0; i < 8; i++)
+    {
+      in_order.before_export->write(i);
+      sc_core::wait(5, sc_core::SC_NS);
+      in_order.after_export->write(i == 5 ? 100 : i);
+    }
+
+    expect("in_order", in_order.get_statistics(), 7, 1, 1);
+
+    if (in_order.get_statistics().latency.get_mean() != sc_core::sc_time(5, sc_core::SC_NS))
+      uvm_report_error("in_order", "Unexpected latency");
+  }
+
+  void run_by_tag()
+  {
+    for (unsigned int i = 0; i < 8; i++)
+      by_tag.before_export->write(make(i));
+
+    for (int i = 7; i >= 0; i--)
+    {
+      sc_core::wait(10, sc_core::SC_NS);
+      bus_txn t = make(i);
+      if (i == 2)
+        t.data = 0;
+      by_tag.after_export->write(t);
+    }
+
+    expect("by_tag", by_tag.get_statistics(), 7, 1, 8);
+  }
+
+  void run_by_content()
+  {
+    // actual transactions come back with neighbours swapped: 1 0 3 2 ...
+    // and transaction 4 is lost
+    for (unsigned int i = 0; i < 10; i++)
+    {
+      by_content.before_export->write(make(i));
+      sc_core::wait(5, sc_core::SC_NS);
+      if (i >= 1 && ((i - 1) ^ 1) != 4)
+        by_content.after_export->write(make((i - 1) ^ 1));
+    }
+    by_content.after_export->write(make(8));
+
+    if (by_content.get_outstanding() != 1)
+      uvm_report_error("by_content", "Lost transaction is not outstanding");
+
+    // unrelated traffic pushes the lost transaction out of the window
+    for (unsigned int i = 100; i < 104; i++)
+      by_content.after_export->write(make(i));
+    for (unsigned int i = 100; i < 104; i++)
+      by_content.before_export->write(make(i));
+
+    expect("by_content", by_content.get_statistics(), 13, 1, 4);
+
+    if (by_content.get_outstanding() != 0)
+      uvm_report_error("by_content", "Transactions left outstanding");
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    run_in_order();
+    run_by_tag();
+    run_by_content();
+
+    phase.drop_objection(this);
+  }
+};
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("comparators_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Stress test for sequencer lock and grab handling.
+//
+// A number of branches run in parallel on one sequencer. Each branch nests
+// a sequence many levels deep before sending items, and two out of three
+// branches take a lock or grab around every burst of four items. This puts
+// the lock/grab checks on deep sequence hierarchies in the hot path of the
+// sequencer arbitration. The CPU time and item throughput are reported at
+// the end of the run.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+
+#include "stress_test.h"
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("stress_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,38 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef STRESS_ITEM_H_
+#define STRESS_ITEM_H_
+
+#include <systemc>
+#include <uvm>
+
+class stress_item : public uvm::uvm_sequence_item
+{
+ public:
+  UVM_OBJECT_UTILS(stress_item);
+
+  int branch;
+
+  stress_item( const std::string& name = "stress_item" )
+  : uvm::uvm_sequence_item(name), branch(0)
+  {}
+};
+
+#endif /* STRESS_ITEM_H_ */
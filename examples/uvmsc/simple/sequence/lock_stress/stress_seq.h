@@ -0,0 +1,126 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef STRESS_SEQ_H_
+#define STRESS_SEQ_H_
+
+#include <systemc>
+#include <uvm>
+#include <vector>
+
+#include "stress_item.h"
+
+// Sequence which nests itself 'depth' levels deep. The innermost sequence
+// sends 'n_items' items, taking a lock or grab around every burst of four
+// items, so that all other branches are blocked while it runs.
+
+class nested_seq : public uvm::uvm_sequence<stress_item>
+{
+ public:
+  UVM_OBJECT_UTILS(nested_seq);
+
+  enum { NO_LOCK, USE_LOCK, USE_GRAB };
+
+  int branch;
+  int depth;
+  int n_items;
+  int lock_mode;
+
+  nested_seq( const std::string& name = "nested_seq" )
+  : uvm::uvm_sequence<stress_item>(name),
+    branch(0), depth(0), n_items(0), lock_mode(NO_LOCK)
+  {}
+
+  void body()
+  {
+    if (depth > 0)
+    {
+      nested_seq* child = nested_seq::type_id::create("child");
+      child->branch = branch;
+      child->depth = depth - 1;
+      child->n_items = n_items;
+      child->lock_mode = lock_mode;
+      child->start(m_sequencer, this);
+      return;
+    }
+
+    stress_item* req = stress_item::type_id::create("req");
+    req->branch = branch;
+
+    for (int i = 0; i < n_items; i++)
+    {
+      bool burst_start = (i % 4 == 0);
+      bool burst_end = (i % 4 == 3) || (i == n_items - 1);
+
+      if (burst_start && lock_mode == USE_LOCK)
+        lock();
+      if (burst_start && lock_mode == USE_GRAB)
+        grab();
+
+      start_item(req);
+      finish_item(req);
+
+      if (burst_end && lock_mode == USE_LOCK)
+        unlock();
+      if (burst_end && lock_mode == USE_GRAB)
+        ungrab();
+    }
+  }
+};
+
+// Top-level sequence which runs all branches in parallel
+
+class stress_seq : public uvm::uvm_sequence<stress_item>
+{
+ public:
+  UVM_OBJECT_UTILS(stress_seq);
+
+  int n_branches;
+  int depth;
+  int n_items;
+
+  stress_seq( const std::string& name = "stress_seq" )
+  : uvm::uvm_sequence<stress_item>(name),
+    n_branches(0), depth(0), n_items(0)
+  {}
+
+  void run_branch( int branch )
+  {
+    nested_seq* seq = nested_seq::type_id::create("branch");
+    seq->branch = branch;
+    seq->depth = depth;
+    seq->n_items = n_items;
+    seq->lock_mode = branch % 3; // mix of plain, lock and grab branches
+    seq->start(m_sequencer, this);
+  }
+
+  void body()
+  {
+    std::vector<sc_core::sc_process_handle> branches;
+
+    for (int i = 0; i < n_branches; i++)
+      branches.push_back(sc_core::sc_spawn(sc_bind(&stress_seq::run_branch, this, i)));
+
+    for (unsigned int i = 0; i < branches.size(); i++)
+      if (!branches[i].terminated())
+        sc_core::wait(branches[i].terminated_event());
+  }
+};
+
+#endif /* STRESS_SEQ_H_ */
@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef STRESS_TEST_H_
+#define STRESS_TEST_H_
+
+#include <systemc>
+#include <uvm>
+#include <ctime>
+#include <sstream>
+
+#include "stress_item.h"
+#include "stress_seq.h"
+
+class stress_driver : public uvm::uvm_driver<stress_item>
+{
+ public:
+  UVM_COMPONENT_UTILS(stress_driver);
+
+  int count;
+
+  stress_driver( uvm::uvm_component_name name )
+  : uvm::uvm_driver<stress_item>(name), count(0)
+  {}
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    stress_item req;
+
+    while(true)
+    {
+      seq_item_port->get(req);
+      count++;
+      sc_core::wait(1, sc_core::SC_NS);
+    }
+  }
+};
+
+class stress_sequencer : public uvm::uvm_sequencer<stress_item>
+{
+ public:
+  UVM_COMPONENT_UTILS(stress_sequencer);
+
+  stress_sequencer( uvm::uvm_component_name name )
+  : uvm::uvm_sequencer<stress_item>(name)
+  {}
+};
+
+class stress_test : public uvm::uvm_component
+{
+ public:
+  UVM_COMPONENT_UTILS(stress_test);
+
+  stress_driver* m_driver;
+  stress_sequencer* m_sequencer;
+
+  stress_test( uvm::uvm_component_name name ) : uvm::uvm_component(name) {}
+
+  void build_phase( uvm::uvm_phase& phase )
+  {
+    m_driver = stress_driver::type_id::create("m_driver", this);
+    m_sequencer = stress_sequencer::type_id::create("m_sequencer", this);
+  }
+
+  void connect_phase( uvm::uvm_phase& phase )
+  {
+    m_driver->seq_item_port.bind(m_sequencer->seq_item_export);
+
+    // print grant and driver statistics at the end of the test
+    m_sequencer->enable_stats();
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    stress_seq* seq = stress_seq::type_id::create("seq");
+    seq->n_branches = 12;
+    seq->depth = 16;
+    seq->n_items = 400;
+
+    std::clock_t start = std::clock();
+    seq->start(m_sequencer);
+    double elapsed = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::ostringstream str;
+    str << m_driver->count << " items from " << seq->n_branches
+        << " branches at depth " << seq->depth << " in "
+        << elapsed << " s CPU time";
+    if (elapsed > 0)
+      str << " (" << m_driver->count / elapsed << " items/s)";
+    uvm_report_info("LOCKSTRESS", str.str(), uvm::UVM_NONE);
+
+    if (m_driver->count != seq->n_branches * seq->n_items)
+      uvm_report_error("LOCKSTRESS", "Not all items were received by the driver");
+
+    phase.drop_objection(this);
+  }
+};
+
+#endif /* STRESS_TEST_H_ */
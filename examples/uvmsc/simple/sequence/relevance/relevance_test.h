@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef RELEVANCE_TEST_H_
+#define RELEVANCE_TEST_H_
+
+#include <systemc>
+#include <uvm>
+#include <sstream>
+
+#include "throttled_seq.h"
+
+class relevance_driver : public uvm::uvm_driver<relevance_item>
+{
+ public:
+  UVM_COMPONENT_UTILS(relevance_driver);
+
+  int throttled_count;
+  int free_count;
+
+  relevance_driver( uvm::uvm_component_name name )
+  : uvm::uvm_driver<relevance_item>(name), throttled_count(0), free_count(0)
+  {}
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    relevance_item req;
+
+    while(true)
+    {
+      seq_item_port->get(req);
+      if (req.throttled)
+        throttled_count++;
+      else
+        free_count++;
+      sc_core::wait(1, sc_core::SC_NS);
+    }
+  }
+};
+
+class relevance_sequencer : public uvm::uvm_sequencer<relevance_item>
+{
+ public:
+  UVM_COMPONENT_UTILS(relevance_sequencer);
+
+  relevance_sequencer( uvm::uvm_component_name name )
+  : uvm::uvm_sequencer<relevance_item>(name)
+  {}
+};
+
+class relevance_test : public uvm::uvm_component
+{
+ public:
+  UVM_COMPONENT_UTILS(relevance_test);
+
+  relevance_driver* m_driver;
+  relevance_sequencer* m_sequencer;
+  credit_pool m_pool;
+
+  relevance_test( uvm::uvm_component_name name ) : uvm::uvm_component(name) {}
+
+  void build_phase( uvm::uvm_phase& phase )
+  {
+    m_driver = relevance_driver::type_id::create("m_driver", this);
+    m_sequencer = relevance_sequencer::type_id::create("m_sequencer", this);
+  }
+
+  void connect_phase( uvm::uvm_phase& phase )
+  {
+    m_driver->seq_item_port.bind(m_sequencer->seq_item_export);
+  }
+
+  void refill()
+  {
+    while(true)
+    {
+      sc_core::wait(10, sc_core::SC_NS);
+      m_pool.add();
+    }
+  }
+
+  void start_sequence( uvm::uvm_sequence_base* seq )
+  {
+    seq->start(m_sequencer);
+  }
+
+  void run_phase( uvm::uvm_phase& phase )
+  {
+    phase.raise_objection(this);
+
+    sc_core::sc_spawn(sc_bind(&relevance_test::refill, this));
+
+    throttled_seq* t_seq = throttled_seq::type_id::create("t_seq");
+    t_seq->pool = &m_pool;
+    t_seq->n_items = 10;
+
+    free_seq* f_seq = free_seq::type_id::create("f_seq");
+    f_seq->n_items = 5;
+
+    SC_FORK
+      sc_core::sc_spawn(sc_bind(&relevance_test::start_sequence, this, t_seq)),
+      sc_core::sc_spawn(sc_bind(&relevance_test::start_sequence, this, f_seq))
+    SC_JOIN
+
+    std::ostringstream str;
+    str << "Driver received " << m_driver->throttled_count
+        << " throttled and " << m_driver->free_count
+        << " free items by " << sc_core::sc_time_stamp();
+    uvm_report_info("RELEVANCE", str.str(), uvm::UVM_NONE);
+
+    if (m_driver->throttled_count != t_seq->n_items ||
+        m_driver->free_count != f_seq->n_items)
+      uvm_report_error("RELEVANCE", "Not all items were received by the driver");
+
+    phase.drop_objection(this);
+  }
+};
+
+#endif /* RELEVANCE_TEST_H_ */
@@ -0,0 +1,43 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// Example of sequences which are not always relevant.
+//
+// A throttled sequence may only send an item when a credit is available,
+// and credits are handed out every 10 ns. While it has no credit, the
+// throttled sequence is not relevant and the sequencer waits for its
+// wait_for_relevant() to return. A second sequence, which is always
+// relevant, runs in parallel on the same sequencer.
+//----------------------------------------------------------------------
+
+#include <systemc>
+#include <uvm>
+
+#include "relevance_test.h"
+
+int sc_main(int, char*[])
+{
+  uvm::run_test("relevance_test");
+
+  uvm::uvm_report_server* svr = uvm::uvm_report_server::get_server();
+  int errors = svr->get_severity_count(uvm::UVM_ERROR) +
+               svr->get_severity_count(uvm::UVM_FATAL);
+
+  return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef THROTTLED_SEQ_H_
+#define THROTTLED_SEQ_H_
+
+#include <systemc>
+#include <uvm>
+
+// Credits which are handed out periodically by the test. A throttled
+// sequence needs one credit per item.
+
+class credit_pool
+{
+ public:
+  credit_pool() : credits(0) {}
+
+  void add()
+  {
+    credits++;
+    credit_added.notify();
+  }
+
+  int credits;
+  sc_core::sc_event credit_added;
+};
+
+class relevance_item : public uvm::uvm_sequence_item
+{
+ public:
+  UVM_OBJECT_UTILS(relevance_item);
+
+  bool throttled;
+
+  relevance_item( const std::string& name = "relevance_item" )
+  : uvm::uvm_sequence_item(name), throttled(false)
+  {}
+};
+
+// Sequence which is only relevant while there are credits available
+
+class throttled_seq : public uvm::uvm_sequence<relevance_item>
+{
+ public:
+  UVM_OBJECT_UTILS(throttled_seq);
+
+  credit_pool* pool;
+  int n_items;
+
+  throttled_seq( const std::string& name = "throttled_seq" )
+  : uvm::uvm_sequence<relevance_item>(name), pool(NULL), n_items(0)
+  {}
+
+  bool is_relevant() const
+  {
+    return pool->credits > 0;
+  }
+
+  void wait_for_relevant() const
+  {
+    while (pool->credits == 0)
+      sc_core::wait(pool->credit_added);
+  }
+
+  void body()
+  {
+    relevance_item* req = relevance_item::type_id::create("req");
+    req->throttled = true;
+
+    for (int i = 0; i < n_items; i++)
+    {
+      start_item(req);
+      pool->credits--;
+      finish_item(req);
+    }
+  }
+};
+
+// Sequence which is always relevant
+
+class free_seq : public uvm::uvm_sequence<relevance_item>
+{
+ public:
+  UVM_OBJECT_UTILS(free_seq);
+
+  int n_items;
+
+  free_seq( const std::string& name = "free_seq" )
+  : uvm::uvm_sequence<relevance_item>(name), n_items(0)
+  {}
+
+  void body()
+  {
+    relevance_item* req = relevance_item::type_id::create("req");
+
+    for (int i = 0; i < n_items; i++)
+    {
+      start_item(req);
+      finish_item(req);
+    }
+  }
+};
+
+#endif /* THROTTLED_SEQ_H_ */
@@ -30,6 +30,8 @@
 #include "uvmsc/base/uvm_object.h"
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/base/uvm_transaction.h"
+#include "uvmsc/base/uvm_tr_database.h"
+#include "uvmsc/base/uvm_tr_database_reader.h"
 #include "uvmsc/base/uvm_port_base.h"
 #include "uvmsc/base/uvm_export_base.h"
 #include "uvmsc/base/uvm_event.h"
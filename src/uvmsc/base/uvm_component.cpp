@@ -86,9 +86,9 @@ uvm_component::uvm_component( uvm_component_name nm )
 
     if ( uvm_parent == NULL)
     {
-      std::ostringstream str;
-      str << "The parent of UVM component '" << nm << "' is not a UVM component. uvm_top is used instead.";
-      uvm_report_info("NOPARENT", str.str(), UVM_HIGH);
+      UVM_INFO_STREAM("NOPARENT",
+          "The parent of UVM component '" << nm << "' is not a UVM component. uvm_top is used instead.",
+          UVM_HIGH);
 
       uvm_coreservice_t* cs = uvm_coreservice_t::get();
       uvm_root* root = cs->get_root();
@@ -1439,6 +1439,25 @@ uvm_component::~uvm_component()
 }
 
 
+//----------------------------------------------------------------------------
+// member function: get_random_stream
+//
+// Implementation defined
+//
+//! Returns the random stream of this component. The stream is seeded on
+//! first use from the full hierarchical name of the component and the
+//! global seed (see uvm_random_stream::set_global_seed), so the numbers
+//! drawn by a component do not depend on other components.
+//----------------------------------------------------------------------------
+
+uvm_random_stream& uvm_component::get_random_stream()
+{
+  if (!m_random_stream.is_seeded())
+    m_random_stream.reseed(get_full_name());
+
+  return m_random_stream;
+}
+
 //----------------------------------------------------------------------------
 // member function: print_config_settings - DEPRECATED
 //
@@ -30,6 +30,7 @@
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "uvmsc/report/uvm_report_object.h"
+#include "uvmsc/misc/uvm_random_stream.h"
 
 
 //////////////
@@ -331,6 +332,8 @@ class uvm_component : public sc_core::sc_module,
   // avoid ambiguity with sc_object::print
   using uvm_report_object::print;
 
+  uvm_random_stream& get_random_stream();
+
  private:
 
   void print_config_settings( const std::string& field = "",
@@ -375,6 +378,8 @@ class uvm_component : public sc_core::sc_module,
   bool m_add_child(uvm_component* child, const std::string& name = "");
 
   unsigned int recording_detail;
+
+  uvm_random_stream m_random_stream;
   //-------------
   // data members
   //-------------
@@ -18,6 +18,8 @@
 //   permissions and limitations under the License.
 //----------------------------------------------------------------------
 
+#include <cstdlib>  // getenv
+
 #include "uvmsc/base/uvm_root.h"
 #include "uvmsc/base/uvm_component.h"
 #include "uvmsc/factory/uvm_factory.h"
@@ -25,6 +27,9 @@
 #include "uvmsc/base/uvm_default_coreservice_t.h"
 #include "uvmsc/report/uvm_report_server.h"
 #include "uvmsc/report/uvm_default_report_server.h"
+#include "uvmsc/report/uvm_binary_report_server.h"
+#include "uvmsc/base/uvm_globals.h"
+#include "uvmsc/base/uvm_tr_database.h"
 
 namespace uvm {
 
@@ -64,26 +69,20 @@ void uvm_default_coreservice_t::set_factory( uvm_factory* f )
 // returns the current default record database
 //
 // If no default record database has been set before this method
-// is called, returns an instance of <uvm_text_tr_database>
+// is called, returns an instance of <uvm_tr_database> writing to
+// tr_db.bin, or to the file named by the environment variable
+// UVM_SYSTEMC_TR_DATABASE
 //----------------------------------------------------------------------------
 
-/* TODO TR database
 uvm_tr_database* uvm_default_coreservice_t::get_default_tr_database() const
 {
   if (tr_database == NULL)
   {
-    //   process p = process::self();
-    uvm_text_tr_database* tx_db;
-    std::string s;
-
-    //if(p != NULL)
-    //  s = p.get_randstate();
+    tr_database = new uvm_tr_database("default_tr_database");
 
-    tx_db = new uvm_tr_database("default_tr_database");
-    tr_database = tx_db;
-
-    //if(p != null)
-    //  p.set_randstate(s);
+    const char* filename = std::getenv("UVM_SYSTEMC_TR_DATABASE");
+    if (filename != NULL && *filename != '\0')
+      tr_database->set_file_name(filename);
   }
   return tr_database;
 }
@@ -98,22 +97,42 @@ void uvm_default_coreservice_t::set_default_tr_database( uvm_tr_database* db )
 {
   tr_database = db;
 }
-*/
 
 //----------------------------------------------------------------------------
 // member function: get_report_server (virtual)
 //
 // returns the current global report_server
 // if no report server has been set before, returns an instance of
-// uvm_default_report_server
+// uvm_default_report_server, or of uvm_binary_report_server when the
+// environment variable UVM_SYSTEMC_REPORT_BINARY names a log file
 //----------------------------------------------------------------------------
 
 uvm_report_server* uvm_default_coreservice_t::get_report_server() const
 {
   if(report_server == NULL)
   {
-    uvm_default_report_server* f = new uvm_default_report_server();
-    report_server = f;
+    const char* binary_log = std::getenv("UVM_SYSTEMC_REPORT_BINARY");
+
+    if (binary_log != NULL && *binary_log != '\0')
+    {
+      uvm_binary_report_server* b = new uvm_binary_report_server(binary_log);
+
+      if (b->is_open())
+      {
+        report_server = b;
+        return report_server;
+      }
+
+      delete b;
+      report_server = new uvm_default_report_server();
+      uvm_report_error("BINLOG", "Cannot open binary report log '" +
+        std::string(binary_log) + "' for writing, reporting as text.");
+    }
+    else
+    {
+      uvm_default_report_server* f = new uvm_default_report_server();
+      report_server = f;
+    }
   }
   return report_server;
 }
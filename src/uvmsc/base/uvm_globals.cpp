@@ -514,12 +514,12 @@ int uvm_re_match_char(const char *re, const char *str)
 
   err = regexec(rexp, str, 0, NULL, 0);
 
-  std::ostringstream info;
-  info << "re = " << rex
-       << " str = " << str
-       << " ERR = " << err
-       << " |" << re << "|";
-  UVM_INFO("REGEX", info.str(), UVM_DEBUG);
+  UVM_INFO_STREAM("REGEX",
+      "re = " << rex
+      << " str = " << str
+      << " ERR = " << err
+      << " |" << re << "|",
+      UVM_DEBUG);
 
   regfree(rexp);
 
@@ -34,6 +34,8 @@
 #include "uvmsc/print/uvm_table_printer.h"
 #include "uvmsc/print/uvm_tree_printer.h"
 #include "uvmsc/print/uvm_printer_globals.h"
+#include "uvmsc/policy/uvm_comparer.h"
+#include "uvmsc/policy/uvm_hasher.h"
 #include "uvmsc/policy/uvm_packer.h"
 #include "uvmsc/policy/uvm_recorder.h"
 #include "uvmsc/report/uvm_report_object.h"
@@ -285,8 +287,7 @@ void uvm_object::print( uvm_printer* printer ) const
     uvm_report_error("NULLPRINTER","uvm_default_printer is NULL");
 
   //$fwrite(printer.knobs.mcd,); // TODO printer knobs?
-  std::string s = sprint(printer);
-  std::cout << s;
+  sprint(std::cout, printer);
 }
 
 //----------------------------------------------------------------------------
@@ -319,6 +320,39 @@ std::string uvm_object::sprint( uvm_printer* printer ) const
   return printer->emit();
 }
 
+//----------------------------------------------------------------------------
+// member function: sprint
+//
+//! Same as <sprint>, except the output is written to \p os as it is
+//! formatted, rather than returned in a string. Use this member function
+//! to print large objects to a file.
+//----------------------------------------------------------------------------
+
+void uvm_object::sprint( std::ostream& os, uvm_printer* printer ) const
+{
+  if( printer == NULL )
+    printer = uvm_default_printer;
+
+  // not at top-level, must be recursing into sub-object
+  if(!printer->istop())
+  {
+    __m_uvm_status_container->printer = printer;
+    do_print( *printer );
+    return;
+  }
+
+  printer->print_object(get_name(), *this);
+  // backward compat with sprint knob: if used,
+  //    print that, do not call emit()
+  if (!printer->m_string.empty())
+  {
+    os << printer->m_string;
+    return;
+  }
+
+  printer->emit(os);
+}
+
 //----------------------------------------------------------------------------
 // member function: do_print (virtual)
 //
@@ -464,7 +498,13 @@ void uvm_object::do_copy( const uvm_object& rhs )
 bool uvm_object::compare( const uvm_object& rhs,
                           const uvm_comparer* comparer ) const
 {
-  return do_compare(rhs, (comparer==NULL)?::uvm::uvm_default_comparer:comparer);
+  const uvm_comparer* l_comparer = (comparer==NULL)?::uvm::uvm_default_comparer:comparer;
+
+  l_comparer->m_begin_compare(*this, rhs);
+  bool equal = do_compare(rhs, l_comparer);
+  l_comparer->m_end_compare(*this, rhs);
+
+  return equal;
 }
 
 
@@ -484,6 +524,58 @@ bool uvm_object::do_compare( const uvm_object& rhs,
   return true;
 }
 
+//----------------------------------------------------------------------------
+// Group: Hashing
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// member function: hash
+//
+//! Returns a 64-bit hash of the contents of this object, computed with the
+//! \p hasher policy, or with the default hasher if \p hasher is NULL.
+//! Objects which compare equal have equal hashes, so the hash can be used
+//! to bucket objects by content, as long as #do_hash covers only fields
+//! which #do_compare compares. See #do_hash.
+//!
+//! The hash method is not virtual and should not be overloaded in derived
+//! classes. To hash the fields of a derived class, that class should
+//! override the #do_hash method.
+//----------------------------------------------------------------------------
+
+sc_dt::uint64 uvm_object::hash( uvm_hasher* hasher ) const
+{
+  uvm_hasher* l_hasher = (hasher==NULL)?::uvm::uvm_default_hasher:hasher;
+
+  l_hasher->m_begin_hash(*this);
+  do_hash(*l_hasher);
+  l_hasher->m_end_hash(*this);
+
+  return l_hasher->get_hash();
+}
+
+//----------------------------------------------------------------------------
+// member function: do_hash (virtual)
+//
+//! The do_hash method is the user-definable hook called by the #hash method.
+//! The default implementation hashes the stream packed by #do_pack, so
+//! #do_pack and #do_compare must cover exactly the same fields:
+//! - A packed field which is not compared, such as an id or a time stamp,
+//!   gives objects which compare equal different hashes, so they are
+//!   never matched by hash.
+//! - A compared field which is not packed only makes the hash weaker.
+//! - A class which does not implement #do_pack gives all its objects the
+//!   same hash; a comparator keyed on the hash then falls back to
+//!   comparing against every outstanding object.
+//!
+//! A derived class may override this method to add the fields it compares
+//! to the hasher directly, which avoids packing the object.
+//----------------------------------------------------------------------------
+
+void uvm_object::do_hash( uvm_hasher& hasher ) const
+{
+  hasher.m_hash_packed(*this);
+}
+
 //----------------------------------------------------------------------------
 // Group: Packing
 //----------------------------------------------------------------------------
@@ -540,6 +632,23 @@ int uvm_object::pack_bytes( std::vector<unsigned char>& bytestream, uvm_packer*
   return packer->get_packed_size();
 }
 
+//----------------------------------------------------------------------------
+// member function: pack_bytes
+//
+//! Packs this object into the caller-owned array \p bytestream of \p size
+//! bytes, in the same format as packing into a vector, and returns the
+//! number of packed bits. Nothing is written if the array is too small, or
+//! if \p bytestream is NULL. A call with a NULL array can therefore be used
+//! to query the required size, (bits + 7) / 8 bytes.
+//----------------------------------------------------------------------------
+
+int uvm_object::pack_bytes( unsigned char* bytestream, unsigned int size, uvm_packer* packer )
+{
+  m_pack(packer);
+  packer->get_bytes(bytestream, size);
+  return packer->get_packed_size();
+}
+
 //----------------------------------------------------------------------------
 // member function: pack_ints
 //
@@ -666,6 +775,23 @@ int uvm_object::unpack_bytes( const std::vector<unsigned char>& bytestream, uvm_
   packer->set_packed_size();
   return packer->get_packed_size();}
 
+//----------------------------------------------------------------------------
+// member function: unpack_bytes
+//
+//! Same as unpacking from a vector, but reads the caller-owned array
+//! \p bytestream of \p size bytes in place, without copying it.
+//----------------------------------------------------------------------------
+
+int uvm_object::unpack_bytes( const unsigned char* bytestream, unsigned int size, uvm_packer* packer )
+{
+  m_unpack_pre(packer);
+  packer->put_bytes(bytestream, size);
+  m_unpack_post(packer);
+  packer->m_detach_bytes();
+  packer->set_packed_size();
+  return packer->get_packed_size();
+}
+
 //----------------------------------------------------------------------------
 // member function: unpack_ints
 //
@@ -763,7 +889,7 @@ void uvm_object::set_object_local( const std::string& field_name,
 std::ostream& operator<<( std::ostream& os, const uvm_object& obj ) {
   uvm_object* mobj = const_cast<uvm_object*>(&obj);
   uvm_printer* prt = uvm_default_tree_printer;
-  os << mobj->sprint(prt);
+  mobj->sprint(os, prt);
   return os;
 }
 
@@ -771,7 +897,7 @@ std::ostream& operator<<( std::ostream& os, const uvm_object* obj )
 {
   uvm_object* mobj = const_cast<uvm_object*>(obj);
   uvm_printer* prt = uvm_default_tree_printer;
-  os << mobj->sprint(prt);
+  mobj->sprint(os, prt);
   return os;
 }
 
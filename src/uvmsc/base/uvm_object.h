@@ -45,12 +45,14 @@ class uvm_status_container;
 class uvm_object_wrapper;
 class uvm_recorder;
 class uvm_comparer;
+class uvm_hasher;
 
 // instance count
 extern int g_inst_count;
 
 extern uvm_packer* uvm_default_packer;
 extern uvm_comparer* uvm_default_comparer;
+extern uvm_hasher* uvm_default_hasher;
 
 
 // TODO typesdefs for intstream, bytestream, etc.
@@ -128,6 +130,8 @@ public:
 
   std::string sprint( uvm_printer* printer = NULL ) const;
 
+  void sprint( std::ostream& os, uvm_printer* printer = NULL ) const;
+
   virtual void do_print( const uvm_printer& printer ) const;
 
   virtual std::string convert2string() const;
@@ -157,6 +161,14 @@ public:
   virtual bool do_compare( const uvm_object& rhs,
                            const uvm_comparer* comparer = NULL ) const;
 
+  //--------------------------------------------------------------------------
+  // Group: Hashing
+  //--------------------------------------------------------------------------
+
+  sc_dt::uint64 hash( uvm_hasher* hasher = NULL ) const;
+
+  virtual void do_hash( uvm_hasher& hasher ) const;
+
   //--------------------------------------------------------------------------
   // Group: Packing
   //--------------------------------------------------------------------------
@@ -165,6 +177,8 @@ public:
 
   int pack_bytes( std::vector<unsigned char>& bytestream, uvm_packer* packer = NULL );
 
+  int pack_bytes( unsigned char* bytestream, unsigned int size, uvm_packer* packer = NULL );
+
   int pack_ints( std::vector<unsigned int>& intstream, uvm_packer* packer = NULL );
 
   virtual void do_pack( uvm_packer& packer ) const;
@@ -177,6 +191,8 @@ public:
 
   int unpack_bytes( const std::vector<unsigned char>& bytestream, uvm_packer* packer = NULL );
 
+  int unpack_bytes( const unsigned char* bytestream, unsigned int size, uvm_packer* packer = NULL );
+
   int unpack_ints( const std::vector<unsigned int>& intstream, uvm_packer* packer = NULL );
 
   virtual void do_unpack( uvm_packer& packer );
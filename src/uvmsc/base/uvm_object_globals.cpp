@@ -22,6 +22,7 @@
 
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/policy/uvm_comparer.h"
+#include "uvmsc/policy/uvm_hasher.h"
 
 namespace uvm {
 
@@ -105,4 +106,6 @@ const char* uvm_verbosity_name[] =
 
 uvm_comparer* uvm_default_comparer = uvm_comparer::init(); // uvm_comparer::init();
 
+uvm_hasher* uvm_default_hasher = uvm_hasher::init();
+
 } /* namespace uvm */
@@ -35,6 +35,7 @@ class uvm_table_printer;
 class uvm_line_printer;
 class uvm_tree_printer;
 class uvm_comparer;
+class uvm_hasher;
 
 //----------------------------------------------------------------------
 // Macro: UVM_DEFAULT_TIMEOUT
@@ -538,6 +539,15 @@ typedef const std::string& uvm_object_name;
 
 extern uvm_comparer* uvm_default_comparer; // uvm_comparer::init();
 
+//----------------------------------------------------------------------
+// Variable: uvm_default_hasher
+//
+// The default hash policy. Used when calls to <uvm_object::hash>
+// do not specify a hasher policy.
+//----------------------------------------------------------------------
+
+extern uvm_hasher* uvm_default_hasher; // uvm_hasher::init();
+
 
 } /* namespace uvm */
 
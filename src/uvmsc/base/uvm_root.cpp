@@ -32,6 +32,7 @@
 #include "uvmsc/base/uvm_globals.h"
 #include "uvmsc/base/uvm_coreservice_t.h"
 #include "uvmsc/base/uvm_default_coreservice_t.h"
+#include "uvmsc/base/uvm_tr_database.h"
 #include "uvmsc/macros/uvm_message_defines.h"
 #include "uvmsc/phasing/uvm_phase.h"
 #include "uvmsc/phasing/uvm_common_phases.h"
@@ -166,8 +167,8 @@ void uvm_root::run_test( const std::string& test_name )
 //!
 //! Calls the member function uvm_component::pre_abort()
 //! on the entire #uvm_component hierarchy in a bottom-up fashion.
-//! It then call calls #report_summarize and terminates the simulation
-//! with sc_stop().
+//! It then writes the buffered records of all transaction databases,
+//! calls #report_summarize and terminates the simulation with sc_stop().
 //----------------------------------------------------------------------
 
 void uvm_root::die()
@@ -176,6 +177,9 @@ void uvm_root::die()
   // do the pre_abort callbacks
   m_do_pre_abort();
 
+  // write the recorded transactions before the simulation is terminated
+  uvm_tr_database::m_flush_all();
+
   l_rs->report_summarize();
   throw std::runtime_error("Simulation terminated by uvm_root::die()");
 }
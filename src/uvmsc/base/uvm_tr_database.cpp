@@ -0,0 +1,1119 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+#include <ostream>
+
+#if !defined(_MSC_VER)
+#include "config.h"
+#endif
+
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+#include "uvmsc/base/uvm_tr_database.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Class implementation: uvm_tr_db_write_statistics
+//----------------------------------------------------------------------------
+
+uvm_tr_db_write_statistics::uvm_tr_db_write_statistics()
+: bytes(0),
+  buffers(0),
+  stalls(0),
+  stall_time(0.0),
+  max_pending(0),
+  background(false)
+{}
+
+//----------------------------------------------------------------------------
+// Class implementation: uvm_tr_stream
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+uvm_tr_stream::uvm_tr_stream( const std::string& name )
+: uvm_object(name),
+  m_db(NULL),
+  m_handle(0)
+{}
+
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+uvm_tr_stream::~uvm_tr_stream()
+{}
+
+//----------------------------------------------------------------------------
+// member function: get_db
+//
+//! Returns the database which owns this stream.
+//----------------------------------------------------------------------------
+
+uvm_tr_database* uvm_tr_stream::get_db() const
+{
+  return m_db;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_scope
+//
+//! Returns the scope given to uvm_tr_database::open_stream.
+//----------------------------------------------------------------------------
+
+std::string uvm_tr_stream::get_scope() const
+{
+  return m_scope;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_stream_type_name
+//
+//! Returns the type given to uvm_tr_database::open_stream.
+//----------------------------------------------------------------------------
+
+std::string uvm_tr_stream::get_stream_type_name() const
+{
+  return m_type_name;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_handle
+//
+//! Returns the handle of the stream in the database file.
+//----------------------------------------------------------------------------
+
+int uvm_tr_stream::get_handle() const
+{
+  return m_handle;
+}
+
+//----------------------------------------------------------------------------
+// member function: begin_tr
+//
+//! Begins a transaction called \p name on this stream, and returns its
+//! handle. See uvm_tr_database::begin_tr.
+//----------------------------------------------------------------------------
+
+int uvm_tr_stream::begin_tr( const std::string& name,
+                             const sc_core::sc_time& begin_time )
+{
+  if (m_db == NULL)
+    return 0;
+  return m_db->begin_tr(this, name, begin_time);
+}
+
+//----------------------------------------------------------------------------
+// Class implementation: uvm_tr_database
+//----------------------------------------------------------------------------
+
+struct uvm_tr_database::m_thread_state
+{
+#if defined(HAVE_PTHREAD)
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t work;    // a buffer was queued, or the writer must stop
+  pthread_cond_t drained; // the writer finished writing a batch
+#endif
+  bool running;
+};
+
+namespace {
+
+class m_tr_db_lock
+{
+ public:
+#if defined(HAVE_PTHREAD)
+  explicit m_tr_db_lock( pthread_mutex_t& mutex ) : m_mutex(mutex)
+  {
+    pthread_mutex_lock(&m_mutex);
+  }
+
+  ~m_tr_db_lock()
+  {
+    pthread_mutex_unlock(&m_mutex);
+  }
+
+ private:
+  pthread_mutex_t& m_mutex;
+#endif
+};
+
+double m_tr_db_now()
+{
+#if defined(HAVE_PTHREAD)
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+  return double(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+} // anonymous namespace
+
+#if defined(HAVE_PTHREAD)
+#define UVM_TR_DB_LOCK m_tr_db_lock l_lock(m_thread->mutex)
+#else
+#define UVM_TR_DB_LOCK
+#endif
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+uvm_tr_database::uvm_tr_database( const std::string& name )
+: uvm_object(name),
+  m_filename("tr_db.bin"),
+  m_file(NULL),
+  m_active(NULL),
+  m_full(),
+  m_free(),
+  m_buffer_size(1 << 20),
+  m_num_buffers(2),
+  m_num_allocated(0),
+  m_writing(false),
+  m_stop(false),
+  m_write_error(false),
+  m_thread(new m_thread_state),
+  m_stats(),
+  m_written_filename(),
+  m_num_written_streams(0),
+  m_last_handle(0),
+  m_last_time(0)
+{
+  m_thread->running = false;
+
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_init(&m_thread->mutex, NULL);
+  pthread_cond_init(&m_thread->work, NULL);
+  pthread_cond_init(&m_thread->drained, NULL);
+#endif
+
+  m_active = m_get_free_buffer();
+
+  static bool at_exit_registered = false;
+  std::vector<uvm_tr_database*>& dbs = m_live_databases();
+  if (!at_exit_registered)
+  {
+    std::atexit(&m_close_all_at_exit);
+    at_exit_registered = true;
+  }
+  dbs.push_back(this);
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+//
+//! Closes the database and deletes its streams.
+//----------------------------------------------------------------------------
+
+uvm_tr_database::~uvm_tr_database()
+{
+  close_db();
+
+#if defined(HAVE_PTHREAD)
+  pthread_cond_destroy(&m_thread->drained);
+  pthread_cond_destroy(&m_thread->work);
+  pthread_mutex_destroy(&m_thread->mutex);
+#endif
+
+  delete m_thread;
+
+  delete m_active;
+  for (std::size_t i = 0; i < m_free.size(); i++)
+    delete m_free[i];
+
+  for (unsigned int i = 0; i < m_streams.size(); i++)
+    delete m_streams[i];
+
+  std::vector<uvm_tr_database*>& dbs = m_live_databases();
+  dbs.erase(std::remove(dbs.begin(), dbs.end(), this), dbs.end());
+}
+
+//----------------------------------------------------------------------------
+// member function: open_db
+//
+//! Opens the database file for writing, and writes the streams opened
+//! so far. A file which this database wrote before, and closed with
+//! #close_db, is continued rather than rewritten, so that the records
+//! written before remain valid. Returns true when the database is open.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database::open_db()
+{
+  if (m_file != NULL)
+    return true;
+
+  bool append = (m_filename == m_written_filename);
+
+  m_file = std::fopen(m_filename.c_str(), append ? "ab" : "wb");
+
+  if (m_file == NULL)
+  {
+    uvm_report_warning("TRDB/OPEN", "Cannot open transaction database '" +
+      m_filename + "' for writing; transactions are not recorded");
+    return false;
+  }
+
+  m_active->clear();
+  m_write_error = false;
+  m_stats = uvm_tr_db_write_statistics();
+
+  m_start_writer();
+
+  if (!append)
+    m_write_header();
+
+  for (unsigned int i = m_num_written_streams; i < m_streams.size(); i++)
+    m_write_stream(m_streams[i]);
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_write_header
+//
+//! Implementation-defined member function
+//! Starts a new file: writes the header, and forgets the string handles
+//! and streams written to the previous file.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_write_header()
+{
+  // the time resolution is fixed once the first time object exists
+  double res_fs = sc_core::sc_get_time_resolution().to_seconds() * 1e15;
+  unsigned int exponent = 0;
+  while (res_fs > 5.0)
+  {
+    res_fs /= 10.0;
+    exponent++;
+  }
+
+  m_active->insert(m_active->end(), UVM_TR_DB_MAGIC, UVM_TR_DB_MAGIC + 8);
+  m_put_uint(UVM_TR_DB_VERSION);
+  m_put_uint(exponent);
+  m_write_record();
+
+  m_string_handles.clear();
+  m_num_written_streams = 0;
+  m_last_time = 0;
+  m_written_filename = m_filename;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_write_stream
+//
+//! Implementation-defined member function
+//! Writes the record which declares \p stream.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_write_stream( uvm_tr_stream* stream )
+{
+  unsigned int name = m_intern(stream->get_name());
+  unsigned int scope = m_intern(stream->m_scope);
+  unsigned int type_name = m_intern(stream->m_type_name);
+
+  m_put_u8(UVM_TR_DB_STREAM);
+  m_put_uint(stream->m_handle);
+  m_put_uint(name);
+  m_put_uint(scope);
+  m_put_uint(type_name);
+  m_write_record();
+
+  m_num_written_streams++;
+}
+
+//----------------------------------------------------------------------------
+// member function: close_db
+//
+//! Flushes and closes the database file. The streams remain valid; when
+//! the database is opened again, the file is continued, unless another
+//! file name was set in the meantime.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database::close_db()
+{
+  if (m_file == NULL)
+    return false;
+
+  flush();
+  m_stop_writer();
+
+  std::fclose(m_file);
+  m_file = NULL;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// member function: is_open
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database::is_open() const
+{
+  return m_file != NULL;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_file_name
+//
+//! Sets the name of the database file. Takes effect when the database is
+//! opened next.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::set_file_name( const std::string& filename )
+{
+  m_filename = filename;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_file_name
+//----------------------------------------------------------------------------
+
+std::string uvm_tr_database::get_file_name() const
+{
+  return m_filename;
+}
+
+//----------------------------------------------------------------------------
+// member function: flush
+//
+//! Writes the buffered records to the file, and returns when they have
+//! been written.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::flush()
+{
+  if (m_file == NULL)
+    return;
+
+  bool error = false;
+  {
+    UVM_TR_DB_LOCK;
+
+    m_queue_active_buffer();
+
+#if defined(HAVE_PTHREAD)
+    if (m_thread->running)
+    {
+      while (!m_full.empty() || m_writing)
+        pthread_cond_wait(&m_thread->drained, &m_thread->mutex);
+    }
+#endif
+
+    std::fflush(m_file);
+
+    // report a write error only once
+    error = m_write_error;
+    m_write_error = false;
+  }
+
+  if (error)
+    uvm_report_warning("TRDB/WRITE", "Cannot write to transaction database '" +
+      m_filename + "'; recorded transactions are lost");
+}
+
+//----------------------------------------------------------------------------
+// member function: set_buffer_size
+//
+//! Sets the size in bytes at which a buffer of records is handed to the
+//! writer, and the number of buffers. With the default of two buffers,
+//! the simulation fills one buffer while the other one is written. Takes
+//! effect when the database is opened next.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::set_buffer_size( std::size_t size, unsigned int num_buffers )
+{
+  if (m_file != NULL)
+  {
+    uvm_report_warning("TRDB/BUFFER", "The buffer size of transaction database '" +
+      m_filename + "' cannot be changed while it is open");
+    return;
+  }
+
+  m_buffer_size = (size == 0) ? 1 : size;
+  m_num_buffers = (num_buffers < 2) ? 2 : num_buffers;
+
+  for (std::size_t i = 0; i < m_free.size(); i++)
+    delete m_free[i];
+  m_free.clear();
+  m_num_allocated = 1; // the active buffer
+}
+
+//----------------------------------------------------------------------------
+// member function: get_buffer_size
+//
+//! Returns the size in bytes at which a buffer is handed to the writer.
+//----------------------------------------------------------------------------
+
+std::size_t uvm_tr_database::get_buffer_size() const
+{
+  return m_buffer_size;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_statistics
+//
+//! Returns the statistics of the writer since the database was opened.
+//! Records which are still buffered are not included; call #flush first
+//! to include them.
+//----------------------------------------------------------------------------
+
+uvm_tr_db_write_statistics uvm_tr_database::get_statistics() const
+{
+  UVM_TR_DB_LOCK;
+  return m_stats;
+}
+
+//----------------------------------------------------------------------------
+// member function: print_statistics
+//
+//! Prints the statistics of the writer to \p os, in the format used by
+//! the report summary.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::print_statistics( std::ostream& os ) const
+{
+  uvm_tr_db_write_statistics stats = get_statistics();
+
+  os << "Transaction database '" << m_filename << "': "
+     << stats.bytes << " bytes in " << stats.buffers << " buffers";
+
+  if (!stats.background)
+  {
+    os << ", written synchronously\n";
+    return;
+  }
+
+  os << ", " << stats.stalls << " stalls ("
+     << stats.stall_time << " s waiting for the writer), at most "
+     << stats.max_pending << " buffers pending\n";
+}
+
+//----------------------------------------------------------------------------
+// member function: open_stream
+//
+//! Creates a stream called \p name for the transactions of \p scope, and
+//! opens the database if needed. The stream is owned by the database.
+//----------------------------------------------------------------------------
+
+uvm_tr_stream* uvm_tr_database::open_stream( const std::string& name,
+                                             const std::string& scope,
+                                             const std::string& type_name )
+{
+  uvm_tr_stream* stream = new uvm_tr_stream(name);
+  stream->m_db = this;
+  stream->m_scope = scope;
+  stream->m_type_name = type_name;
+  stream->m_handle = m_streams.size() + 1;
+  m_streams.push_back(stream);
+
+  if (m_file == NULL)
+    open_db(); // also writes the new stream
+  else
+    m_write_stream(stream);
+
+  return stream;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_streams
+//
+//! Returns all streams of the database in \p q.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::get_streams( std::vector<uvm_tr_stream*>& q ) const
+{
+  q = m_streams;
+}
+
+//----------------------------------------------------------------------------
+// member function: begin_tr
+//
+//! Begins a transaction called \p name on \p stream, at \p begin_time or
+//! at the current simulation time when \p begin_time is zero. Returns the
+//! handle of the transaction, or 0 when the database is not open.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database::begin_tr( uvm_tr_stream* stream,
+                               const std::string& name,
+                               const sc_core::sc_time& begin_time )
+{
+  if (m_file == NULL || stream == NULL || stream->m_db != this)
+    return 0;
+
+  unsigned int name_h = m_intern(name);
+
+  int handle = ++m_last_handle;
+
+  m_put_u8(UVM_TR_DB_BEGIN);
+  m_put_uint(handle);
+  m_put_uint(stream->m_handle);
+  m_put_uint(name_h);
+  m_put_time(begin_time);
+  m_write_record();
+
+  return handle;
+}
+
+//----------------------------------------------------------------------------
+// member function: end_tr
+//
+//! Ends the transaction \p handle at \p end_time, or at the current
+//! simulation time when \p end_time is zero.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::end_tr( int handle, const sc_core::sc_time& end_time )
+{
+  if (m_file == NULL || !is_valid_handle(handle))
+    return;
+
+  m_put_u8(UVM_TR_DB_END);
+  m_put_uint(handle);
+  m_put_time(end_time);
+  m_write_record();
+}
+
+//----------------------------------------------------------------------------
+// member function: set_attribute
+//
+//! Records the \p numbits least significant bits of \p value as attribute
+//! \p name of transaction \p handle.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::set_attribute( int handle,
+                                     const std::string& name,
+                                     const uvm_bitstream_t& value,
+                                     int numbits )
+{
+  if (numbits > value.length())
+    numbits = value.length();
+
+  if (numbits <= 64)
+  {
+    set_attribute_int(handle, name, value.to_uint64(), numbits);
+    return;
+  }
+
+  if (m_file == NULL || !is_valid_handle(handle))
+    return;
+
+  unsigned int name_h = m_intern(name);
+
+  m_put_u8(UVM_TR_DB_INT);
+  m_put_uint(handle);
+  m_put_uint(name_h);
+  m_put_uint(numbits);
+  for (int lo = 0; lo < numbits; lo += 64)
+  {
+    int hi = (lo + 63 < numbits) ? lo + 63 : numbits - 1;
+    m_put_uint(value.range(hi, lo).to_uint64());
+  }
+  m_write_record();
+}
+
+//----------------------------------------------------------------------------
+// member function: set_attribute_int
+//
+//! Records the \p numbits (at most 64) least significant bits of \p value
+//! as attribute \p name of transaction \p handle.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::set_attribute_int( int handle,
+                                         const std::string& name,
+                                         sc_dt::uint64 value,
+                                         int numbits )
+{
+  if (m_file == NULL || !is_valid_handle(handle))
+    return;
+
+  if (numbits <= 0 || numbits > 64)
+    numbits = 64;
+  if (numbits < 64)
+    value &= (sc_dt::uint64(1) << numbits) - 1;
+
+  unsigned int name_h = m_intern(name);
+
+  m_put_u8(UVM_TR_DB_INT);
+  m_put_uint(handle);
+  m_put_uint(name_h);
+  m_put_uint(numbits);
+  m_put_uint(value);
+  m_write_record();
+}
+
+//----------------------------------------------------------------------------
+// member function: set_attribute_string
+//
+//! Records the string \p value as attribute \p name of transaction
+//! \p handle. String values are not interned.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::set_attribute_string( int handle,
+                                            const std::string& name,
+                                            const std::string& value )
+{
+  if (m_file == NULL || !is_valid_handle(handle))
+    return;
+
+  unsigned int name_h = m_intern(name);
+
+  m_put_u8(UVM_TR_DB_STR);
+  m_put_uint(handle);
+  m_put_uint(name_h);
+  m_put_str(value);
+  m_write_record();
+}
+
+//----------------------------------------------------------------------------
+// member function: set_attribute_real
+//
+//! Records the real \p value as attribute \p name of transaction \p handle.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::set_attribute_real( int handle,
+                                          const std::string& name,
+                                          double value )
+{
+  if (m_file == NULL || !is_valid_handle(handle))
+    return;
+
+  unsigned int name_h = m_intern(name);
+
+  sc_dt::uint64 bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  m_put_u8(UVM_TR_DB_REAL);
+  m_put_uint(handle);
+  m_put_uint(name_h);
+  m_put_uint(bits);
+  m_write_record();
+}
+
+//----------------------------------------------------------------------------
+// member function: establish_link
+//
+//! Records a link between the transactions \p h1 and \p h2, for example
+//! "parent" or "child".
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::establish_link( int h1,
+                                      int h2,
+                                      const std::string& relation )
+{
+  if (m_file == NULL || !is_valid_handle(h1) || !is_valid_handle(h2))
+    return;
+
+  unsigned int relation_h = m_intern(relation);
+
+  m_put_u8(UVM_TR_DB_LINK);
+  m_put_uint(h1);
+  m_put_uint(h2);
+  m_put_uint(relation_h);
+  m_write_record();
+}
+
+//----------------------------------------------------------------------------
+// member function: is_valid_handle
+//
+//! Returns true if \p handle was returned by begin_tr.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database::is_valid_handle( int handle ) const
+{
+  return handle > 0 && handle <= m_last_handle;
+}
+
+////////////////////////////////////////////////////////////////////////
+//////// Implementation-defined member functions start here ////////////
+////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------------
+// member function: m_get_stream
+//
+//! Implementation-defined member function
+//! Returns the stream with handle \p handle, or NULL.
+//----------------------------------------------------------------------------
+
+uvm_tr_stream* uvm_tr_database::m_get_stream( int handle ) const
+{
+  if (handle <= 0 || handle > static_cast<int>(m_streams.size()))
+    return NULL;
+  return m_streams[handle - 1];
+}
+
+//----------------------------------------------------------------------------
+// member function: m_flush_all (static)
+//
+//! Implementation-defined member function
+//! Writes the buffered records of all open databases. Called by
+//! uvm_root::die before the simulation is terminated.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_flush_all()
+{
+  std::vector<uvm_tr_database*>& dbs = m_live_databases();
+
+  for (std::size_t i = 0; i < dbs.size(); i++)
+    dbs[i]->flush();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_get_databases (static)
+//
+//! Implementation-defined member function
+//! Returns all existing databases, for the report summary.
+//----------------------------------------------------------------------------
+
+const std::vector<uvm_tr_database*>& uvm_tr_database::m_get_databases()
+{
+  return m_live_databases();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_intern
+//
+//! Implementation-defined member function
+//! Returns the handle of \p str. A string which has not been seen before
+//! is assigned a new handle, and its string record is written first.
+//----------------------------------------------------------------------------
+
+unsigned int uvm_tr_database::m_intern( const std::string& str )
+{
+  string_handle_mapT::iterator it = m_string_handles.lower_bound(str);
+
+  if (it != m_string_handles.end() && it->first == str)
+    return it->second;
+
+  unsigned int handle = m_string_handles.size();
+  m_string_handles.insert(it, string_handle_mapT::value_type(str, handle));
+
+  m_put_u8(UVM_TR_DB_STRING);
+  m_put_uint(handle);
+  m_put_str(str);
+  m_write_record();
+
+  return handle;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_write_record
+//
+//! Implementation-defined member function
+//! Completes the record which was appended to the active buffer. The
+//! active buffer is only used by the simulation thread, so the lock is
+//! only taken when a full buffer is handed to the writer.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_write_record()
+{
+  if (m_active->size() < m_buffer_size)
+    return;
+
+  if (!m_thread->running)
+  {
+    if (!m_write_buffer(*m_active))
+      m_write_error = true;
+    m_stats.bytes += m_active->size();
+    m_stats.buffers++;
+    m_active->clear();
+    return;
+  }
+
+  UVM_TR_DB_LOCK;
+  m_queue_active_buffer();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_get_free_buffer
+//
+//! Implementation-defined member function
+//!
+//! Returns a buffer for new records. When all buffers are queued or being
+//! written, waits until the writer returns one. Must be called with the
+//! lock held.
+//----------------------------------------------------------------------------
+
+std::vector<char>* uvm_tr_database::m_get_free_buffer()
+{
+#if defined(HAVE_PTHREAD)
+  if (m_free.empty() && m_num_allocated >= m_num_buffers && m_thread->running)
+  {
+    double start = m_tr_db_now();
+
+    while (m_free.empty())
+      pthread_cond_wait(&m_thread->drained, &m_thread->mutex);
+
+    m_stats.stalls++;
+    m_stats.stall_time += m_tr_db_now() - start;
+  }
+#endif
+
+  if (!m_free.empty())
+  {
+    std::vector<char>* buf = m_free.back();
+    m_free.pop_back();
+    return buf;
+  }
+
+  std::vector<char>* buf = new std::vector<char>;
+  buf->reserve(m_buffer_size + 256);
+  m_num_allocated++;
+  return buf;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_queue_active_buffer
+//
+//! Implementation-defined member function
+//!
+//! Moves the active buffer to the write queue if it holds any records,
+//! and wakes up the writer. Without a writer thread, writes the buffer
+//! instead. Must be called with the lock held.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_queue_active_buffer()
+{
+  if (m_active->empty())
+    return;
+
+  m_stats.bytes += m_active->size();
+  m_stats.buffers++;
+
+  if (!m_thread->running)
+  {
+    if (!m_write_buffer(*m_active))
+      m_write_error = true;
+    m_active->clear();
+    return;
+  }
+
+  m_full.push_back(m_active);
+  if (m_full.size() > m_stats.max_pending)
+    m_stats.max_pending = m_full.size();
+
+#if defined(HAVE_PTHREAD)
+  pthread_cond_signal(&m_thread->work);
+#endif
+
+  m_active = m_get_free_buffer();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_write_buffer
+//
+//! Implementation-defined member function
+//! Writes \p buf to the file. Returns false if the write failed.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database::m_write_buffer( const std::vector<char>& buf )
+{
+  if (buf.empty())
+    return true;
+  return std::fwrite(&buf[0], 1, buf.size(), m_file) == buf.size();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_start_writer
+//
+//! Implementation-defined member function
+//! Starts the writer thread. Without a writer thread, the database falls
+//! back to synchronous writes.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_start_writer()
+{
+  m_stop = false;
+
+#if defined(HAVE_PTHREAD)
+  m_thread->running =
+    (pthread_create(&m_thread->thread, NULL, &m_writer_main, this) == 0);
+#endif
+
+  m_stats.background = m_thread->running;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_stop_writer
+//
+//! Implementation-defined member function
+//! Stops the writer thread after it has written all queued buffers.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_stop_writer()
+{
+#if defined(HAVE_PTHREAD)
+  if (m_thread->running)
+  {
+    {
+      UVM_TR_DB_LOCK;
+      m_stop = true;
+      pthread_cond_signal(&m_thread->work);
+    }
+    pthread_join(m_thread->thread, NULL);
+  }
+#endif
+
+  m_thread->running = false;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_writer_main (static)
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void* uvm_tr_database::m_writer_main( void* arg )
+{
+  static_cast<uvm_tr_database*>(arg)->m_writer_loop();
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_writer_loop
+//
+//! Implementation-defined member function
+//!
+//! Body of the writer thread. Waits for full buffers and writes them
+//! outside the lock, then returns them for reuse.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_writer_loop()
+{
+#if defined(HAVE_PTHREAD)
+  UVM_TR_DB_LOCK;
+
+  while (true)
+  {
+    while (m_full.empty() && !m_stop)
+      pthread_cond_wait(&m_thread->work, &m_thread->mutex);
+
+    if (m_full.empty() && m_stop)
+      break;
+
+    std::deque<std::vector<char>*> batch;
+    batch.swap(m_full);
+    m_writing = true;
+
+    pthread_mutex_unlock(&m_thread->mutex);
+
+    bool ok = true;
+    for (std::size_t i = 0; i < batch.size(); i++)
+      ok = m_write_buffer(*batch[i]) && ok;
+
+    pthread_mutex_lock(&m_thread->mutex);
+
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+      batch[i]->clear();
+      m_free.push_back(batch[i]);
+    }
+
+    if (!ok)
+      m_write_error = true;
+
+    m_writing = false;
+    pthread_cond_broadcast(&m_thread->drained);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+// member function: m_close_all_at_exit (static)
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_close_all_at_exit()
+{
+  std::vector<uvm_tr_database*>& dbs = m_live_databases();
+
+  for (std::size_t i = 0; i < dbs.size(); i++)
+    dbs[i]->close_db();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_live_databases (static)
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+std::vector<uvm_tr_database*>& uvm_tr_database::m_live_databases()
+{
+  // function-local to avoid static initialization order issues
+  static std::vector<uvm_tr_database*> dbs;
+  return dbs;
+}
+
+//----------------------------------------------------------------------------
+// member functions: m_put_u8, m_put_uint, m_put_time, m_put_str
+//
+//! Implementation-defined member functions
+//! Append a field of the record under construction to the active buffer.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database::m_put_u8( unsigned int value )
+{
+  m_active->push_back(static_cast<char>(value & 0xff));
+}
+
+void uvm_tr_database::m_put_uint( sc_dt::uint64 value )
+{
+  while (value >= 0x80)
+  {
+    m_active->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  m_active->push_back(static_cast<char>(value));
+}
+
+void uvm_tr_database::m_put_time( const sc_core::sc_time& t )
+{
+  sc_dt::uint64 value = (t == sc_core::SC_ZERO_TIME) ?
+    sc_core::sc_time_stamp().value() : t.value();
+
+  // zigzag encoding of the signed difference with the previous time
+  sc_dt::uint64 delta = value - m_last_time;
+  if (value >= m_last_time)
+    m_put_uint(delta << 1);
+  else
+    m_put_uint(((m_last_time - value) << 1) - 1);
+
+  m_last_time = value;
+}
+
+void uvm_tr_database::m_put_str( const std::string& str )
+{
+  m_put_uint(str.size());
+  m_active->insert(m_active->end(), str.begin(), str.end());
+}
+
+#undef UVM_TR_DB_LOCK
+
+} // namespace uvm
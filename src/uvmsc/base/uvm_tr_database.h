@@ -0,0 +1,354 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_TR_DATABASE_H_
+#define UVM_TR_DATABASE_H_
+
+#include <cstdio>
+#include <cstddef>
+#include <deque>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <systemc>
+
+#include "uvmsc/base/uvm_object_globals.h"
+#include "uvmsc/base/uvm_object.h"
+#include "uvmsc/macros/uvm_object_defines.h"
+#include "uvmsc/factory/uvm_object_registry.h"
+
+namespace uvm {
+
+// forward class declarations
+class uvm_tr_database;
+
+//----------------------------------------------------------------------------
+// File format of the transaction database
+//
+//! A database starts with the eight character magic "UVMTRDB1", followed
+//! by the format version and the time resolution as a power of ten
+//! femtoseconds. All integers, including these two, are written as
+//! variable-length quantities: seven bits per byte, least significant
+//! group first, with the top bit set on all but the last byte. Values
+//! are therefore independent of the byte order of the producing host,
+//! and small values take a single byte.
+//!
+//! The remainder of the file is a sequence of records, each starting with
+//! a one byte tag:
+//!
+//! - UVM_TR_DB_STRING: string handle, length and the characters of a
+//!   string. Every stream name, scope, type, transaction name, attribute
+//!   name and link relation is emitted once, before the first record which
+//!   refers to it.
+//!
+//! - UVM_TR_DB_STREAM: stream handle and the string handles of the stream
+//!   name, scope and type.
+//!
+//! - UVM_TR_DB_BEGIN: transaction handle, stream handle, string handle of
+//!   the transaction name and begin time.
+//!
+//! - UVM_TR_DB_END: transaction handle and end time.
+//!
+//! - UVM_TR_DB_INT: transaction handle, string handle of the attribute
+//!   name, number of bits, and the value as one 64-bit word per 64 bits,
+//!   least significant word first.
+//!
+//! - UVM_TR_DB_STR: transaction handle, string handle of the attribute
+//!   name, length and the characters of the value.
+//!
+//! - UVM_TR_DB_REAL: transaction handle, string handle of the attribute
+//!   name and the IEEE-754 bit pattern of the value.
+//!
+//! - UVM_TR_DB_LINK: the two transaction handles and the string handle of
+//!   the relation.
+//!
+//! Times are in units of the time resolution. Each time is written as the
+//! difference with the previous time in the file, zigzag encoded so that
+//! a negative difference takes as few bytes as a positive one.
+//----------------------------------------------------------------------------
+
+enum uvm_tr_db_tag
+{
+  UVM_TR_DB_STRING = 'S',
+  UVM_TR_DB_STREAM = 'T',
+  UVM_TR_DB_BEGIN  = 'B',
+  UVM_TR_DB_END    = 'E',
+  UVM_TR_DB_INT    = 'I',
+  UVM_TR_DB_STR    = 'A',
+  UVM_TR_DB_REAL   = 'R',
+  UVM_TR_DB_LINK   = 'L'
+};
+
+#define UVM_TR_DB_MAGIC "UVMTRDB1"
+#define UVM_TR_DB_VERSION 1u
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_stream
+//
+//! A stream groups the transactions of one source, such as a monitor or a
+//! sequencer, in a #uvm_tr_database. Streams are created by
+//! uvm_tr_database::open_stream and owned by the database.
+//----------------------------------------------------------------------------
+
+class uvm_tr_stream : public uvm_object
+{
+ public:
+  friend class uvm_tr_database;
+
+  UVM_OBJECT_UTILS(uvm_tr_stream);
+
+  uvm_tr_stream( const std::string& name = "unnamed-uvm_tr_stream" );
+
+  virtual ~uvm_tr_stream();
+
+  uvm_tr_database* get_db() const;
+
+  std::string get_scope() const;
+
+  std::string get_stream_type_name() const;
+
+  int get_handle() const;
+
+  int begin_tr( const std::string& name,
+                const sc_core::sc_time& begin_time = sc_core::SC_ZERO_TIME );
+
+ private:
+  uvm_tr_database* m_db;
+  std::string m_scope;
+  std::string m_type_name;
+  int m_handle;
+
+}; // class uvm_tr_stream
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_db_write_statistics
+//
+//! Statistics of the background writer of a #uvm_tr_database since the
+//! database was opened. A stall is a wait of the simulation thread for a
+//! free buffer, because the writer did not keep up with the recording.
+//----------------------------------------------------------------------------
+
+struct uvm_tr_db_write_statistics
+{
+  uvm_tr_db_write_statistics();
+
+  sc_dt::uint64 bytes;       // bytes handed to the writer
+  unsigned int buffers;      // buffers handed to the writer
+  unsigned int stalls;       // waits for a free buffer
+  double stall_time;         // wall clock seconds spent in stalls
+  unsigned int max_pending;  // largest number of buffers queued at once
+  bool background;           // buffers were written by a writer thread
+};
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_database
+//
+//! The transaction database records transactions, grouped in streams, in
+//! a compact binary file. Names are written once and referred to by
+//! handle, integral values are written as raw binary numbers and times as
+//! differences with the previous time, so that recording all transactions
+//! of a long simulation stays affordable. The #uvm_tr_database_reader
+//! indexes and queries the file afterwards.
+//!
+//! The file is opened by #open_db, or by the first call to #open_stream.
+//! Opening the database again after #close_db continues the same file.
+//! A transaction is identified by the handle returned by begin_tr, which
+//! is passed to the other member functions. Handle 0 is never used; it is
+//! returned when the database cannot be opened, and ignored as argument.
+//!
+//! Records are encoded into an in-memory buffer without locking. A full
+//! buffer is handed to a writer thread, which writes it to the file while
+//! the simulation fills the next buffer; the simulation only waits when
+//! all buffers are in flight. Buffered records are written by #flush, by
+//! #close_db, when the report summary is printed, when uvm_root::die is
+//! called and when the program exits. Without POSIX threads, full buffers
+//! are written synchronously.
+//!
+//! The default database of the core service writes to tr_db.bin, or to
+//! the file named by the environment variable UVM_SYSTEMC_TR_DATABASE.
+//----------------------------------------------------------------------------
+
+class uvm_tr_database : public uvm_object
+{
+ public:
+  UVM_OBJECT_UTILS(uvm_tr_database);
+
+  uvm_tr_database( const std::string& name = "unnamed-uvm_tr_database" );
+
+  virtual ~uvm_tr_database();
+
+  //--------------------------------------------------------------------------
+  // Group: Database API
+  //--------------------------------------------------------------------------
+
+  bool open_db();
+
+  bool close_db();
+
+  bool is_open() const;
+
+  void set_file_name( const std::string& filename );
+
+  std::string get_file_name() const;
+
+  void flush();
+
+  void set_buffer_size( std::size_t size, unsigned int num_buffers = 2 );
+
+  std::size_t get_buffer_size() const;
+
+  uvm_tr_db_write_statistics get_statistics() const;
+
+  void print_statistics( std::ostream& os ) const;
+
+  //--------------------------------------------------------------------------
+  // Group: Stream API
+  //--------------------------------------------------------------------------
+
+  uvm_tr_stream* open_stream( const std::string& name,
+                              const std::string& scope = "",
+                              const std::string& type_name = "TVM" );
+
+  void get_streams( std::vector<uvm_tr_stream*>& q ) const;
+
+  //--------------------------------------------------------------------------
+  // Group: Transaction API
+  //--------------------------------------------------------------------------
+
+  int begin_tr( uvm_tr_stream* stream,
+                const std::string& name,
+                const sc_core::sc_time& begin_time = sc_core::SC_ZERO_TIME );
+
+  void end_tr( int handle,
+               const sc_core::sc_time& end_time = sc_core::SC_ZERO_TIME );
+
+  void set_attribute( int handle,
+                      const std::string& name,
+                      const uvm_bitstream_t& value,
+                      int numbits );
+
+  void set_attribute_int( int handle,
+                          const std::string& name,
+                          sc_dt::uint64 value,
+                          int numbits = 64 );
+
+  void set_attribute_string( int handle,
+                             const std::string& name,
+                             const std::string& value );
+
+  void set_attribute_real( int handle,
+                           const std::string& name,
+                           double value );
+
+  void establish_link( int h1,
+                       int h2,
+                       const std::string& relation = "" );
+
+  bool is_valid_handle( int handle ) const;
+
+  /////////////////////////////////////////////////////
+  // Implementation-defined member functions below,
+  // not part of UVM Class reference / LRM
+  /////////////////////////////////////////////////////
+
+  uvm_tr_stream* m_get_stream( int handle ) const;
+
+  static void m_flush_all();
+
+  static const std::vector<uvm_tr_database*>& m_get_databases();
+
+ private:
+  // disabled
+  uvm_tr_database( const uvm_tr_database& );
+  uvm_tr_database& operator=( const uvm_tr_database& );
+
+  struct m_thread_state;
+
+  unsigned int m_intern( const std::string& str );
+
+  void m_write_record();
+
+  void m_write_header();
+
+  void m_write_stream( uvm_tr_stream* stream );
+
+  std::vector<char>* m_get_free_buffer();
+
+  void m_queue_active_buffer();
+
+  bool m_write_buffer( const std::vector<char>& buf );
+
+  void m_start_writer();
+
+  void m_stop_writer();
+
+  static void* m_writer_main( void* arg );
+
+  void m_writer_loop();
+
+  static void m_close_all_at_exit();
+
+  static std::vector<uvm_tr_database*>& m_live_databases();
+
+  void m_put_u8( unsigned int value );
+  void m_put_uint( sc_dt::uint64 value );
+  void m_put_time( const sc_core::sc_time& t );
+  void m_put_str( const std::string& str );
+
+  std::string m_filename;
+  std::FILE* m_file;
+
+  // buffer which receives the encoded records, buffers queued for the
+  // writer, and buffers available for reuse
+  std::vector<char>* m_active;
+  std::deque<std::vector<char>*> m_full;
+  std::vector<std::vector<char>*> m_free;
+
+  std::size_t m_buffer_size;
+  unsigned int m_num_buffers;
+  unsigned int m_num_allocated;
+
+  bool m_writing;
+  bool m_stop;
+  bool m_write_error;
+
+  m_thread_state* m_thread;
+
+  uvm_tr_db_write_statistics m_stats;
+
+  typedef std::map<std::string, unsigned int> string_handle_mapT;
+  string_handle_mapT m_string_handles;
+
+  std::vector<uvm_tr_stream*> m_streams;
+
+  // file written so far, which is continued when it is opened again, and
+  // number of streams declared in it
+  std::string m_written_filename;
+  unsigned int m_num_written_streams;
+
+  int m_last_handle;
+  sc_dt::uint64 m_last_time;
+
+}; // class uvm_tr_database
+
+} // namespace uvm
+
+#endif // UVM_TR_DATABASE_H_
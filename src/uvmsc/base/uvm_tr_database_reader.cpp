@@ -0,0 +1,837 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "uvmsc/base/uvm_tr_database_reader.h"
+#include "uvmsc/base/uvm_tr_database.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Orderings used to build the index
+//----------------------------------------------------------------------------
+
+typedef std::pair<int, uvm_tr_db_attribute> uvm_tr_db_attr_entry;
+
+struct uvm_tr_db_attr_less
+{
+  bool operator()( const uvm_tr_db_attr_entry& a, const uvm_tr_db_attr_entry& b ) const
+  { return a.first < b.first; }
+};
+
+struct uvm_tr_db_begin_less
+{
+  explicit uvm_tr_db_begin_less( const std::vector<uvm_tr_db_transaction>& trs )
+  : m_trs(trs) {}
+
+  bool operator()( int a, int b ) const
+  { return m_trs[a].begin_time < m_trs[b].begin_time; }
+
+  bool operator()( sc_dt::uint64 t, int b ) const
+  { return t < m_trs[b].begin_time; }
+
+  const std::vector<uvm_tr_db_transaction>& m_trs;
+};
+
+struct uvm_tr_db_tr_less
+{
+  bool operator()( const uvm_tr_db_transaction* a, const uvm_tr_db_transaction* b ) const
+  {
+    return (a->begin_time < b->begin_time) ||
+           (a->begin_time == b->begin_time && a->handle < b->handle);
+  }
+};
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+uvm_tr_database_reader::uvm_tr_database_reader()
+: m_data(NULL),
+  m_size(0),
+  m_mapped(false),
+  m_open(false),
+  m_time_exponent(0),
+  m_first_handle(1)
+{}
+
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+uvm_tr_database_reader::~uvm_tr_database_reader()
+{
+  close();
+}
+
+//----------------------------------------------------------------------------
+// member function: open
+//
+//! Maps the database \p filename into memory and indexes it. Returns
+//! false, with a description in #get_error, if this fails. When the file
+//! is truncated, for example because the simulation was aborted, the
+//! complete records are indexed, open returns true and #get_error
+//! describes the truncation.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database_reader::open( const std::string& filename )
+{
+  close();
+
+#if !defined(_WIN32)
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return m_fail("cannot open '" + filename + "'");
+
+  struct stat st;
+  if (::fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void* p = ::mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      m_data = static_cast<const char*>(p);
+      m_size = st.st_size;
+      m_mapped = true;
+    }
+  }
+  ::close(fd);
+#endif
+
+  if (!m_mapped)
+  {
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!in)
+      return m_fail("cannot open '" + filename + "'");
+
+    m_contents.assign(std::istreambuf_iterator<char>(in),
+                      std::istreambuf_iterator<char>());
+    m_data = m_contents.empty() ? NULL : &m_contents[0];
+    m_size = m_contents.size();
+  }
+
+  if ( m_size < 8 || std::memcmp(m_data, UVM_TR_DB_MAGIC, 8) != 0 )
+    return m_fail("'" + filename + "' is not a transaction database");
+
+  std::size_t pos = 8;
+  sc_dt::uint64 version = 0, exponent = 0;
+  if (!m_get_uint(pos, version) || !m_get_uint(pos, exponent))
+    return m_fail("'" + filename + "' is not a transaction database");
+
+  if (version != UVM_TR_DB_VERSION)
+  {
+    std::ostringstream str;
+    str << "'" << filename << "' has unsupported format version " << version;
+    return m_fail(str.str());
+  }
+
+  m_time_exponent = static_cast<int>(exponent);
+  m_error.clear();
+
+  if (!m_index())
+    return false;
+
+  m_open = true;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// member function: close
+//----------------------------------------------------------------------------
+
+void uvm_tr_database_reader::close()
+{
+#if !defined(_WIN32)
+  if (m_mapped)
+    ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+  m_mapped = false;
+  m_open = false;
+  m_contents.clear();
+  m_data = NULL;
+  m_size = 0;
+  m_strings.clear();
+  m_string_handles.clear();
+  m_streams.clear();
+  m_transactions.clear();
+  m_attributes.clear();
+  m_first_handle = 1;
+  m_stream_index.clear();
+  m_stream_max_end.clear();
+  m_int_index.clear();
+  m_links.clear();
+}
+
+//----------------------------------------------------------------------------
+// member function: is_open
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database_reader::is_open() const
+{
+  return m_open;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_error
+//----------------------------------------------------------------------------
+
+const std::string& uvm_tr_database_reader::get_error() const
+{
+  return m_error;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_string
+//
+//! Returns the string with handle \p handle, as used in the records, or
+//! an empty string if there is no such handle.
+//----------------------------------------------------------------------------
+
+const std::string& uvm_tr_database_reader::get_string( unsigned int handle ) const
+{
+  static const std::string empty;
+
+  if (handle >= m_strings.size())
+    return empty;
+  return m_strings[handle];
+}
+
+//----------------------------------------------------------------------------
+// member function: get_time_exponent
+//
+//! Returns the time resolution of the database as a power of ten
+//! femtoseconds.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database_reader::get_time_exponent() const
+{
+  return m_time_exponent;
+}
+
+//----------------------------------------------------------------------------
+// member function: time_seconds
+//
+//! Converts \p time, in units of the time resolution, to seconds.
+//----------------------------------------------------------------------------
+
+double uvm_tr_database_reader::time_seconds( sc_dt::uint64 time ) const
+{
+  double t = static_cast<double>(time) * 1e-15;
+  for (int i = 0; i < m_time_exponent; i++)
+    t *= 10.0;
+  return t;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_num_streams
+//
+//! Returns the number of streams; stream handles run from 1 up to and
+//! including this number.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database_reader::get_num_streams() const
+{
+  return m_streams.size();
+}
+
+//----------------------------------------------------------------------------
+// member function: get_stream
+//
+//! Returns the stream with handle \p handle, or NULL.
+//----------------------------------------------------------------------------
+
+const uvm_tr_db_stream* uvm_tr_database_reader::get_stream( int handle ) const
+{
+  if (handle <= 0 || handle > static_cast<int>(m_streams.size()))
+    return NULL;
+  return &m_streams[handle - 1];
+}
+
+//----------------------------------------------------------------------------
+// member function: find_stream
+//
+//! Returns the handle of the first stream called \p name, in \p scope if
+//! \p scope is not empty, or 0 if there is no such stream.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database_reader::find_stream( const std::string& name,
+                                         const std::string& scope ) const
+{
+  for (unsigned int i = 0; i < m_streams.size(); i++)
+    if ( m_strings[m_streams[i].name] == name &&
+         (scope.empty() || m_strings[m_streams[i].scope] == scope) )
+      return i + 1;
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_num_transactions
+//
+//! Returns the highest transaction handle in the database. The handles
+//! are consecutive, but when the database was reopened during the
+//! simulation they do not start at 1; #get_transaction returns NULL for
+//! the handles of the earlier file.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database_reader::get_num_transactions() const
+{
+  if (m_transactions.empty())
+    return 0;
+  return m_first_handle + static_cast<int>(m_transactions.size()) - 1;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_transaction
+//
+//! Returns the transaction with handle \p handle, or NULL.
+//----------------------------------------------------------------------------
+
+const uvm_tr_db_transaction* uvm_tr_database_reader::get_transaction( int handle ) const
+{
+  int i = (handle <= 0) ? -1 : m_tr_index(handle);
+  if (i < 0)
+    return NULL;
+  return &m_transactions[i];
+}
+
+//----------------------------------------------------------------------------
+// member function: get_transactions
+//
+//! Returns in \p q the transactions of \p stream, or of all streams if
+//! \p stream is 0, which overlap the time range \p from to \p to
+//! (inclusive), in order of begin time. Transactions which were never
+//! ended are taken to last until the end of the database.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database_reader::get_transactions( std::vector<const uvm_tr_db_transaction*>& q,
+                                               int stream,
+                                               sc_dt::uint64 from,
+                                               sc_dt::uint64 to ) const
+{
+  q.clear();
+
+  int first = (stream == 0) ? 1 : stream;
+  int last = (stream == 0) ? static_cast<int>(m_stream_index.size()) : stream;
+
+  for (int s = first; s <= last && s <= static_cast<int>(m_stream_index.size()); s++)
+  {
+    const std::vector<int>& index = m_stream_index[s - 1];
+    const std::vector<sc_dt::uint64>& max_end = m_stream_max_end[s - 1];
+
+    // transactions before the first one which can end in the range, and
+    // transactions which begin after the range, are not needed
+    std::size_t begin =
+      std::lower_bound(max_end.begin(), max_end.end(), from) - max_end.begin();
+    std::size_t end =
+      std::upper_bound(index.begin(), index.end(), to, uvm_tr_db_begin_less(m_transactions)) - index.begin();
+
+    for (std::size_t i = begin; i < end; i++)
+    {
+      const uvm_tr_db_transaction& tr = m_transactions[index[i]];
+      if (!tr.ended || tr.end_time >= from)
+        q.push_back(&tr);
+    }
+  }
+
+  if (stream == 0)
+    std::sort(q.begin(), q.end(), uvm_tr_db_tr_less());
+}
+
+//----------------------------------------------------------------------------
+// member function: find_transactions
+//
+//! Returns in \p q the transactions of \p stream, or of all streams if
+//! \p stream is 0, which have an integral attribute \p name equal to
+//! \p value, in order of begin time. Only the first 64-bit word of the
+//! attribute is compared. The lookup uses an index built by #open, so
+//! its cost depends on the number of matches, not on the size of the
+//! database.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database_reader::find_transactions( std::vector<const uvm_tr_db_transaction*>& q,
+                                                const std::string& name,
+                                                sc_dt::uint64 value,
+                                                int stream ) const
+{
+  q.clear();
+
+  int name_h = m_find_string(name);
+  if (name_h < 0)
+    return;
+
+  int_indexT::const_iterator it =
+    m_int_index.find(std::make_pair(static_cast<unsigned int>(name_h), value));
+  if (it == m_int_index.end())
+    return;
+
+  const std::vector<int>& index = it->second;
+  for (std::size_t i = 0; i < index.size(); i++)
+  {
+    const uvm_tr_db_transaction& tr = m_transactions[index[i]];
+    if (stream == 0 || tr.stream == stream)
+      q.push_back(&tr);
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: get_attribute
+//
+//! Returns attribute \p i of \p tr, for \p i below tr.num_attributes.
+//! Attributes are in the order in which they were recorded.
+//----------------------------------------------------------------------------
+
+const uvm_tr_db_attribute& uvm_tr_database_reader::get_attribute( const uvm_tr_db_transaction& tr,
+                                                                  std::size_t i ) const
+{
+  return m_attributes[tr.first_attribute + i];
+}
+
+//----------------------------------------------------------------------------
+// member function: find_attribute
+//
+//! Returns the last attribute called \p name of \p tr, or NULL.
+//----------------------------------------------------------------------------
+
+const uvm_tr_db_attribute* uvm_tr_database_reader::find_attribute( const uvm_tr_db_transaction& tr,
+                                                                   const std::string& name ) const
+{
+  int name_h = m_find_string(name);
+  if (name_h < 0)
+    return NULL;
+
+  for (std::size_t a = tr.num_attributes; a > 0; a--)
+  {
+    const uvm_tr_db_attribute& attr = m_attributes[tr.first_attribute + a - 1];
+    if (attr.name == static_cast<unsigned int>(name_h))
+      return &attr;
+  }
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_int
+//
+//! Returns 64-bit word \p word of the integral attribute \p attr, or 0 if
+//! the attribute is not integral or has fewer words.
+//----------------------------------------------------------------------------
+
+sc_dt::uint64 uvm_tr_database_reader::get_int( const uvm_tr_db_attribute& attr,
+                                               unsigned int word ) const
+{
+  if (attr.kind != UVM_TR_DB_INT || word >= (attr.numbits + 63) / 64)
+    return 0;
+
+  std::size_t pos = attr.offset;
+  sc_dt::uint64 value = 0;
+  for (unsigned int i = 0; i <= word; i++)
+    m_get_uint(pos, value);
+  return value;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_string_value
+//
+//! Returns the value of the string attribute \p attr, or an empty string
+//! if the attribute is not a string.
+//----------------------------------------------------------------------------
+
+std::string uvm_tr_database_reader::get_string_value( const uvm_tr_db_attribute& attr ) const
+{
+  if (attr.kind != UVM_TR_DB_STR)
+    return "";
+
+  std::size_t pos = attr.offset;
+  sc_dt::uint64 length = 0;
+  m_get_uint(pos, length);
+  return std::string(m_data + pos, static_cast<std::size_t>(length));
+}
+
+//----------------------------------------------------------------------------
+// member function: get_real
+//
+//! Returns the value of the real attribute \p attr, or 0.0 if the
+//! attribute is not real.
+//----------------------------------------------------------------------------
+
+double uvm_tr_database_reader::get_real( const uvm_tr_db_attribute& attr ) const
+{
+  if (attr.kind != UVM_TR_DB_REAL)
+    return 0.0;
+
+  std::size_t pos = attr.offset;
+  sc_dt::uint64 bits = 0;
+  m_get_uint(pos, bits);
+
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_links
+//
+//! Returns in \p q the transactions linked from transaction \p handle,
+//! and the string handles of the relations in \p relations.
+//----------------------------------------------------------------------------
+
+void uvm_tr_database_reader::get_links( int handle,
+                                        std::vector<int>& q,
+                                        std::vector<unsigned int>& relations ) const
+{
+  q.clear();
+  relations.clear();
+  for (unsigned int i = 0; i < m_links.size(); i++)
+    if (m_links[i].h1 == handle)
+    {
+      q.push_back(m_links[i].h2);
+      relations.push_back(m_links[i].relation);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+//////// Implementation-defined member functions start here ////////////
+////////////////////////////////////////////////////////////////////////
+
+//----------------------------------------------------------------------------
+// member function: m_fail
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database_reader::m_fail( const std::string& error )
+{
+  close();
+  m_error = error;
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_index
+//
+//! Implementation-defined member function
+//! Reads all records once, and builds the tables of strings, streams,
+//! transactions, attributes and links.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database_reader::m_index()
+{
+  std::vector<uvm_tr_db_attr_entry> attributes;
+  sc_dt::uint64 time = 0;
+
+  std::size_t pos = 8;
+  sc_dt::uint64 skip;
+  m_get_uint(pos, skip); // version
+  m_get_uint(pos, skip); // time exponent
+
+  while (pos < m_size)
+  {
+    std::size_t start = pos;
+    char tag = m_data[pos++];
+    sc_dt::uint64 v[4];
+    bool ok = true;
+
+    switch (tag)
+    {
+      case UVM_TR_DB_STRING:
+      {
+        ok = m_get_uint(pos, v[0]) && m_get_uint(pos, v[1]) && m_size - pos >= v[1];
+        if (!ok)
+          break;
+        // the writer assigns string handles in order, starting at 0
+        if (v[0] != m_strings.size())
+        {
+          std::ostringstream str;
+          str << "corrupt string record at offset " << start;
+          return m_fail(str.str());
+        }
+        m_strings.push_back(std::string(m_data + pos, static_cast<std::size_t>(v[1])));
+        m_string_handles.insert(std::make_pair(m_strings.back(), static_cast<unsigned int>(v[0])));
+        pos += v[1];
+        break;
+      }
+      case UVM_TR_DB_STREAM:
+      {
+        for (int i = 0; i < 4 && ok; i++)
+          ok = m_get_uint(pos, v[i]);
+        if (!ok)
+          break;
+        // stream handles are assigned in order, starting at 1
+        if (v[0] != m_streams.size() + 1 || v[1] >= m_strings.size() ||
+            v[2] >= m_strings.size() || v[3] >= m_strings.size())
+        {
+          std::ostringstream str;
+          str << "corrupt stream record at offset " << start;
+          return m_fail(str.str());
+        }
+        m_streams.resize(v[0]);
+        m_stream_index.resize(v[0]);
+        uvm_tr_db_stream& s = m_streams[v[0] - 1];
+        s.name = v[1];
+        s.scope = v[2];
+        s.type_name = v[3];
+        break;
+      }
+      case UVM_TR_DB_BEGIN:
+      case UVM_TR_DB_END:
+      {
+        int n = (tag == UVM_TR_DB_BEGIN) ? 4 : 2;
+        for (int i = 0; i < n && ok; i++)
+          ok = m_get_uint(pos, v[i]);
+        if (!ok)
+          break;
+
+        sc_dt::uint64 z = v[n - 1];
+        if (z & 1)
+          time -= (z >> 1) + 1;
+        else
+          time += z >> 1;
+
+        if (tag == UVM_TR_DB_BEGIN)
+        {
+          // transaction handles are consecutive; the first one need not
+          // be 1 if the database was reopened
+          if (m_transactions.empty() && v[0] > 0 && v[0] <= 0x7fffffff)
+            m_first_handle = static_cast<int>(v[0]);
+
+          if ( v[0] != m_first_handle + m_transactions.size() || v[0] > 0x7fffffff ||
+               v[1] == 0 || v[1] > m_streams.size() || v[2] >= m_strings.size() )
+          {
+            std::ostringstream str;
+            str << "corrupt transaction record at offset " << start;
+            return m_fail(str.str());
+          }
+          uvm_tr_db_transaction unused;
+          std::memset(&unused, 0, sizeof(unused));
+          m_transactions.push_back(unused);
+
+          uvm_tr_db_transaction& tr = m_transactions.back();
+          tr.handle = static_cast<int>(v[0]);
+          tr.stream = static_cast<int>(v[1]);
+          tr.name = v[2];
+          tr.begin_time = time;
+          tr.end_time = time;
+          tr.ended = false;
+        }
+        else if (m_tr_index(v[0]) >= 0)
+        {
+          uvm_tr_db_transaction& tr = m_transactions[m_tr_index(v[0])];
+          tr.end_time = time;
+          tr.ended = true;
+        }
+        break;
+      }
+      case UVM_TR_DB_INT:
+      case UVM_TR_DB_STR:
+      case UVM_TR_DB_REAL:
+      {
+        ok = m_get_uint(pos, v[0]) && m_get_uint(pos, v[1]);
+        if (!ok)
+          break;
+
+        uvm_tr_db_attribute attr;
+        attr.name = v[1];
+        attr.kind = tag;
+        attr.numbits = 64;
+
+        if (tag == UVM_TR_DB_INT)
+        {
+          ok = m_get_uint(pos, v[2]);
+          attr.numbits = v[2];
+          attr.offset = pos;
+          unsigned int words = (attr.numbits + 63) / 64;
+          if (words == 0)
+            words = 1;
+          for (unsigned int i = 0; i < words && ok; i++)
+            ok = m_get_uint(pos, v[3]);
+        }
+        else if (tag == UVM_TR_DB_STR)
+        {
+          attr.offset = pos;
+          ok = m_get_uint(pos, v[2]) && m_size - pos >= v[2];
+          if (ok)
+          {
+            attr.numbits = 8 * v[2];
+            pos += v[2];
+          }
+        }
+        else
+        {
+          attr.offset = pos;
+          ok = m_get_uint(pos, v[2]);
+        }
+
+        if (!ok)
+          break;
+
+        if (m_tr_index(v[0]) < 0 || v[1] >= m_strings.size())
+        {
+          std::ostringstream str;
+          str << "corrupt attribute record at offset " << start;
+          return m_fail(str.str());
+        }
+        attributes.push_back(uvm_tr_db_attr_entry(m_tr_index(v[0]), attr));
+        break;
+      }
+      case UVM_TR_DB_LINK:
+      {
+        for (int i = 0; i < 3 && ok; i++)
+          ok = m_get_uint(pos, v[i]);
+        if (!ok)
+          break;
+        m_link link;
+        link.h1 = static_cast<int>(v[0]);
+        link.h2 = static_cast<int>(v[1]);
+        link.relation = v[2];
+        m_links.push_back(link);
+        break;
+      }
+      default:
+      {
+        std::ostringstream str;
+        str << "unknown record type at offset " << start;
+        return m_fail(str.str());
+      }
+    }
+
+    if (!ok)
+    {
+      std::ostringstream str;
+      str << "database is truncated after offset " << start;
+      m_error = str.str();
+      break;
+    }
+  }
+
+  // group the attributes per transaction, keeping their recording order
+  std::stable_sort(attributes.begin(), attributes.end(), uvm_tr_db_attr_less());
+  m_attributes.reserve(attributes.size());
+  for (std::size_t i = 0; i < attributes.size(); i++)
+  {
+    int tr_index = attributes[i].first;
+    uvm_tr_db_transaction& tr = m_transactions[tr_index];
+    if (tr.num_attributes == 0)
+      tr.first_attribute = i;
+    tr.num_attributes++;
+    m_attributes.push_back(attributes[i].second);
+
+    // index integral attributes by name and value for find_transactions
+    const uvm_tr_db_attribute& attr = m_attributes.back();
+    if (attr.kind == UVM_TR_DB_INT)
+    {
+      std::vector<int>& matches = m_int_index[std::make_pair(attr.name, get_int(attr))];
+      if (matches.empty() || matches.back() != tr_index)
+        matches.push_back(tr_index);
+    }
+  }
+
+  // order the transactions of each stream by begin time; ties keep the
+  // order of the handles
+  for (std::size_t i = 0; i < m_transactions.size(); i++)
+    m_stream_index[m_transactions[i].stream - 1].push_back(static_cast<int>(i));
+
+  m_stream_max_end.resize(m_stream_index.size());
+
+  for (std::size_t s = 0; s < m_stream_index.size(); s++)
+  {
+    std::vector<int>& index = m_stream_index[s];
+    std::stable_sort(index.begin(), index.end(), uvm_tr_db_begin_less(m_transactions));
+
+    // transactions which were never ended last until the end
+    std::vector<sc_dt::uint64>& max_end = m_stream_max_end[s];
+    max_end.resize(index.size());
+    sc_dt::uint64 latest = 0;
+    for (std::size_t i = 0; i < index.size(); i++)
+    {
+      const uvm_tr_db_transaction& tr = m_transactions[index[i]];
+      sc_dt::uint64 tr_end = tr.ended ? tr.end_time : ~sc_dt::uint64(0);
+      if (tr_end > latest)
+        latest = tr_end;
+      max_end[i] = latest;
+    }
+  }
+
+  for (int_indexT::iterator it = m_int_index.begin(); it != m_int_index.end(); it++)
+    std::stable_sort(it->second.begin(), it->second.end(),
+                     uvm_tr_db_begin_less(m_transactions));
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_get_uint
+//
+//! Implementation-defined member function
+//! Decodes the variable-length quantity at \p pos, and advances \p pos.
+//! Returns false if the file ends first.
+//----------------------------------------------------------------------------
+
+bool uvm_tr_database_reader::m_get_uint( std::size_t& pos, sc_dt::uint64& value ) const
+{
+  value = 0;
+  for (int shift = 0; pos < m_size && shift < 64; shift += 7)
+  {
+    unsigned char c = static_cast<unsigned char>(m_data[pos++]);
+    value |= static_cast<sc_dt::uint64>(c & 0x7f) << shift;
+    if ((c & 0x80) == 0)
+      return true;
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_find_string
+//
+//! Implementation-defined member function
+//! Returns the handle of \p str, or -1 if it does not occur.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database_reader::m_find_string( const std::string& str ) const
+{
+  std::map<std::string, unsigned int>::const_iterator it = m_string_handles.find(str);
+  if (it == m_string_handles.end())
+    return -1;
+  return it->second;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_tr_index
+//
+//! Implementation-defined member function
+//! Returns the index in the table of transactions of the transaction
+//! with handle \p handle, or -1 if there is no such transaction.
+//----------------------------------------------------------------------------
+
+int uvm_tr_database_reader::m_tr_index( sc_dt::uint64 handle ) const
+{
+  if ( handle < static_cast<sc_dt::uint64>(m_first_handle) ||
+       handle - m_first_handle >= m_transactions.size() )
+    return -1;
+  return static_cast<int>(handle - m_first_handle);
+}
+
+} // namespace uvm
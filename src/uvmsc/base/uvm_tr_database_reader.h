@@ -0,0 +1,234 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_TR_DATABASE_READER_H_
+#define UVM_TR_DATABASE_READER_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <systemc>
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_db_stream
+//
+//! Implementation-defined class holding a stream read by the
+//! #uvm_tr_database_reader. Strings are given as handles, which the reader
+//! resolves with uvm_tr_database_reader::get_string.
+//----------------------------------------------------------------------------
+
+struct uvm_tr_db_stream
+{
+  unsigned int name;
+  unsigned int scope;
+  unsigned int type_name;
+};
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_db_attribute
+//
+//! Implementation-defined class holding an attribute of a transaction
+//! read by the #uvm_tr_database_reader. The kind is the tag of its record
+//! (UVM_TR_DB_INT, UVM_TR_DB_STR or UVM_TR_DB_REAL). The value stays in
+//! the mapped file, at the given offset, and is decoded on request.
+//----------------------------------------------------------------------------
+
+struct uvm_tr_db_attribute
+{
+  unsigned int name;
+  char kind;
+  unsigned int numbits;
+  std::size_t offset;
+};
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_db_transaction
+//
+//! Implementation-defined class holding a transaction read by the
+//! #uvm_tr_database_reader. Times are in units of the time resolution of
+//! the database. A transaction which was never ended has an end time
+//! equal to its begin time and ended set to false.
+//----------------------------------------------------------------------------
+
+struct uvm_tr_db_transaction
+{
+  int handle;
+  int stream;
+  unsigned int name;
+  sc_dt::uint64 begin_time;
+  sc_dt::uint64 end_time;
+  bool ended;
+  std::size_t first_attribute;
+  std::size_t num_attributes;
+};
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_tr_database_reader
+//
+//! Implementation-defined class which reads a database written by the
+//! #uvm_tr_database. The file is mapped into memory and indexed once by
+//! #open; attribute values are only decoded when they are requested.
+//! Transactions can then be selected by stream, time range and attribute
+//! value.
+//----------------------------------------------------------------------------
+
+class uvm_tr_database_reader
+{
+ public:
+  uvm_tr_database_reader();
+
+  ~uvm_tr_database_reader();
+
+  bool open( const std::string& filename );
+
+  void close();
+
+  bool is_open() const;
+
+  const std::string& get_error() const;
+
+  const std::string& get_string( unsigned int handle ) const;
+
+  int get_time_exponent() const;
+
+  double time_seconds( sc_dt::uint64 time ) const;
+
+  //--------------------------------------------------------------------------
+  // Streams
+  //--------------------------------------------------------------------------
+
+  int get_num_streams() const;
+
+  const uvm_tr_db_stream* get_stream( int handle ) const;
+
+  int find_stream( const std::string& name,
+                   const std::string& scope = "" ) const;
+
+  //--------------------------------------------------------------------------
+  // Transactions
+  //--------------------------------------------------------------------------
+
+  int get_num_transactions() const;
+
+  const uvm_tr_db_transaction* get_transaction( int handle ) const;
+
+  void get_transactions( std::vector<const uvm_tr_db_transaction*>& q,
+                         int stream = 0,
+                         sc_dt::uint64 from = 0,
+                         sc_dt::uint64 to = ~sc_dt::uint64(0) ) const;
+
+  void find_transactions( std::vector<const uvm_tr_db_transaction*>& q,
+                          const std::string& name,
+                          sc_dt::uint64 value,
+                          int stream = 0 ) const;
+
+  //--------------------------------------------------------------------------
+  // Attributes
+  //--------------------------------------------------------------------------
+
+  const uvm_tr_db_attribute& get_attribute( const uvm_tr_db_transaction& tr,
+                                            std::size_t i ) const;
+
+  const uvm_tr_db_attribute* find_attribute( const uvm_tr_db_transaction& tr,
+                                             const std::string& name ) const;
+
+  sc_dt::uint64 get_int( const uvm_tr_db_attribute& attr,
+                         unsigned int word = 0 ) const;
+
+  std::string get_string_value( const uvm_tr_db_attribute& attr ) const;
+
+  double get_real( const uvm_tr_db_attribute& attr ) const;
+
+  //--------------------------------------------------------------------------
+  // Links
+  //--------------------------------------------------------------------------
+
+  void get_links( int handle,
+                  std::vector<int>& q,
+                  std::vector<unsigned int>& relations ) const;
+
+ private:
+  // disabled
+  uvm_tr_database_reader( const uvm_tr_database_reader& );
+  uvm_tr_database_reader& operator=( const uvm_tr_database_reader& );
+
+  bool m_fail( const std::string& error );
+
+  bool m_index();
+
+  bool m_get_uint( std::size_t& pos, sc_dt::uint64& value ) const;
+
+  int m_find_string( const std::string& str ) const;
+
+  int m_tr_index( sc_dt::uint64 handle ) const;
+
+  const char* m_data;
+  std::size_t m_size;
+
+  // file contents, when the file cannot be mapped
+  std::vector<char> m_contents;
+  bool m_mapped;
+  bool m_open;
+
+  int m_time_exponent;
+
+  std::vector<std::string> m_strings;
+  std::map<std::string, unsigned int> m_string_handles;
+  std::vector<uvm_tr_db_stream> m_streams;
+
+  // indexed by handle - m_first_handle; the handles in a file are
+  // consecutive, but do not start at 1 when the database was reopened
+  // with another file name
+  std::vector<uvm_tr_db_transaction> m_transactions;
+  std::vector<uvm_tr_db_attribute> m_attributes;
+  int m_first_handle;
+
+  // per stream, the indices of its transactions in order of begin time
+  std::vector<std::vector<int> > m_stream_index;
+
+  // per stream and position in m_stream_index, the latest end time of
+  // the transactions up to that position; not decreasing, so that the
+  // first transaction which can overlap a time is found by binary search
+  std::vector<std::vector<sc_dt::uint64> > m_stream_max_end;
+
+  // per integral attribute name and value (of the first word), the
+  // indices of the transactions which have it, in order of begin time
+  typedef std::map<std::pair<unsigned int, sc_dt::uint64>, std::vector<int> > int_indexT;
+  int_indexT m_int_index;
+
+  struct m_link
+  {
+    int h1;
+    int h2;
+    unsigned int relation;
+  };
+  std::vector<m_link> m_links;
+
+  std::string m_error;
+
+}; // class uvm_tr_database_reader
+
+} // namespace uvm
+
+#endif // UVM_TR_DATABASE_READER_H_
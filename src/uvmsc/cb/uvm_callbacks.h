@@ -147,6 +147,8 @@ class uvm_callbacks : public uvm_typed_callbacks<T>
 
   static bool m_register_pair( const std::string& tname = "", const std::string& cbname = "");
 
+  static int m_find( T* obj, uvm_callback* cb );
+
  private:
 
   static void m_get_q( uvm_queue<uvm_callback*>*& q, T* obj );
@@ -770,6 +772,30 @@ uvm_callbacks<T,CB>* uvm_callbacks<T,CB>::get()
   return m_inst;
 }
 
+//----------------------------------------------------------------------
+// member function: m_find (static)
+//
+// Implementation defined
+//
+// Returns the position of ~cb~ in the queue for ~obj~, or -1 if it does
+// not reside in it.
+//----------------------------------------------------------------------
+
+template <typename T, typename CB>
+int uvm_callbacks<T,CB>::m_find( T* obj, uvm_callback* cb )
+{
+  uvm_queue<uvm_callback*>* q = NULL;
+
+  get();
+  m_get_q(q, obj);
+
+  for(int i = 0; i < q->size(); ++i)
+    if (q->get(i) == cb)
+      return i;
+
+  return -1;
+}
+
 //----------------------------------------------------------------------
 // member function: m_get_q (static)
 //
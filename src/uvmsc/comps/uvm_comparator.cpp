@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <sstream>
+
+#include "uvmsc/comps/uvm_comparator.h"
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// Class: uvm_comparator_stats - implementation
+//------------------------------------------------------------------------------
+
+uvm_comparator_stats::uvm_comparator_stats()
+{
+  clear();
+}
+
+void uvm_comparator_stats::clear()
+{
+  matches = 0;
+  mismatches = 0;
+  max_outstanding = 0;
+  latency.clear();
+}
+
+std::string uvm_comparator_stats::convert2string() const
+{
+  std::ostringstream str;
+  const uvm_seq_histogram& hist = latency.get_histogram();
+
+  str << "  matches          : " << matches << std::endl
+      << "  mismatches       : " << mismatches << std::endl
+      << "  max outstanding  : " << max_outstanding << std::endl
+      << "  latency          : " << latency.convert2string() << std::endl
+      << "  latency buckets  :";
+
+  for (unsigned int i = 0; i < hist.num_buckets(); i++)
+  {
+    if (hist.get_count(i) == 0)
+      continue;
+
+    str << " ";
+    if (uvm_seq_histogram::bucket_low(i) == uvm_seq_histogram::bucket_high(i))
+      str << uvm_seq_histogram::bucket_low(i);
+    else
+      str << uvm_seq_histogram::bucket_low(i) << "-"
+          << uvm_seq_histogram::bucket_high(i);
+    str << ":" << hist.get_count(i);
+  }
+
+  return str.str();
+}
+
+} // namespace uvm
@@ -0,0 +1,399 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_COMPARATOR_H_
+#define UVM_COMPARATOR_H_
+
+#include <string>
+#include <sstream>
+
+#include <systemc>
+#include <tlm.h>
+
+#include "uvmsc/base/uvm_component.h"
+#include "uvmsc/base/uvm_component_name.h"
+#include "uvmsc/tlm1/uvm_analysis_export.h"
+#include "uvmsc/seq/uvm_sequence_stats.h"
+#include "uvmsc/macros/uvm_message_defines.h"
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// Comparator policies
+//
+//! The comparators are parameterized with policy classes, which provide
+//! static member functions to compare, convert and key the transactions.
+//! The built-in policies use the operators of the type; the class policies
+//! use the member functions of #uvm_object.
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_built_in_comp
+//
+//! Compares two transactions of a built-in type with operator==.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_built_in_comp
+{
+ public:
+  static bool comp( const T& a, const T& b )
+  {
+    return a == b;
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_class_comp
+//
+//! Compares two transactions derived from #uvm_object with
+//! uvm_object::compare.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_class_comp
+{
+ public:
+  static bool comp( const T& a, const T& b )
+  {
+    return a.compare(b);
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_built_in_converter
+//
+//! Converts a transaction of a built-in type to a string with operator<<.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_built_in_converter
+{
+ public:
+  static std::string convert2string( const T& t )
+  {
+    std::ostringstream str;
+    str << t;
+    return str.str();
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_class_converter
+//
+//! Converts a transaction derived from #uvm_object to a string with
+//! uvm_object::convert2string.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_class_converter
+{
+ public:
+  static std::string convert2string( const T& t )
+  {
+    return t.convert2string();
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_built_in_key
+//
+//! Uses the value of a transaction of an integral type as its key.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_built_in_key
+{
+ public:
+  static sc_dt::uint64 key( const T& t )
+  {
+    return static_cast<sc_dt::uint64>(t);
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_class_key
+//
+//! Uses the content hash of a transaction derived from #uvm_object, as
+//! returned by uvm_object::hash, as its key, so that equal transactions
+//! have equal keys. This only holds if the hash covers the same fields as
+//! uvm_object::do_compare; by default it hashes the fields packed by
+//! uvm_object::do_pack. A packed field which is not compared, such as an
+//! id or a time stamp, means equal transactions never match. A class
+//! without do_pack gives every transaction the same key, and matching
+//! then scans all outstanding transactions, in O(n) per transaction.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_class_key
+{
+ public:
+  static sc_dt::uint64 key( const T& t )
+  {
+    return t.hash();
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_comparator_stats
+//
+//! Implementation-defined class holding the statistics of a comparator.
+//! The latency of a pair is the time from the arrival of its first
+//! transaction until the arrival of the second one; its histogram buckets
+//! are in units of the time resolution.
+//------------------------------------------------------------------------------
+
+class uvm_comparator_stats
+{
+ public:
+  uvm_comparator_stats();
+
+  //! Number of pairs which compared equal
+  unsigned long matches;
+
+  //! Number of pairs which did not compare equal, and of transactions
+  //! which were dropped from the window without a match
+  unsigned long mismatches;
+
+  //! Largest number of transactions waiting for a match at once
+  unsigned long max_outstanding;
+
+  //! Time from the first to the second transaction of a matching pair
+  uvm_seq_time_stat latency;
+
+  void clear();
+
+  std::string convert2string() const;
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_comparator_base
+//
+//! Base class of the comparators. It provides the two analysis exports,
+//! receiving the expected transactions on #before_export and the actual
+//! transactions on #after_export, and keeps the statistics. Derived
+//! classes implement the matching in #write_before and #write_after.
+//!
+//! The statistics are reported in the report phase. Transactions which are
+//! still waiting for a match are reported in the check phase.
+//------------------------------------------------------------------------------
+
+template <typename T, typename CONVERT>
+class uvm_comparator_base : public uvm_component
+{
+ public:
+
+  //----------------------------------------------------------------------
+  // Port: before_export
+  //
+  //! The export to which the expected transactions are written.
+  //----------------------------------------------------------------------
+
+  uvm_analysis_export<T> before_export;
+
+  //----------------------------------------------------------------------
+  // Port: after_export
+  //
+  //! The export to which the actual transactions are written.
+  //----------------------------------------------------------------------
+
+  uvm_analysis_export<T> after_export;
+
+  explicit uvm_comparator_base( uvm_component_name name_ )
+  : uvm_component( name_ ),
+    before_export("before_export"),
+    after_export("after_export"),
+    m_before_listener(this, true),
+    m_after_listener(this, false)
+  {
+    before_export(m_before_listener);
+    after_export(m_after_listener);
+  }
+
+  //----------------------------------------------------------------------
+  // member function: write_before, write_after
+  //
+  //! Called for each transaction written to #before_export and
+  //! #after_export, respectively.
+  //----------------------------------------------------------------------
+
+  virtual void write_before( const T& t ) = 0;
+
+  virtual void write_after( const T& t ) = 0;
+
+  //----------------------------------------------------------------------
+  // member function: get_outstanding
+  //
+  //! Returns the number of transactions waiting for a match.
+  //----------------------------------------------------------------------
+
+  virtual unsigned long get_outstanding() const = 0;
+
+  //----------------------------------------------------------------------
+  // member function: flush
+  //
+  //! Drops the transactions waiting for a match and clears the statistics.
+  //----------------------------------------------------------------------
+
+  virtual void flush()
+  {
+    m_stats.clear();
+  }
+
+  //----------------------------------------------------------------------
+  // member functions: get_matches, get_mismatches, get_statistics
+  //----------------------------------------------------------------------
+
+  unsigned long get_matches() const
+  {
+    return m_stats.matches;
+  }
+
+  unsigned long get_mismatches() const
+  {
+    return m_stats.mismatches;
+  }
+
+  const uvm_comparator_stats& get_statistics() const
+  {
+    return m_stats;
+  }
+
+  virtual void check_phase( uvm_phase& )
+  {
+    if (get_outstanding() == 0)
+      return;
+
+    std::ostringstream str;
+    str << get_outstanding() << " transaction(s) without a match";
+    uvm_report_warning("Comparator Outstanding", str.str());
+  }
+
+  virtual void report_phase( uvm_phase& )
+  {
+    if (m_stats.matches == 0 && m_stats.mismatches == 0)
+      return;
+
+    uvm_report_info("Comparator Statistics", "\n" + m_stats.convert2string(), UVM_LOW);
+  }
+
+  virtual const std::string get_type_name() const
+  {
+    return std::string(this->kind());
+  }
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_comparator_base";
+  }
+
+ protected:
+
+  //----------------------------------------------------------------------
+  // member function: m_compared
+  //
+  //! Implementation-defined member function
+  //! Counts a compared pair and reports it. \p first_arrival is the time
+  //! at which the first transaction of the pair arrived. Messages are
+  //! only formatted when they are reported.
+  //----------------------------------------------------------------------
+
+  void m_compared( bool equal,
+                   const T& before,
+                   const T& after,
+                   const sc_core::sc_time& first_arrival )
+  {
+    if (equal)
+    {
+      m_stats.matches++;
+      m_stats.latency.add(sc_core::sc_time_stamp() - first_arrival);
+
+      UVM_INFO("Comparator Match", CONVERT::convert2string(after), UVM_HIGH);
+      return;
+    }
+
+    m_stats.mismatches++;
+
+    if (uvm_report_enabled(UVM_NONE, UVM_WARNING, "Comparator Mismatch"))
+      uvm_report_warning("Comparator Mismatch", CONVERT::convert2string(before) +
+        " differs from " + CONVERT::convert2string(after));
+  }
+
+  //----------------------------------------------------------------------
+  // member function: m_dropped
+  //
+  //! Implementation-defined member function
+  //! Counts and reports a transaction which was dropped without a match.
+  //----------------------------------------------------------------------
+
+  void m_dropped( const T& t, bool before )
+  {
+    m_stats.mismatches++;
+
+    if (uvm_report_enabled(UVM_NONE, UVM_WARNING, "Comparator Mismatch"))
+      uvm_report_warning("Comparator Mismatch", std::string(before ? "Expected " : "Actual ") +
+        CONVERT::convert2string(t) + " has no match within the window");
+  }
+
+  //----------------------------------------------------------------------
+  // member function: m_sample_outstanding
+  //
+  //! Implementation-defined member function
+  //----------------------------------------------------------------------
+
+  void m_sample_outstanding()
+  {
+    unsigned long n = get_outstanding();
+    if (n > m_stats.max_outstanding)
+      m_stats.max_outstanding = n;
+  }
+
+  uvm_comparator_stats m_stats;
+
+ private:
+
+  // receives the transactions of one export
+  class m_listener : public tlm::tlm_analysis_if<T>
+  {
+   public:
+    m_listener( uvm_comparator_base* comparator, bool before )
+    : m_comparator(comparator), m_before(before)
+    {}
+
+    virtual void write( const T& t )
+    {
+      if (m_before)
+        m_comparator->write_before(t);
+      else
+        m_comparator->write_after(t);
+    }
+
+   private:
+    uvm_comparator_base* m_comparator;
+    bool m_before;
+  };
+
+  m_listener m_before_listener;
+  m_listener m_after_listener;
+
+}; // class uvm_comparator_base
+
+} /* namespace uvm */
+
+#endif /* UVM_COMPARATOR_H_ */
@@ -30,5 +30,7 @@
 #include "uvmsc/comps/uvm_test.h"
 #include "uvmsc/comps/uvm_scoreboard.h"
 #include "uvmsc/comps/uvm_subscriber.h"
+#include "uvmsc/comps/uvm_in_order_comparator.h"
+#include "uvmsc/comps/uvm_out_of_order_comparator.h"
 
 #endif /* UVM_COMPS_H_ */
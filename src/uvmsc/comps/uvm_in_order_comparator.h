@@ -0,0 +1,204 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_IN_ORDER_COMPARATOR_H_
+#define UVM_IN_ORDER_COMPARATOR_H_
+
+#include <vector>
+
+#include <systemc>
+
+#include "uvmsc/comps/uvm_comparator.h"
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_in_order_comparator
+//
+//! Compares two streams of transactions which are expected to arrive in
+//! the same order. The n-th transaction written to before_export is
+//! compared with the n-th transaction written to after_export, using the
+//! COMP policy; CONVERT formats the transactions in messages.
+//!
+//! Transactions waiting for a match are kept in a ring buffer per export,
+//! which grows by doubling and is reused afterwards, so that matching does
+//! not allocate memory once the largest backlog has been seen.
+//------------------------------------------------------------------------------
+
+template < typename T,
+           typename COMP = uvm_built_in_comp<T>,
+           typename CONVERT = uvm_built_in_converter<T> >
+class uvm_in_order_comparator : public uvm_comparator_base<T, CONVERT>
+{
+ public:
+  explicit uvm_in_order_comparator( uvm_component_name name_ )
+  : uvm_comparator_base<T, CONVERT>( name_ )
+  {}
+
+  virtual void write_before( const T& t )
+  {
+    m_before.push(t);
+    m_match();
+  }
+
+  virtual void write_after( const T& t )
+  {
+    m_after.push(t);
+    m_match();
+  }
+
+  virtual unsigned long get_outstanding() const
+  {
+    return m_before.count + m_after.count;
+  }
+
+  virtual void flush()
+  {
+    m_before.clear();
+    m_after.clear();
+    uvm_comparator_base<T, CONVERT>::flush();
+  }
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_in_order_comparator";
+  }
+
+ private:
+
+  struct m_entry
+  {
+    T item;
+    sc_core::sc_time time;
+  };
+
+  // ring buffer of the transactions of one export, oldest at head
+  struct m_ring
+  {
+    std::vector<m_entry> slots;
+    unsigned long head;
+    unsigned long count;
+
+    m_ring() : head(0), count(0) {}
+
+    void push( const T& t )
+    {
+      if (count == slots.size())
+        grow();
+
+      m_entry& e = slots[(head + count) % slots.size()];
+      e.item = t;
+      e.time = sc_core::sc_time_stamp();
+      count++;
+    }
+
+    const m_entry& front() const
+    {
+      return slots[head];
+    }
+
+    void pop()
+    {
+      head = (head + 1) % slots.size();
+      count--;
+    }
+
+    void clear()
+    {
+      head = 0;
+      count = 0;
+    }
+
+    void grow()
+    {
+      std::vector<m_entry> larger(slots.empty() ? 8 : 2 * slots.size());
+      for (unsigned long i = 0; i < count; i++)
+        larger[i] = slots[(head + i) % slots.size()];
+      slots.swap(larger);
+      head = 0;
+    }
+  };
+
+  void m_match()
+  {
+    while (m_before.count > 0 && m_after.count > 0)
+    {
+      const m_entry& b = m_before.front();
+      const m_entry& a = m_after.front();
+
+      this->m_compared(COMP::comp(b.item, a.item), b.item, a.item,
+                       b.time < a.time ? b.time : a.time);
+
+      m_before.pop();
+      m_after.pop();
+    }
+
+    this->m_sample_outstanding();
+  }
+
+  m_ring m_before;
+  m_ring m_after;
+
+}; // class uvm_in_order_comparator
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_in_order_built_in_comparator
+//
+//! In-order comparator for built-in types, compared with operator==.
+//------------------------------------------------------------------------------
+
+template <typename T = int>
+class uvm_in_order_built_in_comparator : public uvm_in_order_comparator<T>
+{
+ public:
+  explicit uvm_in_order_built_in_comparator( uvm_component_name name_ )
+  : uvm_in_order_comparator<T>( name_ )
+  {}
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_in_order_built_in_comparator";
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_in_order_class_comparator
+//
+//! In-order comparator for transactions derived from #uvm_object, compared
+//! with uvm_object::compare and formatted with uvm_object::convert2string.
+//------------------------------------------------------------------------------
+
+template <typename T>
+class uvm_in_order_class_comparator
+  : public uvm_in_order_comparator< T, uvm_class_comp<T>, uvm_class_converter<T> >
+{
+ public:
+  explicit uvm_in_order_class_comparator( uvm_component_name name_ )
+  : uvm_in_order_comparator< T, uvm_class_comp<T>, uvm_class_converter<T> >( name_ )
+  {}
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_in_order_class_comparator";
+  }
+};
+
+} /* namespace uvm */
+
+#endif /* UVM_IN_ORDER_COMPARATOR_H_ */
@@ -0,0 +1,467 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_OUT_OF_ORDER_COMPARATOR_H_
+#define UVM_OUT_OF_ORDER_COMPARATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <systemc>
+
+#include "uvmsc/comps/uvm_comparator.h"
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_out_of_order_comparator
+//
+//! Compares two streams of transactions which may arrive in a different
+//! order. Each transaction is looked up by the key returned by the KEY
+//! policy among the transactions waiting on the other export, and matched
+//! with the oldest one which compares equal using the COMP policy; CONVERT
+//! formats the transactions in messages.
+//!
+//! By default the key is only used to find candidates, so keys may
+//! collide, as with a hash of the contents: a transaction without an equal
+//! candidate waits for a match. When the key identifies the transaction,
+//! such as a tag or an address, enable #set_unique_keys, so that a
+//! transaction is compared with the oldest candidate and a difference is
+//! reported as a mismatch.
+//!
+//! The number of transactions waiting for a match can be bounded with
+//! #set_max_outstanding; the oldest transaction is then dropped and counted
+//! as a mismatch when the bound is exceeded.
+//------------------------------------------------------------------------------
+
+template < typename T,
+           typename KEY = uvm_built_in_key<T>,
+           typename COMP = uvm_built_in_comp<T>,
+           typename CONVERT = uvm_built_in_converter<T> >
+class uvm_out_of_order_comparator : public uvm_comparator_base<T, CONVERT>
+{
+ public:
+  explicit uvm_out_of_order_comparator( uvm_component_name name_ )
+  : uvm_comparator_base<T, CONVERT>( name_ ),
+    m_unique_keys(false),
+    m_max_outstanding(0),
+    m_seq(0)
+  {}
+
+  virtual void write_before( const T& t )
+  {
+    m_write(t, m_before, m_after, true);
+  }
+
+  virtual void write_after( const T& t )
+  {
+    m_write(t, m_after, m_before, false);
+  }
+
+  virtual unsigned long get_outstanding() const
+  {
+    return m_before.count + m_after.count;
+  }
+
+  virtual void flush()
+  {
+    m_before.clear();
+    m_after.clear();
+    uvm_comparator_base<T, CONVERT>::flush();
+  }
+
+  //----------------------------------------------------------------------
+  // member functions: set_unique_keys, get_unique_keys
+  //
+  //! When set, a key identifies a transaction: a transaction is compared
+  //! with the oldest waiting transaction with the same key, and a
+  //! difference is a mismatch. When not set (default), a transaction is
+  //! matched with the oldest waiting transaction with the same key which
+  //! compares equal, if any.
+  //----------------------------------------------------------------------
+
+  void set_unique_keys( bool unique = true )
+  {
+    m_unique_keys = unique;
+  }
+
+  bool get_unique_keys() const
+  {
+    return m_unique_keys;
+  }
+
+  //----------------------------------------------------------------------
+  // member functions: set_max_outstanding, get_max_outstanding
+  //
+  //! Sets the largest number of transactions waiting for a match on both
+  //! exports together. Value 0 (default) means unbounded.
+  //----------------------------------------------------------------------
+
+  void set_max_outstanding( unsigned long n )
+  {
+    m_max_outstanding = n;
+    m_enforce_window();
+  }
+
+  unsigned long get_max_outstanding() const
+  {
+    return m_max_outstanding;
+  }
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_out_of_order_comparator";
+  }
+
+ private:
+
+  struct m_entry
+  {
+    T item;
+    sc_core::sc_time time;
+    sc_dt::uint64 seq; // arrival number, unique over both exports
+  };
+
+  // a transaction waiting on one export, in the list of the transactions
+  // waiting with the same key
+  struct m_node
+  {
+    m_entry entry;
+    sc_dt::uint64 key;
+    std::size_t next; // next node with the same key, in arrival order
+    bool live;
+  };
+
+  // the first and last node of the list of a key; a slot of the hash table
+  struct m_key_list
+  {
+    sc_dt::uint64 key;
+    std::size_t head; // m_side::none() if the slot is empty
+    std::size_t tail;
+  };
+
+  // the transactions waiting on one export, and their nodes in arrival
+  // order. The lists of the keys are found in an open addressing hash
+  // table, and their nodes are kept in a single array and reused, so that
+  // a transaction is matched or stored without allocation in most cases.
+  // Matched transactions are removed from the arrival order lazily, when
+  // they reach its front or when it is compacted.
+  struct m_side
+  {
+    std::vector<m_key_list> table;
+    std::size_t num_keys;
+    std::vector<m_node> nodes;
+    std::vector<std::size_t> free_nodes;
+    std::deque<std::pair<std::size_t, sc_dt::uint64> > order; // node, seq
+    unsigned long count;
+
+    m_side() : table(16, empty_slot()), num_keys(0), count(0) {}
+
+    static std::size_t none()
+    {
+      return ~std::size_t(0);
+    }
+
+    static m_key_list empty_slot()
+    {
+      m_key_list slot;
+      slot.key = 0;
+      slot.head = none();
+      slot.tail = none();
+      return slot;
+    }
+
+    static std::size_t hash( sc_dt::uint64 key )
+    {
+      // keys are often small values or aligned addresses; mix all bits
+      // into the low ones, which select the slot
+      sc_dt::uint64 h = key * ((sc_dt::uint64(0x9e3779b9) << 32) | 0x7f4a7c15);
+      return static_cast<std::size_t>(h ^ (h >> 29));
+    }
+
+    void clear()
+    {
+      std::fill(table.begin(), table.end(), empty_slot());
+      num_keys = 0;
+      nodes.clear();
+      free_nodes.clear();
+      order.clear();
+      count = 0;
+    }
+
+    bool is_live( std::size_t node, sc_dt::uint64 seq ) const
+    {
+      return nodes[node].live && nodes[node].entry.seq == seq;
+    }
+
+    // slot which holds the list of key, or the empty slot where it would
+    // be inserted
+    std::size_t find( sc_dt::uint64 key ) const
+    {
+      std::size_t mask = table.size() - 1;
+      std::size_t i = hash(key) & mask;
+      while (table[i].head != none() && table[i].key != key)
+        i = (i + 1) & mask;
+      return i;
+    }
+
+    void push_back( sc_dt::uint64 key, const m_entry& entry )
+    {
+      if (2 * (num_keys + 1) > table.size())
+        grow();
+
+      std::size_t n;
+      if (free_nodes.empty())
+      {
+        n = nodes.size();
+        nodes.push_back(m_node());
+      }
+      else
+      {
+        n = free_nodes.back();
+        free_nodes.pop_back();
+      }
+
+      nodes[n].entry = entry;
+      nodes[n].key = key;
+      nodes[n].next = none();
+      nodes[n].live = true;
+
+      std::size_t i = find(key);
+      if (table[i].head == none())
+      {
+        table[i].key = key;
+        table[i].head = n;
+        num_keys++;
+      }
+      else
+        nodes[table[i].tail].next = n;
+      table[i].tail = n;
+
+      order.push_back(std::make_pair(n, entry.seq));
+      count++;
+    }
+
+    // removes node n, which follows node prev (none() for the first node)
+    // in the list of slot i
+    void remove( std::size_t i, std::size_t prev, std::size_t n )
+    {
+      std::size_t next = nodes[n].next;
+      if (prev == none())
+        table[i].head = next;
+      else
+        nodes[prev].next = next;
+      if (table[i].tail == n)
+        table[i].tail = prev;
+
+      nodes[n].live = false;
+      nodes[n].entry.item = T(); // releases what the transaction holds
+      free_nodes.push_back(n);
+      count--;
+
+      if (table[i].head == none())
+        erase_slot(i);
+    }
+
+    // empties slot i, and moves the slots after it back in the probe
+    // sequence, so that no deleted markers are needed
+    void erase_slot( std::size_t i )
+    {
+      std::size_t mask = table.size() - 1;
+      std::size_t j = i;
+      while (true)
+      {
+        table[i] = empty_slot();
+
+        // find the next slot which may move into the empty slot i
+        while (true)
+        {
+          j = (j + 1) & mask;
+          if (table[j].head == none())
+          {
+            num_keys--;
+            return;
+          }
+          std::size_t home = hash(table[j].key) & mask;
+          if (((j - home) & mask) >= ((j - i) & mask))
+            break;
+        }
+
+        table[i] = table[j];
+        i = j;
+      }
+    }
+
+    void grow()
+    {
+      std::vector<m_key_list> old(2 * table.size(), empty_slot());
+      old.swap(table);
+      for (std::size_t i = 0; i < old.size(); i++)
+        if (old[i].head != none())
+          table[find(old[i].key)] = old[i];
+    }
+
+    // drops matched transactions from the front of the arrival order
+    void trim()
+    {
+      while (!order.empty() && !is_live(order.front().first, order.front().second))
+        order.pop_front();
+    }
+
+    // drops all matched transactions from the arrival order, once they
+    // outnumber the waiting ones
+    void compact()
+    {
+      if (order.size() < 2 * count + 16)
+        return;
+
+      std::deque<std::pair<std::size_t, sc_dt::uint64> > live;
+      for (std::size_t i = 0; i < order.size(); i++)
+        if (is_live(order[i].first, order[i].second))
+          live.push_back(order[i]);
+      order.swap(live);
+    }
+  };
+
+  void m_write( const T& t, m_side& own, m_side& other, bool before )
+  {
+    sc_dt::uint64 key = KEY::key(t);
+    std::size_t i = other.find(key);
+    std::size_t prev = m_side::none();
+    std::size_t n = other.table[i].head;
+
+    if (!m_unique_keys)
+      while (n != m_side::none() && !COMP::comp(other.nodes[n].entry.item, t))
+      {
+        prev = n;
+        n = other.nodes[n].next;
+      }
+
+    if (n != m_side::none())
+    {
+      const m_entry& e = other.nodes[n].entry;
+      bool equal = m_unique_keys ? COMP::comp(e.item, t) : true;
+
+      if (before)
+        this->m_compared(equal, t, e.item, e.time);
+      else
+        this->m_compared(equal, e.item, t, e.time);
+
+      other.remove(i, prev, n);
+      other.compact();
+      return;
+    }
+
+    m_entry entry;
+    entry.item = t;
+    entry.time = sc_core::sc_time_stamp();
+    entry.seq = m_seq++;
+
+    own.push_back(key, entry);
+
+    m_enforce_window();
+    this->m_sample_outstanding();
+  }
+
+  // drops the oldest transactions while the window is exceeded
+  void m_enforce_window()
+  {
+    if (m_max_outstanding == 0)
+      return;
+
+    while (get_outstanding() > m_max_outstanding)
+    {
+      m_before.trim();
+      m_after.trim();
+
+      bool before = m_after.order.empty() ||
+        (!m_before.order.empty() && m_before.order.front().second < m_after.order.front().second);
+      m_side& side = before ? m_before : m_after;
+
+      // the oldest transaction of a side is the first of its key
+      std::size_t n = side.order.front().first;
+      this->m_dropped(side.nodes[n].entry.item, before);
+
+      side.order.pop_front();
+      side.remove(side.find(side.nodes[n].key), m_side::none(), n);
+    }
+  }
+
+  bool m_unique_keys;
+  unsigned long m_max_outstanding;
+  sc_dt::uint64 m_seq;
+
+  m_side m_before;
+  m_side m_after;
+
+}; // class uvm_out_of_order_comparator
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_out_of_order_built_in_comparator
+//
+//! Out-of-order comparator for integral types, keyed by their value and
+//! compared with operator==.
+//------------------------------------------------------------------------------
+
+template <typename T = int>
+class uvm_out_of_order_built_in_comparator : public uvm_out_of_order_comparator<T>
+{
+ public:
+  explicit uvm_out_of_order_built_in_comparator( uvm_component_name name_ )
+  : uvm_out_of_order_comparator<T>( name_ )
+  {}
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_out_of_order_built_in_comparator";
+  }
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_out_of_order_class_comparator
+//
+//! Out-of-order comparator for transactions derived from #uvm_object, keyed
+//! by their content hash (uvm_object::hash), compared with
+//! uvm_object::compare and formatted with uvm_object::convert2string.
+//! The hash must cover the same fields as do_compare; see #uvm_class_key.
+//! Provide a KEY policy returning the tag of the transaction to match on
+//! the tag instead.
+//------------------------------------------------------------------------------
+
+template < typename T, typename KEY = uvm_class_key<T> >
+class uvm_out_of_order_class_comparator
+  : public uvm_out_of_order_comparator< T, KEY, uvm_class_comp<T>, uvm_class_converter<T> >
+{
+ public:
+  explicit uvm_out_of_order_class_comparator( uvm_component_name name_ )
+  : uvm_out_of_order_comparator< T, KEY, uvm_class_comp<T>, uvm_class_converter<T> >( name_ )
+  {}
+
+  virtual const char* kind() const // SystemC API
+  {
+    return "uvm::uvm_out_of_order_class_comparator";
+  }
+};
+
+} /* namespace uvm */
+
+#endif /* UVM_OUT_OF_ORDER_COMPARATOR_H_ */
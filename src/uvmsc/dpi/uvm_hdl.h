@@ -34,6 +34,7 @@
 #include <sstream>
 
 #include "uvmsc/base/uvm_globals.h"
+#include "uvmsc/macros/uvm_message_defines.h"
 
 #include "uvmsc/reg/uvm_sc_reg.h"
 
@@ -90,9 +91,9 @@ bool uvm_hdl_deposit( const std::string& path, const T& value )
   if (reg != NULL)
   {
     reg->write(value, idx_start, idx_stop);
-    std::ostringstream str;
-    str << "Value 0x" << std::hex << value << " written to register " << path << ".";
-    uvm_report_info("HDL_DEPOSIT", str.str(), uvm::UVM_FULL);
+    UVM_INFO_STREAM("HDL_DEPOSIT",
+        "Value 0x" << std::hex << value << " written to register " << path << ".",
+        uvm::UVM_FULL);
     return true;
   }
 
@@ -100,9 +101,9 @@ bool uvm_hdl_deposit( const std::string& path, const T& value )
   if (sig != NULL)
   {
     sig->write(value);
-    std::ostringstream str;
-    str << "Value 0x" << std::hex << value << " written to signal " << path << ".";
-    uvm_report_info("HDL_DEPOSIT", str.str(), uvm::UVM_FULL);
+    UVM_INFO_STREAM("HDL_DEPOSIT",
+        "Value 0x" << std::hex << value << " written to signal " << path << ".",
+        uvm::UVM_FULL);
     return true;
   }
 
@@ -110,9 +111,9 @@ bool uvm_hdl_deposit( const std::string& path, const T& value )
   if (sig_md != NULL)
   {
     sig_md->write(value);
-    std::ostringstream str;
-    str << "Value 0x" << std::hex << value << " written to signal " << path << ".";
-    uvm_report_info("HDL_DEPOSIT", str.str(), uvm::UVM_FULL);
+    UVM_INFO_STREAM("HDL_DEPOSIT",
+        "Value 0x" << std::hex << value << " written to signal " << path << ".",
+        uvm::UVM_FULL);
     return true;
   }
 
@@ -196,9 +197,9 @@ bool uvm_hdl_read( const std::string& path, T& value )
   if (reg != NULL)
   {
     value = reg->read(idx_start, idx_stop);
-    std::ostringstream str;
-    str << "Value 0x" << std::hex << value << " read from register " << path << ".";
-    uvm_report_info("HDL_READ", str.str(), uvm::UVM_FULL);
+    UVM_INFO_STREAM("HDL_READ",
+        "Value 0x" << std::hex << value << " read from register " << path << ".",
+        uvm::UVM_FULL);
     return true;
   }
 
@@ -206,9 +207,9 @@ bool uvm_hdl_read( const std::string& path, T& value )
   if (sig != NULL)
   {
     value = sig->read();
-    std::ostringstream str;
-    str << "Value 0x" << std::hex << value << " read from signal " << path << ".";
-    uvm_report_info("HDL_READ", str.str(), uvm::UVM_FULL);
+    UVM_INFO_STREAM("HDL_READ",
+        "Value 0x" << std::hex << value << " read from signal " << path << ".",
+        uvm::UVM_FULL);
     return true;
   }
 
@@ -216,9 +217,9 @@ bool uvm_hdl_read( const std::string& path, T& value )
   if (sig_md != NULL)
   {
     value = sig_md->read();
-    std::ostringstream str;
-    str << "Value 0x" << std::hex << value << " read from signal " << path << ".";
-    uvm_report_info("HDL_READ", str.str(), uvm::UVM_FULL);
+    UVM_INFO_STREAM("HDL_READ",
+        "Value 0x" << std::hex << value << " read from signal " << path << ".",
+        uvm::UVM_FULL);
     return true;
   }
 
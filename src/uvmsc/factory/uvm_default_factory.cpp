@@ -1223,13 +1223,13 @@ bool uvm_default_factory::check_inst_override_exists( uvm_object_wrapper* origin
         override->ovrd_type == override_type &&
         override->orig_type_name == original_type->get_type_name())
     {
-      std::ostringstream msg;
-      msg << "Instance override for '" << original_type->get_type_name()
+      UVM_INFO_STREAM("DUPOVRD",
+          "Instance override for '" << original_type->get_type_name()
           << "' already exists: override type '"
           << override_type->get_type_name()
           << "' with full_inst_path '" << full_inst_path
-          << "'";
-      uvm_report_info("DUPOVRD", msg.str(), UVM_HIGH);
+          << "'",
+          UVM_HIGH);
       return true;
     }
   }
@@ -23,6 +23,10 @@
 #ifndef UVM_MESSAGE_DEFINES_H_
 #define UVM_MESSAGE_DEFINES_H_
 
+#include <sstream>
+
+#include "uvmsc/report/uvm_report_profiler.h"
+
 //----------------------------------------------------------------------
 // Some generic defines which are used for all reporting macros
 //----------------------------------------------------------------------
@@ -52,6 +56,30 @@
 #define UVM_LINE_M __LINE__
 #endif
 
+//----------------------------------------------------------------------
+// MACRO: UVM_MAX_VERBOSITY
+//
+//! Optional compile-time ceiling for the verbosity of UVM_INFO messages.
+//! When defined, e.g. with -DUVM_MAX_VERBOSITY=200, the UVM_INFO macros
+//! with a constant verbosity above the ceiling compile to nothing: neither
+//! the id nor the message are evaluated. Use a numeric value, or a fully
+//! qualified name such as ::uvm::UVM_MEDIUM. Warnings, errors and fatals
+//! are not affected. To remove the debug messages of the library itself,
+//! build the library with the same definition.
+//----------------------------------------------------------------------
+
+// tells the report profiler the call site of the verbosity check which
+// follows; always true
+#define UVM_REPORT_SITE_M \
+  ::uvm::uvm_report_profiler::m_at(UVM_FILE_M, UVM_LINE_M)
+
+#ifdef UVM_MAX_VERBOSITY
+#define UVM_VERBOSITY_ALLOWED_M(VERBOSITY) \
+  ((int)(VERBOSITY) <= (int)(UVM_MAX_VERBOSITY))
+#else
+#define UVM_VERBOSITY_ALLOWED_M(VERBOSITY) true
+#endif
+
 //----------------------------------------------------------------------
 // MACRO: UVM_INFO
 //
@@ -62,7 +90,8 @@
 //----------------------------------------------------------------------
 
 #define UVM_INFO(ID,MSG,VERBOSITY) \
-  if (uvm_report_enabled(VERBOSITY, ::uvm::UVM_INFO, ID)) \
+  if (UVM_VERBOSITY_ALLOWED_M(VERBOSITY) && \
+      UVM_REPORT_SITE_M && uvm_report_enabled(VERBOSITY, ::uvm::UVM_INFO, ID)) \
     uvm_report_info(ID, MSG, VERBOSITY, UVM_FILE_M, UVM_LINE_M, "", 1)
 
 //----------------------------------------------------------------------
@@ -76,7 +105,7 @@
 //----------------------------------------------------------------------
 
 #define UVM_WARNING(ID,MSG) \
-  if (uvm_report_enabled((int)::uvm::UVM_NONE, ::uvm::UVM_WARNING, std::string(ID))) \
+  if (UVM_REPORT_SITE_M && uvm_report_enabled((int)::uvm::UVM_NONE, ::uvm::UVM_WARNING, std::string(ID))) \
     uvm_report_warning(ID, MSG, ::uvm::UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1)
 
 
@@ -91,7 +120,7 @@
 //----------------------------------------------------------------------
 
 #define UVM_ERROR(ID,MSG) \
-  if (uvm_report_enabled(::uvm::UVM_NONE, ::uvm::UVM_ERROR, ID)) \
+  if (UVM_REPORT_SITE_M && uvm_report_enabled(::uvm::UVM_NONE, ::uvm::UVM_ERROR, ID)) \
     uvm_report_error(ID, MSG, ::uvm::UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1)
 
 //----------------------------------------------------------------------
@@ -105,9 +134,80 @@
 //----------------------------------------------------------------------
 
 #define UVM_FATAL(ID,MSG) \
-  if (uvm_report_enabled(::uvm::UVM_NONE, ::uvm::UVM_FATAL, ID))\
+  if (UVM_REPORT_SITE_M && uvm_report_enabled(::uvm::UVM_NONE, ::uvm::UVM_FATAL, ID))\
     uvm_report_fatal(ID, MSG, ::uvm::UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1)
 
+//----------------------------------------------------------------------
+// MACRO: UVM_INFO_STREAM
+//
+//! Operates identically to UVM_INFO, but \p MSG is a stream expression
+//! such as <tt>"value = " << std::hex << v</tt>. The expression is only
+//! formatted when the message passes #uvm_report_enabled, so filtered
+//! messages do not pay for building the string.
+//----------------------------------------------------------------------
+
+#define UVM_INFO_STREAM(ID,MSG,VERBOSITY) \
+  do { \
+    if (UVM_VERBOSITY_ALLOWED_M(VERBOSITY) && \
+        UVM_REPORT_SITE_M && uvm_report_enabled(VERBOSITY, ::uvm::UVM_INFO, ID)) \
+    { \
+      std::ostringstream uvm_msg_str_; \
+      uvm_msg_str_ << MSG; \
+      uvm_report_info(ID, uvm_msg_str_.str(), VERBOSITY, UVM_FILE_M, UVM_LINE_M, "", 1); \
+    } \
+  } while (0)
+
+//----------------------------------------------------------------------
+// MACRO: UVM_WARNING_STREAM
+//
+//! Operates identically to UVM_WARNING, but \p MSG is a stream expression
+//! which is only formatted when the message is enabled.
+//----------------------------------------------------------------------
+
+#define UVM_WARNING_STREAM(ID,MSG) \
+  do { \
+    if (UVM_REPORT_SITE_M && uvm_report_enabled((int)::uvm::UVM_NONE, ::uvm::UVM_WARNING, std::string(ID))) \
+    { \
+      std::ostringstream uvm_msg_str_; \
+      uvm_msg_str_ << MSG; \
+      uvm_report_warning(ID, uvm_msg_str_.str(), ::uvm::UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1); \
+    } \
+  } while (0)
+
+//----------------------------------------------------------------------
+// MACRO: UVM_ERROR_STREAM
+//
+//! Operates identically to UVM_ERROR, but \p MSG is a stream expression
+//! which is only formatted when the message is enabled.
+//----------------------------------------------------------------------
+
+#define UVM_ERROR_STREAM(ID,MSG) \
+  do { \
+    if (UVM_REPORT_SITE_M && uvm_report_enabled(::uvm::UVM_NONE, ::uvm::UVM_ERROR, ID)) \
+    { \
+      std::ostringstream uvm_msg_str_; \
+      uvm_msg_str_ << MSG; \
+      uvm_report_error(ID, uvm_msg_str_.str(), ::uvm::UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1); \
+    } \
+  } while (0)
+
+//----------------------------------------------------------------------
+// MACRO: UVM_FATAL_STREAM
+//
+//! Operates identically to UVM_FATAL, but \p MSG is a stream expression
+//! which is only formatted when the message is enabled.
+//----------------------------------------------------------------------
+
+#define UVM_FATAL_STREAM(ID,MSG) \
+  do { \
+    if (UVM_REPORT_SITE_M && uvm_report_enabled(::uvm::UVM_NONE, ::uvm::UVM_FATAL, ID)) \
+    { \
+      std::ostringstream uvm_msg_str_; \
+      uvm_msg_str_ << MSG; \
+      uvm_report_fatal(ID, uvm_msg_str_.str(), ::uvm::UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1); \
+    } \
+  } while (0)
+
 //----------------------------------------------------------------------
 // MACRO: UVM_INFO_CONTEXT
 //
@@ -118,7 +218,8 @@
 
 #define UVM_INFO_CONTEXT(ID, MSG, VERBOSITY, RO) \
    { \
-     if (RO->uvm_report_enabled(VERBOSITY,UVM_INFO,ID)) \
+     if (UVM_VERBOSITY_ALLOWED_M(VERBOSITY) && \
+         UVM_REPORT_SITE_M && RO->uvm_report_enabled(VERBOSITY,UVM_INFO,ID)) \
       RO->uvm_report_info(ID, MSG, VERBOSITY, UVM_FILE_M, UVM_LINE_M, "", 1); \
    }
 
@@ -132,7 +233,7 @@
 
 #define UVM_WARNING_CONTEXT(ID, MSG, RO) \
    { \
-     if (RO->uvm_report_enabled(UVM_NONE,UVM_WARNING,ID)) \
+     if (UVM_REPORT_SITE_M && RO->uvm_report_enabled(UVM_NONE,UVM_WARNING,ID)) \
        RO->uvm_report_warning (ID, MSG, UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1); \
    }
 
@@ -147,7 +248,7 @@
 
 #define UVM_ERROR_CONTEXT(ID, MSG, RO) \
    { \
-     if (RO->uvm_report_enabled(UVM_NONE,UVM_ERROR,ID)) \
+     if (UVM_REPORT_SITE_M && RO->uvm_report_enabled(UVM_NONE,UVM_ERROR,ID)) \
        RO->uvm_report_error(ID, MSG, UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1); \
    }
 
@@ -162,7 +263,7 @@
 
 #define UVM_FATAL_CONTEXT(ID, MSG, RO) \
    { \
-     if (RO->uvm_report_enabled(UVM_NONE,UVM_FATAL,ID)) \
+     if (UVM_REPORT_SITE_M && RO->uvm_report_enabled(UVM_NONE,UVM_FATAL,ID)) \
        RO->uvm_report_fatal(ID, MSG, UVM_NONE, UVM_FILE_M, UVM_LINE_M, "", 1); \
    }
 
@@ -26,6 +26,7 @@
 #include "uvmsc/misc/uvm_scope_stack.h"
 #include "uvmsc/misc/uvm_status_container.h"
 #include "uvmsc/misc/uvm_copy_map.h"
+#include "uvmsc/misc/uvm_random_stream.h"
 
 //////////////
 
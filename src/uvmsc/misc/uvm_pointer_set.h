@@ -0,0 +1,156 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_POINTER_SET_H_
+#define UVM_POINTER_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+//////////////
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_pointer_set
+//
+//! Internal class holding a set of object addresses, or of pairs of object
+//! addresses, used for cycle detection. The set is an open addressing hash
+//! table in a single array, so that membership tests and updates do not
+//! allocate, and clearing an empty set is cheap. A single address \p p is
+//! stored as the pair (\p p, NULL).
+//------------------------------------------------------------------------------
+
+class uvm_pointer_set
+{
+ public:
+  typedef std::pair<const void*, const void*> entryT;
+
+  uvm_pointer_set() : m_table(16, entryT(NULL, NULL)), m_size(0)
+  {}
+
+  //! Adds the pair (\p p, \p q) to the set. Returns false if it was
+  //! already present.
+  bool insert( const void* p, const void* q = NULL )
+  {
+    if (2 * (m_size + 1) > m_table.size())
+      m_grow();
+
+    entryT e(p, q);
+    std::size_t i = m_slot(e);
+    if (m_table[i] == e)
+      return false;
+
+    m_table[i] = e;
+    m_size++;
+    return true;
+  }
+
+  bool contains( const void* p, const void* q = NULL ) const
+  {
+    entryT e(p, q);
+    return m_table[m_slot(e)] == e;
+  }
+
+  //! Removes the pair (\p p, \p q) from the set, and moves the entries
+  //! after it back in the probe sequence, so that no deleted markers are
+  //! needed.
+  void erase( const void* p, const void* q = NULL )
+  {
+    entryT e(p, q);
+    std::size_t i = m_slot(e);
+    if (m_table[i] != e)
+      return;
+
+    std::size_t mask = m_table.size() - 1;
+    std::size_t j = i;
+    while (true)
+    {
+      m_table[i] = entryT(NULL, NULL);
+
+      // find the next entry which may move into the empty slot i
+      while (true)
+      {
+        j = (j + 1) & mask;
+        if (m_table[j].first == NULL)
+        {
+          m_size--;
+          return;
+        }
+        std::size_t home = m_hash(m_table[j]) & mask;
+        if (((j - home) & mask) >= ((j - i) & mask))
+          break;
+      }
+
+      m_table[i] = m_table[j];
+      i = j;
+    }
+  }
+
+  void clear()
+  {
+    if (m_size == 0)
+      return;
+    std::fill(m_table.begin(), m_table.end(), entryT(NULL, NULL));
+    m_size = 0;
+  }
+
+  std::size_t size() const
+  {
+    return m_size;
+  }
+
+ private:
+  static std::size_t m_hash( const entryT& e )
+  {
+    // objects are at least 8-byte aligned; mix the remaining bits
+    std::size_t h = (reinterpret_cast<std::size_t>(e.first) >> 3) ^
+                    (reinterpret_cast<std::size_t>(e.second) >> 3) * 31;
+    return h ^ (h >> 7) ^ (h >> 17);
+  }
+
+  // slot which holds e, or the empty slot where e would be inserted
+  std::size_t m_slot( const entryT& e ) const
+  {
+    std::size_t mask = m_table.size() - 1;
+    std::size_t i = m_hash(e) & mask;
+    while (m_table[i].first != NULL && m_table[i] != e)
+      i = (i + 1) & mask;
+    return i;
+  }
+
+  void m_grow()
+  {
+    std::vector<entryT> old(2 * m_table.size(), entryT(NULL, NULL));
+    old.swap(m_table);
+    for (std::size_t i = 0; i < old.size(); i++)
+      if (old[i].first != NULL)
+        m_table[m_slot(old[i])] = old[i];
+  }
+
+  std::vector<entryT> m_table;
+  std::size_t m_size;
+
+}; // class uvm_pointer_set
+
+} // namespace uvm
+
+#endif /* UVM_POINTER_SET_H_ */
@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include "uvmsc/misc/uvm_random_stream.h"
+
+//////////////
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// static data member initialization
+//------------------------------------------------------------------------------
+
+unsigned int uvm_random_stream::m_global_seed = 1;
+
+//----------------------------------------------------------------------------
+// Class: uvm_random_stream - implementation
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Constructor
+//
+//! Creates a stream which is seeded from the global seed only. Use member
+//! function #reseed to derive the state from a name.
+//----------------------------------------------------------------------------
+
+uvm_random_stream::uvm_random_stream()
+{
+  set_state(m_global_seed);
+  m_seeded = false;
+}
+
+//----------------------------------------------------------------------------
+// Constructor
+//
+//! Creates a stream seeded from \p name and the global seed
+//----------------------------------------------------------------------------
+
+uvm_random_stream::uvm_random_stream( const std::string& name )
+{
+  reseed(name);
+}
+
+//----------------------------------------------------------------------------
+// member function: reseed
+//
+//! Derives the state of the stream from \p name and the global seed.
+//! Streams with the same name and global seed produce the same sequence
+//! of numbers.
+//----------------------------------------------------------------------------
+
+void uvm_random_stream::reseed( const std::string& name )
+{
+  // FNV-1a hash of the name, folded with the global seed
+  unsigned int hash = 2166136261U;
+
+  for (std::string::size_type i = 0; i < name.size(); i++)
+  {
+    hash ^= (unsigned char)name[i];
+    hash *= 16777619U;
+  }
+
+  set_state(hash ^ (m_global_seed * 0x9e3779b9U));
+  m_seeded = true;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_state
+//
+//! Initializes the state of the stream from a single 32-bit seed, using
+//! a splitmix-style mixing function so that similar seeds give
+//! uncorrelated streams
+//----------------------------------------------------------------------------
+
+void uvm_random_stream::set_state( unsigned int seed )
+{
+  unsigned int z = seed;
+
+  for (int i = 0; i < 4; i++)
+  {
+    z += 0x9e3779b9U;
+    unsigned int x = z;
+    x = (x ^ (x >> 16)) * 0x85ebca6bU;
+    x = (x ^ (x >> 13)) * 0xc2b2ae35U;
+    m_state[i] = x ^ (x >> 16);
+  }
+
+  // the all-zero state is the only invalid state of the generator
+  if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0)
+    m_state[0] = 1;
+
+  m_seeded = true;
+}
+
+//----------------------------------------------------------------------------
+// member function: is_seeded
+//
+//! Returns true if the stream was seeded by #reseed or #set_state
+//----------------------------------------------------------------------------
+
+bool uvm_random_stream::is_seeded() const
+{
+  return m_seeded;
+}
+
+//----------------------------------------------------------------------------
+// member function: urandom_range
+//
+//! Returns an unbiased pseudo-random number in the inclusive range
+//! [\p min, \p max]. If \p min is larger than \p max, the arguments are
+//! swapped, as for the SystemVerilog $urandom_range.
+//----------------------------------------------------------------------------
+
+unsigned int uvm_random_stream::urandom_range( unsigned int max, unsigned int min )
+{
+  if (min > max)
+  {
+    unsigned int tmp = min;
+    min = max;
+    max = tmp;
+  }
+
+  const unsigned int span = max - min;
+
+  if (span == 0xffffffffU)
+    return urandom();
+
+  // reject the top partial bucket to avoid a modulo bias
+  const unsigned int range = span + 1;
+  const unsigned int limit = 0xffffffffU - (0xffffffffU % range + 1) % range;
+
+  unsigned int r;
+  do
+    r = urandom();
+  while (r > limit);
+
+  return min + r % range;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_global_seed (static)
+//
+//! Sets the global seed which is combined with the name of each stream.
+//! Only streams which are (re)seeded afterwards are affected.
+//----------------------------------------------------------------------------
+
+void uvm_random_stream::set_global_seed( unsigned int seed )
+{
+  m_global_seed = seed;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_global_seed (static)
+//
+//! Returns the global seed
+//----------------------------------------------------------------------------
+
+unsigned int uvm_random_stream::get_global_seed()
+{
+  return m_global_seed;
+}
+
+} // namespace uvm
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_RANDOM_STREAM_H_
+#define UVM_RANDOM_STREAM_H_
+
+#include <string>
+
+//////////////
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_random_stream
+//
+//! Implementation-defined class providing a private stream of pseudo-random
+//! numbers. The stream is based on the xoshiro128** generator, and is seeded
+//! from a name (typically the full hierarchical name of its owner) combined
+//! with a global seed. Each stream is therefore independent of the order in
+//! which other streams draw their numbers, and results stay reproducible
+//! when unrelated parts of the hierarchy change.
+//----------------------------------------------------------------------------
+
+class uvm_random_stream
+{
+ public:
+  uvm_random_stream();
+
+  explicit uvm_random_stream( const std::string& name );
+
+  void reseed( const std::string& name );
+
+  void set_state( unsigned int seed );
+
+  bool is_seeded() const;
+
+  unsigned int urandom();
+
+  unsigned int urandom_range( unsigned int max, unsigned int min = 0 );
+
+  static void set_global_seed( unsigned int seed );
+
+  static unsigned int get_global_seed();
+
+ private:
+  static unsigned int m_rotl( unsigned int x, int k );
+
+  unsigned int m_state[4];
+  bool m_seeded;
+
+  static unsigned int m_global_seed;
+
+}; // class uvm_random_stream
+
+//----------------------------------------------------------------------------
+// member function: urandom
+//
+//! Returns the next 32-bit pseudo-random number of the stream
+//----------------------------------------------------------------------------
+
+inline unsigned int uvm_random_stream::urandom()
+{
+  const unsigned int result = m_rotl(m_state[1] * 5U, 7) * 9U;
+  const unsigned int t = m_state[1] << 9;
+
+  m_state[2] ^= m_state[0];
+  m_state[3] ^= m_state[1];
+  m_state[1] ^= m_state[2];
+  m_state[0] ^= m_state[3];
+  m_state[2] ^= t;
+  m_state[3] = m_rotl(m_state[3], 11);
+
+  return result;
+}
+
+inline unsigned int uvm_random_stream::m_rotl( unsigned int x, int k )
+{
+  return (x << k) | (x >> (32 - k));
+}
+
+} // namespace uvm
+
+#endif /* UVM_RANDOM_STREAM_H_ */
@@ -65,13 +65,13 @@ void uvm_bottomup_phase::traverse( uvm_component* comp,
 
   if (m_phase_trace)
   {
-	std::ostringstream str;
-    str << "bottomup-phase phase = " << phase->get_name()  << std::endl
+    UVM_INFO_STREAM("PH_TRACE",
+        "bottomup-phase phase = " << phase->get_name()  << std::endl
         << " state = "  << uvm_phase_state_name[state]  << std::endl
         << " component name = " <<  comp->get_full_name()  << std::endl
         << " component domain = " << comp_domain->get_name()  << std::endl
-        << " phase domain = " << phase_domain->get_name();
-    UVM_INFO("PH_TRACE", str.str(), UVM_DEBUG);
+        << " phase domain = " << phase_domain->get_name(),
+        UVM_DEBUG);
   }
 
   if (phase_domain == uvm_domain::get_common_domain() ||
@@ -56,9 +56,9 @@ uvm_domain::uvm_domain( const std::string& name )
   }
   else
   {
-    std::ostringstream str;
-    str << "Create domain with name '" << name << "'...";
-    uvm_report_info("NEWDOMAIN", str.str(), UVM_DEBUG);
+    UVM_INFO_STREAM("NEWDOMAIN",
+        "Create domain with name '" << name << "'...",
+        UVM_DEBUG);
     m_domains()[name] = this;
   }
 }
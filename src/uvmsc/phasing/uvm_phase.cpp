@@ -42,12 +42,8 @@
 
 
 #define UVM_PH_TRACE(ID,MSG,PH,VERB) \
-{ \
-  std::ostringstream str;\
-  str << "Phase '" << PH->get_full_name() << "' (id = " \
-      << PH->get_inst_id() << ") " << MSG; \
-  UVM_INFO(ID, str.str(), VERB); \
-}
+  UVM_INFO_STREAM(ID, "Phase '" << PH->get_full_name() << "' (id = " \
+      << PH->get_inst_id() << ") " << MSG, VERB)
 
 using namespace sc_core;
 
@@ -1254,10 +1250,8 @@ void uvm_phase::execute_phase( bool proc )
 #if SYSTEMC_VERSION >= 20120701 // SystemC 2.3
       if (proc && m_phase_proc.valid())
       {
-        std::ostringstream str;
-        str << "kill master processes '" << m_phase_proc.name()
-            << "' for " << get_name() << " phase ";
-        UVM_PH_TRACE("PH_KILL", str.str(), this, UVM_DEBUG);
+        UVM_PH_TRACE("PH_KILL", "kill master processes '" << m_phase_proc.name()
+            << "' for " << get_name() << " phase ", this, UVM_DEBUG);
         m_phase_proc.kill(SC_INCLUDE_DESCENDANTS);
         sc_assert(m_phase_proc.terminated());
       }
@@ -1319,10 +1313,8 @@ void uvm_phase::execute_phase( bool proc )
 #if SYSTEMC_VERSION >= 20120701 // SystemC 2.3
     if (proc && m_phase_proc.valid())
     {
-      std::ostringstream str;
-      str << "kill master processes '" << m_phase_proc.name()
-          << "' for " << get_name() << " phase ";
-      UVM_PH_TRACE("PH_KILL", str.str(), this, UVM_DEBUG);
+      UVM_PH_TRACE("PH_KILL", "kill master processes '" << m_phase_proc.name()
+          << "' for " << get_name() << " phase ", this, UVM_DEBUG);
       m_phase_proc.kill(SC_INCLUDE_DESCENDANTS);
       sc_assert(m_phase_proc.terminated());
     }
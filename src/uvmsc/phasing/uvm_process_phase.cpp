@@ -80,13 +80,13 @@ void uvm_process_phase::m_traverse( uvm_component* comp,
 
   if (m_phase_trace)
   {
-    std::ostringstream str;
-    str << "process phase = " << phase->get_name() << std::endl
+    UVM_INFO_STREAM("PH_TRACE",
+        "process phase = " << phase->get_name() << std::endl
         << " state = "  << uvm_phase_state_name[state] << std::endl
         << " component = " <<  comp->get_full_name() << std::endl
         << " component domain = " << comp_domain->get_name() << std::endl
-        << " phase domain = " << phase_domain->get_name();
-    UVM_INFO("PH_TRACE", str.str(), UVM_DEBUG);
+        << " phase domain = " << phase_domain->get_name(),
+        UVM_DEBUG);
   }
 
   if (phase_domain == uvm_domain::get_common_domain() ||
@@ -147,31 +147,31 @@ void uvm_process_phase::kill( uvm_component* comp,
       m_proc_handle[comp].kill();
       m_proc_handle.erase(comp);
 
-      std::ostringstream str;
-      str << "Phase '" << phase->get_full_name() << "' (id = "
+      UVM_INFO_STREAM("PH_KILL",
+          "Phase '" << phase->get_full_name() << "' (id = "
           << phase->get_inst_id() << ") "
-          << "for component " << comp->get_full_name();
-      UVM_INFO("PH_KILL", str.str(), UVM_DEBUG);
+          << "for component " << comp->get_full_name(),
+          UVM_DEBUG);
     }
     else
     {
       // process already finished, remove from list
-      std::ostringstream str;
-      str << "Phase '" << phase->get_full_name() << "' (id = "
+      UVM_INFO_STREAM("PH_TERM",
+          "Phase '" << phase->get_full_name() << "' (id = "
           << phase->get_inst_id() << ") "
           << "for component " << comp->get_full_name()
-          << " already terminated.";
-      UVM_INFO("PH_TERM", str.str(), UVM_DEBUG);
+          << " already terminated.",
+          UVM_DEBUG);
 
       m_proc_handle.erase(comp);
     }
   }
   else
   {
-    std::ostringstream str;
-    str << "No valid process handle found to kill " << phase->get_name()
-        << " phase for component; process may have finished for " << comp->get_full_name();
-    UVM_INFO("PH_NOKILL", str.str(), UVM_DEBUG);
+    UVM_INFO_STREAM("PH_NOKILL",
+        "No valid process handle found to kill " << phase->get_name()
+        << " phase for component; process may have finished for " << comp->get_full_name(),
+        UVM_DEBUG);
   }
 
 #endif
@@ -204,11 +204,11 @@ void uvm_process_phase::execute( uvm_component* comp,
 
     comp->m_set_run_handle(m_proc_handle[comp]);
 
-    std::ostringstream str;
-    str << "Phase '" << phase->get_full_name() << "' (id = "
+    UVM_INFO_STREAM("PH_SPAWN",
+        "Phase '" << phase->get_full_name() << "' (id = "
         << phase->get_inst_id() << ") "
-        << "for component " << comp->get_full_name();
-    UVM_INFO("PH_SPAWN", str.str(), UVM_DEBUG);
+        << "for component " << comp->get_full_name(),
+        UVM_DEBUG);
   }
 }
 //----------------------------------------------------------------------
@@ -47,8 +47,12 @@ namespace uvm {
 //----------------------------------------------------------------------------
 
 uvm_comparer::uvm_comparer()
+: m_early_exit(false),
+  m_depth(0),
+  m_cycle(),
+  m_deferred()
 {
-  //uvm_recursion_policy_enum policy = UVM_DEFAULT_POLICY;
+  policy = UVM_DEFAULT_POLICY;
   show_max = true;
   verbosity = UVM_LOW;
   sev = UVM_INFO;
@@ -57,6 +61,7 @@ uvm_comparer::uvm_comparer()
   abstract = false;
   check_type = true;
   result = 0;
+  m_deferred.kind = m_deferred_miscompare::NONE;
 }
 
 //----------------------------------------------------------------------------
@@ -92,77 +97,43 @@ bool uvm_comparer::compare_field( const std::string& name,
                                   int size,
                                   uvm_radix_enum radix ) const
 {
-  uvm_bitstream_t mask;
-  std::ostringstream msg;
+  if (m_skip())
+    return false;
 
-  if(size > 4096)
+  if(size > UVM_MAX_STREAMBITS)
+  {
     uvm_report_info("COMP", "field size > 4096 not allowed", UVM_LOW);
+    size = UVM_MAX_STREAMBITS;
+  }
 
   if(size <= 64)
-    return compare_field_int(name, lhs, rhs, size, radix);
+    return compare_field_int(name, lhs.to_uint64(), rhs.to_uint64(), size, radix);
 
-  mask = -1;
-  mask >>= 4096-size; // was using UVM_STREAMBITS (=4096)
+  // compare 64 bits at a time, stopping at the first difference
+  bool equal = true;
+  for (int lo = 0; lo < size && equal; lo += 64)
+  {
+    int hi = (lo + 63 < size) ? lo + 63 : size - 1;
+    equal = (lhs.range(hi, lo).to_uint64() == rhs.range(hi, lo).to_uint64());
+  }
 
-  sc_lv<4096> lhs_masked = lhs&mask;
-  sc_lv<4096> rhs_masked = rhs&mask;
+  if (equal)
+    return true;
 
-  if ((lhs_masked) != (rhs_masked))
+  if (m_early_exit)
   {
-    uvm_object::__m_uvm_status_container->scope->set_arg(name);
-
-    switch (radix)
-    {
-      case UVM_BIN:
-      {
-        msg << "lhs = 0b" << lhs_masked.to_string(sc_dt::SC_BIN_US, true)
-            << " : rhs = 0b" << rhs_masked.to_string(sc_dt::SC_BIN_US, true);
-        break;
-      }
-      case UVM_OCT:
-      {
-        msg << "lhs = 0o" << std::oct << lhs_masked.to_string(sc_dt::SC_OCT_US, true)
-            << " : rhs = 0o" << std::oct << rhs_masked.to_string(sc_dt::SC_OCT_US, true);
-        break;
-      }
-      case UVM_DEC:
-      {
-        msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
-            << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
-        break;
-      }
-      case UVM_TIME: // TODO how to deal with time/sc_time?
-      {
-        msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
-            << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
-        break;
-      }
-      case UVM_STRING: // TODO printed as binary ??
-      {
-        msg << "lhs = 0b" << lhs_masked.to_string(sc_dt::SC_BIN_US, true)
-            << " : rhs = 0b" << rhs_masked.to_string(sc_dt::SC_BIN_US, true);
-        break;
-      }
-      case UVM_ENUM: // printed in decimal
-      {
-        // Printed as decimal, user should use compare string for enum val
-        msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
-            << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
-        break;
-      }
-      default: // default is printed in hex
-      {
-        msg << "lhs = 0x" << lhs_masked.to_string(sc_dt::SC_HEX_US, true)
-            << " : rhs = 0x" << rhs_masked.to_string(sc_dt::SC_HEX_US, true);
-        break;
-      }
-    } // switch
-
-    print_msg(msg.str());
+    m_deferred.kind = m_deferred_miscompare::BITS;
+    m_deferred.lhs_bits = lhs;
+    m_deferred.rhs_bits = rhs;
+    m_deferred.size = size;
+    m_deferred.radix = radix;
+    m_miscompare(name);
     return false;
   }
 
-  return true;
+  uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  print_msg(m_format_bits(lhs, rhs, size, radix));
+  return false;
 }
 
 
@@ -180,71 +151,34 @@ bool uvm_comparer::compare_field_int( const std::string& name,
                                       int size,
                                       uvm_radix_enum radix ) const
 {
-  sc_bv<64> mask;
-  std::ostringstream msg;
+  if (m_skip())
+    return false;
 
-  mask = -1;
-  mask >>= (64-size);
+  uint64 mask = 0;
+  if (size >= 64)
+    mask = ~uint64(0);
+  else if (size > 0)
+    mask = (uint64(1) << size) - 1;
 
-  sc_lv<64> lhs_masked = lhs & mask;
-  sc_lv<64> rhs_masked = rhs & mask;
+  uint64 lhs_masked = lhs.to_uint64() & mask;
+  uint64 rhs_masked = rhs.to_uint64() & mask;
 
-  if((lhs_masked) != (rhs_masked)) // TODO was !==
-  {
-    uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  if (lhs_masked == rhs_masked)
+    return true;
 
-    switch(radix)
-    {
-      case UVM_BIN:
-      {
-        msg << "lhs = 0b" << lhs_masked.to_string(sc_dt::SC_BIN_US, true)
-            << " : rhs = 0b" << rhs_masked.to_string(sc_dt::SC_BIN_US, true);
-        break;
-      }
-      case UVM_OCT:
-      {
-        msg << "lhs = 0o" << lhs_masked.to_string(sc_dt::SC_OCT_US, true)
-            << " : rhs = 0o" << rhs_masked.to_string(sc_dt::SC_OCT_US, true);
-        break;
-      }
-      case UVM_DEC:
-      {
-        msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
-            << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
-        break;
-      }
-      case UVM_TIME: // TODO how to deal with time/sc_time?
-      {
-        msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
-            << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
-        break;
-      }
-      case UVM_STRING: // show as bit string
-      {
-        msg << "lhs = 0b" << lhs_masked.to_string(sc_dt::SC_BIN_US, true)
-            << " : rhs = 0b" << rhs_masked.to_string(sc_dt::SC_BIN_US, true);
-        break;
-      }
-      case UVM_ENUM:
-      {
-        // Printed as decimal, user should use compare string for enum val
-        msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
-            << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
-        break;
-      }
-      default: // default shown as hex
-      {
-        msg << "lhs = 0x" << lhs_masked.to_string(sc_dt::SC_HEX_US, true)
-            << " : rhs = 0x" << rhs_masked.to_string(sc_dt::SC_HEX_US, true);
-        break;
-      }
-    } // switch
-
-    print_msg(msg.str());
+  if (m_early_exit)
+  {
+    m_deferred.kind = m_deferred_miscompare::INT;
+    m_deferred.lhs_int = lhs_masked;
+    m_deferred.rhs_int = rhs_masked;
+    m_deferred.radix = radix;
+    m_miscompare(name);
     return false;
-  } // if
+  }
 
-  return true;
+  uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  print_msg(m_format_int(lhs_masked, rhs_masked, radix));
+  return false;
 }
 
 
@@ -259,34 +193,52 @@ bool uvm_comparer::compare_field_real( const std::string& name,
                                        double lhs,
                                        double rhs ) const
 {
-  std::ostringstream msg;
+  if (m_skip())
+    return false;
 
-  if(lhs != rhs)
+  if(lhs == rhs)
+    return true;
+
+  if (m_early_exit)
   {
-    uvm_object::__m_uvm_status_container->scope->set_arg(name);
-    msg << "lhs = " << lhs << " : rhs = " << rhs;
-    print_msg(msg.str());
+    m_deferred.kind = m_deferred_miscompare::REAL;
+    m_deferred.lhs_real = lhs;
+    m_deferred.rhs_real = rhs;
+    m_miscompare(name);
     return false;
   }
 
-  return true;
+  std::ostringstream msg;
+  uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  msg << "lhs = " << lhs << " : rhs = " << rhs;
+  print_msg(msg.str());
+  return false;
 }
 
 bool uvm_comparer::compare_field_real( const std::string& name,
                                        float lhs,
                                        float rhs ) const
 {
-  std::ostringstream msg;
+  if (m_skip())
+    return false;
 
-  if(lhs != rhs)
+  if(lhs == rhs)
+    return true;
+
+  if (m_early_exit)
   {
-    uvm_object::__m_uvm_status_container->scope->set_arg(name);
-    msg << "lhs = " << lhs << " : rhs = " << rhs;
-    print_msg(msg.str());
+    m_deferred.kind = m_deferred_miscompare::REAL;
+    m_deferred.lhs_real = lhs;
+    m_deferred.rhs_real = rhs;
+    m_miscompare(name);
     return false;
   }
 
-  return true;
+  std::ostringstream msg;
+  uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  msg << "lhs = " << lhs << " : rhs = " << rhs;
+  print_msg(msg.str());
+  return false;
 }
 
 //----------------------------------------------------------------------------
@@ -299,29 +251,51 @@ bool uvm_comparer::compare_field_real( const std::string& name,
 //! The #check_type determines whether or not to verify the object
 //! types match (the return from lhs.get_type_name() matches
 //! rhs.get_type_name() ).
+//!
+//! A pair of objects which is reached again while it is being compared,
+//! through a cycle of references, is not compared a second time. The pair
+//! is the key, so an object shared by several fields of \p lhs is still
+//! compared against each of the corresponding objects of \p rhs.
 //----------------------------------------------------------------------------
 
 bool uvm_comparer::compare_object( const std::string& name,
                                    const uvm_object& lhs,
                                    const uvm_object& rhs) const
 {
-  bool result;
+  if (m_skip())
+    return false;
 
-  if (lhs.compare(rhs))
+  if (&lhs == &rhs)
     return true;
 
-  if (policy == UVM_REFERENCE && !(lhs.compare(rhs)))
+  if (policy == UVM_REFERENCE)
   {
+    if (m_early_exit)
+    {
+      m_deferred.kind = m_deferred_miscompare::OBJECT;
+      m_deferred.lhs_id = lhs.get_inst_id();
+      m_deferred.rhs_id = rhs.get_inst_id();
+      m_miscompare(name);
+      return false;
+    }
+
     uvm_object::__m_uvm_status_container->scope->set_arg(name);
     print_msg_object(lhs, rhs);
     return false;
   }
 
+  if (!m_cycle.insert(&lhs, &rhs))
+    return true;
+
   uvm_object::__m_uvm_status_container->scope->down(name);
-  result = lhs.compare(rhs, this);
+  m_depth++;
+  bool equal = lhs.compare(rhs, this);
+  m_depth--;
   uvm_object::__m_uvm_status_container->scope->up();
 
-  return result;
+  m_cycle.erase(&lhs, &rhs);
+
+  return equal;
 }
 
 
@@ -337,17 +311,26 @@ bool uvm_comparer::compare_string( const std::string& name,
                                    const std::string& lhs,
                                    const std::string& rhs) const
 {
-  std::ostringstream msg;
+  if (m_skip())
+    return false;
 
-  if(lhs != rhs)
+  if(lhs == rhs)
+    return true;
+
+  if (m_early_exit)
   {
-    uvm_object::__m_uvm_status_container->scope->set_arg(name);
-    msg << "lhs = \"" << lhs << "\" : rhs = \"" << rhs + "\"";
-    print_msg(msg.str());
+    m_deferred.kind = m_deferred_miscompare::STRING;
+    m_deferred.lhs_str = lhs;
+    m_deferred.rhs_str = rhs;
+    m_miscompare(name);
     return false;
   }
 
-  return true;
+  std::ostringstream msg;
+  uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  msg << "lhs = \"" << lhs << "\" : rhs = \"" << rhs + "\"";
+  print_msg(msg.str());
+  return false;
 }
 
 
@@ -400,8 +383,10 @@ void uvm_comparer::print_msg( const std::string& msg ) const
 //! or UVM_SHALLOW. The default policy shall be set to UVM_DEFAULT_POLICY.
 //----------------------------------------------------------------------------
 
-void uvm_comparer::set_policy( uvm_recursion_policy_enum policy )
-{}
+void uvm_comparer::set_policy( uvm_recursion_policy_enum _policy )
+{
+  policy = _policy;
+}
 
 //----------------------------------------------------------------------------
 // member function: get_policy
@@ -510,10 +495,17 @@ void uvm_comparer::set_miscompare_string( const std::string& _miscompares )
 //
 //! The member function get_miscompare_string shall return the last set
 //! of miscompares that occurred during a comparison.
+//! In early exit mode, the miscompare is formatted when this member
+//! function is called.
 //----------------------------------------------------------------------------
 
 std::string uvm_comparer::get_miscompare_string() const
 {
+  if (m_deferred.kind != m_deferred_miscompare::NONE)
+  {
+    miscompares = m_deferred.scope + ": " + m_deferred_msg();
+    m_deferred.kind = m_deferred_miscompare::NONE;
+  }
   return miscompares;
 }
 
@@ -592,6 +584,284 @@ unsigned int uvm_comparer::get_result() const
 uvm_comparer::~uvm_comparer()
 {}
 
+//----------------------------------------------------------------------------
+// member function: set_early_exit
+//
+//! Enables or disables the early exit mode. In this mode, all compare
+//! member functions return false without comparing once a miscompare was
+//! found, so that a comparison which only needs a boolean result stops
+//! at the first difference. The miscompare is counted in #result, but its
+//! message is only formatted when it is reported, see #set_max_messages,
+//! or when #get_miscompare_string is called; the #miscompares data member
+//! is not updated.
+//!
+//! uvm_object::compare resets the comparer when it starts. When the
+//! compare member functions are called directly, call #reset before each
+//! comparison, as they would otherwise be skipped after a miscompare of
+//! the previous one.
+//----------------------------------------------------------------------------
+
+void uvm_comparer::set_early_exit( bool enable )
+{
+  m_early_exit = enable;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_early_exit
+//
+//! Returns true if the early exit mode is enabled.
+//----------------------------------------------------------------------------
+
+bool uvm_comparer::get_early_exit() const
+{
+  return m_early_exit;
+}
+
+//----------------------------------------------------------------------------
+// member function: reset
+//
+//! Clears the result and the miscompares of the previous comparison, so
+//! that a new comparison starts. Only needed when the compare member
+//! functions are called directly, see #set_early_exit.
+//----------------------------------------------------------------------------
+
+void uvm_comparer::reset()
+{
+  m_reset();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_begin_compare
+//
+//! Implementation-defined member function
+//! Called by uvm_object::compare. Resets the result and the miscompares
+//! when a new comparison starts, and marks \p lhs and \p rhs as being
+//! compared.
+//----------------------------------------------------------------------------
+
+void uvm_comparer::m_begin_compare( const uvm_object& lhs,
+                                    const uvm_object& rhs ) const
+{
+  if (m_depth++ != 0)
+    return;
+
+  m_reset();
+  m_cycle.clear();
+  m_cycle.insert(&lhs, &rhs);
+}
+
+//----------------------------------------------------------------------------
+// member function: m_reset
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void uvm_comparer::m_reset() const
+{
+  result = 0;
+  miscompares = "";
+  m_deferred.kind = m_deferred_miscompare::NONE;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_end_compare
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void uvm_comparer::m_end_compare( const uvm_object& lhs,
+                                  const uvm_object& rhs ) const
+{
+  if (--m_depth == 0)
+    m_cycle.erase(&lhs, &rhs);
+}
+
+//----------------------------------------------------------------------------
+// member function: m_skip
+//
+//! Implementation-defined member function
+//! Returns true if the remaining fields need not be compared, because a
+//! miscompare was found in early exit mode.
+//----------------------------------------------------------------------------
+
+bool uvm_comparer::m_skip() const
+{
+  return m_early_exit && result != 0;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_miscompare
+//
+//! Implementation-defined member function
+//!
+//! Counts the miscompare of field \p name whose operands were stored in
+//! the deferred miscompare, and reports it if it is within #show_max.
+//! The message is only formatted when it is reported.
+//----------------------------------------------------------------------------
+
+void uvm_comparer::m_miscompare( const std::string& name ) const
+{
+  uvm_object::__m_uvm_status_container->scope->set_arg(name);
+  m_deferred.scope = uvm_object::__m_uvm_status_container->scope->get();
+
+  result++;
+
+  if(result <= show_max)
+  {
+    uvm_root* root = uvm_coreservice_t::get()->get_root();
+
+    std::ostringstream str;
+    str << "Miscompare for "
+        << m_deferred.scope
+        << ": "
+        << m_deferred_msg();
+
+    root->uvm_report(sev, "MISCMP", str.str(), UVM_LOW, UVM_FILE_M, UVM_LINE_M);
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: m_deferred_msg
+//
+//! Implementation-defined member function
+//! Formats the operands of the deferred miscompare.
+//----------------------------------------------------------------------------
+
+std::string uvm_comparer::m_deferred_msg() const
+{
+  std::ostringstream msg;
+
+  switch (m_deferred.kind)
+  {
+    case m_deferred_miscompare::INT:
+      return m_format_int(m_deferred.lhs_int, m_deferred.rhs_int, m_deferred.radix);
+    case m_deferred_miscompare::BITS:
+      return m_format_bits(m_deferred.lhs_bits, m_deferred.rhs_bits,
+                           m_deferred.size, m_deferred.radix);
+    case m_deferred_miscompare::REAL:
+      msg << "lhs = " << m_deferred.lhs_real << " : rhs = " << m_deferred.rhs_real;
+      break;
+    case m_deferred_miscompare::STRING:
+      msg << "lhs = \"" << m_deferred.lhs_str << "\" : rhs = \"" << m_deferred.rhs_str << "\"";
+      break;
+    case m_deferred_miscompare::OBJECT:
+      msg << "lhs = @" << m_deferred.lhs_id << ": rhs = @" << m_deferred.rhs_id;
+      break;
+    default:
+      break;
+  }
+
+  return msg.str();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_format_int (static)
+//
+//! Implementation-defined member function
+//! Formats the operands of a miscompare of at most 64 bits in \p radix.
+//! The operands are masked to the size of the field by the caller, and
+//! are shown as 64-bit values.
+//----------------------------------------------------------------------------
+
+std::string uvm_comparer::m_format_int( uint64 lhs,
+                                        uint64 rhs,
+                                        uvm_radix_enum radix )
+{
+  std::ostringstream msg;
+
+  sc_lv<64> lhs_masked = sc_uint<64>(lhs);
+  sc_lv<64> rhs_masked = sc_uint<64>(rhs);
+
+  switch(radix)
+  {
+    case UVM_BIN:
+    case UVM_STRING: // show as bit string
+    {
+      msg << "lhs = 0b" << lhs_masked.to_string(sc_dt::SC_BIN_US, true)
+          << " : rhs = 0b" << rhs_masked.to_string(sc_dt::SC_BIN_US, true);
+      break;
+    }
+    case UVM_OCT:
+    {
+      msg << "lhs = 0o" << lhs_masked.to_string(sc_dt::SC_OCT_US, true)
+          << " : rhs = 0o" << rhs_masked.to_string(sc_dt::SC_OCT_US, true);
+      break;
+    }
+    case UVM_DEC:
+    case UVM_TIME: // TODO how to deal with time/sc_time?
+    case UVM_ENUM: // printed as decimal, user should use compare string for enum val
+    {
+      msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
+          << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
+      break;
+    }
+    default: // default shown as hex
+    {
+      msg << "lhs = 0x" << lhs_masked.to_string(sc_dt::SC_HEX_US, true)
+          << " : rhs = 0x" << rhs_masked.to_string(sc_dt::SC_HEX_US, true);
+      break;
+    }
+  } // switch
+
+  return msg.str();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_format_bits (static)
+//
+//! Implementation-defined member function
+//! Formats the lower \p size bits of the operands of a miscompare in
+//! \p radix.
+//----------------------------------------------------------------------------
+
+std::string uvm_comparer::m_format_bits( const uvm_bitstream_t& lhs,
+                                         const uvm_bitstream_t& rhs,
+                                         int size,
+                                         uvm_radix_enum radix )
+{
+  std::ostringstream msg;
+
+  uvm_bitstream_t mask;
+  mask = -1;
+  mask >>= UVM_MAX_STREAMBITS - size;
+
+  sc_lv<UVM_MAX_STREAMBITS> lhs_masked = lhs & mask;
+  sc_lv<UVM_MAX_STREAMBITS> rhs_masked = rhs & mask;
+
+  switch (radix)
+  {
+    case UVM_BIN:
+    case UVM_STRING: // TODO printed as binary ??
+    {
+      msg << "lhs = 0b" << lhs_masked.to_string(sc_dt::SC_BIN_US, true)
+          << " : rhs = 0b" << rhs_masked.to_string(sc_dt::SC_BIN_US, true);
+      break;
+    }
+    case UVM_OCT:
+    {
+      msg << "lhs = 0o" << std::oct << lhs_masked.to_string(sc_dt::SC_OCT_US, true)
+          << " : rhs = 0o" << std::oct << rhs_masked.to_string(sc_dt::SC_OCT_US, true);
+      break;
+    }
+    case UVM_DEC:
+    case UVM_TIME: // TODO how to deal with time/sc_time?
+    case UVM_ENUM: // printed as decimal, user should use compare string for enum val
+    {
+      msg << "lhs = " << lhs_masked.to_string(sc_dt::SC_DEC, true)
+          << " : rhs = " << rhs_masked.to_string(sc_dt::SC_DEC, true);
+      break;
+    }
+    default: // default is printed in hex
+    {
+      msg << "lhs = 0x" << lhs_masked.to_string(sc_dt::SC_HEX_US, true)
+          << " : rhs = 0x" << rhs_masked.to_string(sc_dt::SC_HEX_US, true);
+      break;
+    }
+  } // switch
+
+  return msg.str();
+}
+
 //----------------------------------------------------------------------------
 // member function: print_rollup
 //
@@ -27,6 +27,7 @@
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/misc/uvm_misc.h"
 #include "uvmsc/misc/uvm_copy_map.h"
+#include "uvmsc/misc/uvm_pointer_set.h"
 
 //////////////
 
@@ -40,6 +41,11 @@ namespace uvm {
 //! comparison are stored in the comparer object. The uvm_object::compare
 //! and uvm_object::do_compare methods are passed an uvm_comparer policy
 //! object.
+//!
+//! For scoreboards which only need to know whether two objects are equal,
+//! the comparer provides an early exit mode, see #set_early_exit. Code
+//! which calls the compare member functions directly, rather than through
+//! uvm_object::compare, starts each comparison with #reset.
 //------------------------------------------------------------------------------
 
 
@@ -117,12 +123,54 @@ class uvm_comparer
   // not part of UVM Class reference / LRM
   /////////////////////////////////////////////////////
 
- private:
-
   uvm_comparer(); // constructor
 
   virtual ~uvm_comparer(); // destructor
 
+  void set_early_exit( bool enable = true );
+  bool get_early_exit() const;
+
+  void reset();
+
+  void m_begin_compare( const uvm_object& lhs, const uvm_object& rhs ) const;
+  void m_end_compare( const uvm_object& lhs, const uvm_object& rhs ) const;
+
+ private:
+
+  // operands of a miscompare, kept in early exit mode until the message
+  // is needed
+  struct m_deferred_miscompare
+  {
+    enum kind_e { NONE, INT, BITS, REAL, STRING, OBJECT };
+
+    kind_e kind;
+    std::string scope;
+    sc_dt::uint64 lhs_int, rhs_int;
+    uvm_bitstream_t lhs_bits, rhs_bits;
+    int size;
+    uvm_radix_enum radix;
+    double lhs_real, rhs_real;
+    std::string lhs_str, rhs_str;
+    int lhs_id, rhs_id;
+  };
+
+  void m_reset() const;
+
+  bool m_skip() const;
+
+  void m_miscompare( const std::string& name ) const;
+
+  std::string m_deferred_msg() const;
+
+  static std::string m_format_int( sc_dt::uint64 lhs,
+                                   sc_dt::uint64 rhs,
+                                   uvm_radix_enum radix );
+
+  static std::string m_format_bits( const uvm_bitstream_t& lhs,
+                                    const uvm_bitstream_t& rhs,
+                                    int size,
+                                    uvm_radix_enum radix );
+
   void print_rollup( const uvm_object& rhs,
                      const uvm_object& lhs ) const;
 
@@ -237,6 +285,15 @@ class uvm_comparer
 
  private:
 
+  bool m_early_exit;
+
+  mutable unsigned int m_depth;
+
+  // pairs of objects which are being compared, to stop at cycles
+  mutable uvm_pointer_set m_cycle;
+
+  mutable m_deferred_miscompare m_deferred;
+
   // TODO do we need these members?
   //  int depth;                 // current depth of objects
   //  uvm_copy_map* compare_map; // mapping of rhs to lhs objects
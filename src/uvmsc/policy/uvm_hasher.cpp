@@ -0,0 +1,445 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <cstring>
+
+#include "uvmsc/policy/uvm_hasher.h"
+#include "uvmsc/policy/uvm_packer.h"
+#include "uvmsc/base/uvm_object.h"
+#include "uvmsc/base/uvm_object_globals.h"
+
+using namespace sc_core;
+using namespace sc_dt;
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Class: uvm_hasher implementation
+//----------------------------------------------------------------------------
+
+uvm_hasher::uvm_hasher()
+: m_policy(UVM_DEFAULT_POLICY),
+  m_state(0),
+  m_count(0),
+  m_depth(0),
+  m_cycle(),
+  m_packer(NULL)
+{}
+
+uvm_hasher::~uvm_hasher()
+{
+  delete m_packer;
+}
+
+//----------------------------------------------------------------------------
+// member function: init (static)
+//
+//! Initialize default hasher
+//----------------------------------------------------------------------------
+
+uvm_hasher* uvm_hasher::init()
+{
+  if( uvm_default_hasher == NULL )
+    uvm_default_hasher = new uvm_hasher();
+
+  return uvm_default_hasher;
+}
+
+//----------------------------------------------------------------------------
+// Group: Hashing
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// member function: hash_field
+//
+//! Adds the \p size least significant bits of the integral \p value to the
+//! hash. The size must be less than or equal to 4096.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::hash_field( const uvm_bitstream_t& value, int size )
+{
+  if (size > UVM_MAX_STREAMBITS)
+    size = UVM_MAX_STREAMBITS;
+
+  if (size <= 64)
+  {
+    hash_field_int(value.to_uint64(), size);
+    return;
+  }
+
+  for (int lo = 0; lo < size; lo += 64)
+  {
+    int hi = (lo + 63 < size) ? lo + 63 : size - 1;
+    m_mix(value.range(hi, lo).to_uint64());
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: hash_field_int
+//
+//! This member function is the same as #hash_field, except that the value
+//! has at most 64 bits.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::hash_field_int( const uvm_integral_t& value, int size )
+{
+  uint64 v = value.to_uint64();
+
+  if (size <= 0)
+    v = 0;
+  else if (size < 64)
+    v &= (static_cast<uint64>(1) << size) - 1;
+
+  m_mix(v);
+}
+
+//----------------------------------------------------------------------------
+// member function: hash_field_real
+//
+//! Adds the real \p value to the hash. Zero and negative zero compare
+//! equal, so they hash equally.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::hash_field_real( double value )
+{
+  if (value == 0.0)
+    value = 0.0;
+
+  uint64 bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  m_mix(bits);
+}
+
+//----------------------------------------------------------------------------
+// member function: hash_string
+//
+//! Adds the string \p value to the hash.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::hash_string( const std::string& value )
+{
+  hash_bytes(reinterpret_cast<const unsigned char*>(value.data()), value.size());
+}
+
+//----------------------------------------------------------------------------
+// member function: hash_object
+//
+//! Adds the object \p value to the hash, using the #policy: a reference
+//! hash only adds the address of the object, which matches the reference
+//! compare of uvm_comparer. Otherwise, uvm_object::do_hash of the object
+//! is called. An object which is reached again while it is being hashed,
+//! through a cycle of references, is not hashed a second time.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::hash_object( const uvm_object& value )
+{
+  if (m_policy == UVM_REFERENCE)
+  {
+    m_mix(static_cast<uint64>(reinterpret_cast<std::size_t>(&value)));
+    return;
+  }
+
+  if (!m_cycle.insert(&value))
+    return;
+
+  m_depth++;
+  value.hash(this);
+  m_depth--;
+
+  m_cycle.erase(&value);
+}
+
+//----------------------------------------------------------------------------
+// member function: hash_bytes
+//
+//! Adds the \p size bytes at \p bytes to the hash, eight bytes per word.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::hash_bytes( const unsigned char* bytes, unsigned int size )
+{
+  m_mix(size);
+
+  unsigned int i = 0;
+  for (; i + 8 <= size; i += 8)
+  {
+    uint64 w = 0;
+    for (int b = 7; b >= 0; b--)
+      w = (w << 8) | bytes[i + b];
+    m_mix(w);
+  }
+
+  if (i < size)
+  {
+    uint64 w = 0;
+    for (unsigned int b = size; b > i; b--)
+      w = (w << 8) | bytes[b - 1];
+    m_mix(w);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Operator << for data types that can be hashed using this class
+//----------------------------------------------------------------------------
+
+#define UVM_HASH_NATIVE_OPERATOR(T, CAST) \
+  uvm_hasher& uvm_hasher::operator<< ( T a ) \
+  { \
+    m_mix(static_cast<uint64>(static_cast<CAST>(a))); \
+    return *this; \
+  }
+
+UVM_HASH_NATIVE_OPERATOR( bool, uint64 )
+UVM_HASH_NATIVE_OPERATOR( char, int64 )
+UVM_HASH_NATIVE_OPERATOR( unsigned char, uint64 )
+UVM_HASH_NATIVE_OPERATOR( short, int64 )
+UVM_HASH_NATIVE_OPERATOR( unsigned short, uint64 )
+UVM_HASH_NATIVE_OPERATOR( int, int64 )
+UVM_HASH_NATIVE_OPERATOR( unsigned int, uint64 )
+UVM_HASH_NATIVE_OPERATOR( long, int64 )
+UVM_HASH_NATIVE_OPERATOR( unsigned long, uint64 )
+UVM_HASH_NATIVE_OPERATOR( long long, int64 )
+UVM_HASH_NATIVE_OPERATOR( unsigned long long, uint64 )
+
+#undef UVM_HASH_NATIVE_OPERATOR
+
+uvm_hasher& uvm_hasher::operator<< ( double a )
+{
+  hash_field_real(a);
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( float a )
+{
+  hash_field_real(a);
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const std::string& a )
+{
+  hash_string(a);
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const char* a )
+{
+  hash_string(a);
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const uvm_object& a )
+{
+  hash_object(a);
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_logic& a )
+{
+  m_mix(a.value());
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_bv_base& a )
+{
+  m_mix(a.length());
+  for (int i = 0; i < a.size(); i++)
+    m_mix(a.get_word(i));
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_lv_base& a )
+{
+  m_mix(a.length());
+  for (int i = 0; i < a.size(); i++)
+    m_mix((static_cast<uint64>(a.get_cword(i)) << 32) | a.get_word(i));
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_int_base& a )
+{
+  m_mix(static_cast<uint64>(a.to_int64()));
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_uint_base& a )
+{
+  m_mix(a.to_uint64());
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_signed& a )
+{
+  int len = a.length();
+  m_mix(len);
+  for (int lo = 0; lo < len; lo += 64)
+  {
+    int hi = (lo + 63 < len) ? lo + 63 : len - 1;
+    m_mix(a.range(hi, lo).to_uint64());
+  }
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_unsigned& a )
+{
+  int len = a.length();
+  m_mix(len);
+  for (int lo = 0; lo < len; lo += 64)
+  {
+    int hi = (lo + 63 < len) ? lo + 63 : len - 1;
+    m_mix(a.range(hi, lo).to_uint64());
+  }
+  return *this;
+}
+
+uvm_hasher& uvm_hasher::operator<< ( const sc_time& a )
+{
+  m_mix(a.value());
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+// Group: Hasher settings
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// member function: set_policy
+//
+//! Determines whether objects are hashed by contents (UVM_DEEP or
+//! UVM_SHALLOW, default) or by reference (UVM_REFERENCE). Use the same
+//! policy as the comparer, so that equal objects hash equally.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::set_policy( uvm_recursion_policy_enum policy )
+{
+  m_policy = policy;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_policy
+//----------------------------------------------------------------------------
+
+uvm_recursion_policy_enum uvm_hasher::get_policy() const
+{
+  return m_policy;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_hash
+//
+//! Returns the hash of the values added since the last #reset.
+//----------------------------------------------------------------------------
+
+uint64 uvm_hasher::get_hash() const
+{
+  // final avalanche of MurmurHash3
+  uint64 h = m_state ^ m_count;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+//----------------------------------------------------------------------------
+// member function: reset
+//
+//! Starts a new hash.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::reset()
+{
+  m_state = 0;
+  m_count = 0;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_begin_hash
+//
+//! Implementation-defined member function
+//! Called by uvm_object::hash. Starts a new hash when a new top-level
+//! object is hashed, and marks \p obj as being hashed.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::m_begin_hash( const uvm_object& obj )
+{
+  if (m_depth++ != 0)
+    return;
+
+  reset();
+  m_cycle.clear();
+  m_cycle.insert(&obj);
+}
+
+//----------------------------------------------------------------------------
+// member function: m_end_hash
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void uvm_hasher::m_end_hash( const uvm_object& obj )
+{
+  if (--m_depth == 0)
+    m_cycle.erase(&obj);
+}
+
+//----------------------------------------------------------------------------
+// member function: m_hash_packed
+//
+//! Implementation-defined member function
+//! Adds the stream packed by uvm_object::do_pack of \p obj to the hash.
+//! Used by the default uvm_object::do_hash.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::m_hash_packed( const uvm_object& obj )
+{
+  if (m_packer == NULL)
+    m_packer = new uvm_packer();
+
+  m_packer->reset();
+  obj.do_pack(*m_packer);
+
+  unsigned int nbits = m_packer->pack_index;
+  m_mix(nbits);
+
+  for (unsigned int i = 0; i < nbits / 64; i++)
+    m_mix(m_packer->m_words[i]);
+
+  if (nbits % 64 != 0)
+    m_mix(m_packer->m_words[nbits / 64] & ((static_cast<uint64>(1) << (nbits % 64)) - 1));
+}
+
+//----------------------------------------------------------------------------
+// member function: m_mix
+//
+//! Implementation-defined member function
+//! Adds one word to the hash, using the block mix of MurmurHash3.
+//----------------------------------------------------------------------------
+
+void uvm_hasher::m_mix( uint64 word )
+{
+  word *= 0x87c37b91114253d5ULL;
+  word = (word << 31) | (word >> 33);
+  word *= 0x4cf5ad432745937fULL;
+
+  m_state ^= word;
+  m_state = ((m_state << 27) | (m_state >> 37)) * 5 + 0x52dce729;
+  m_count++;
+}
+
+} // namespace uvm
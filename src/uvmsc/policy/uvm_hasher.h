@@ -0,0 +1,177 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_HASHER_H_
+#define UVM_HASHER_H_
+
+#include <string>
+#include <vector>
+
+#include <systemc>
+
+#include "uvmsc/base/uvm_object_globals.h"
+#include "uvmsc/misc/uvm_pointer_set.h"
+
+namespace uvm {
+
+// forward class references
+class uvm_object;
+class uvm_packer;
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_hasher
+//
+//! The class #uvm_hasher provides a policy object for computing a 64-bit
+//! hash of the contents of an object, so that objects can be bucketed by
+//! content, for example to match transactions out of order or to remove
+//! duplicates. The uvm_object::hash and uvm_object::do_hash methods are
+//! passed an uvm_hasher policy object.
+//!
+//! Objects which compare equal with uvm_object::compare must have equal
+//! hashes. The default uvm_object::do_hash therefore hashes the packed
+//! stream of the object, as produced by uvm_object::do_pack. A class
+//! which packs fields that its do_compare ignores, or which wants to avoid
+//! the cost of packing, overrides do_hash and feeds exactly the fields it
+//! compares to the hasher, such as:
+//!
+//!   void do_hash( uvm_hasher& hasher ) const
+//!   {
+//!     hasher << addr << data << payload;
+//!   }
+//!
+//! The hash is the same on every run and host, but is not meant to be
+//! stored: it may change between releases.
+//------------------------------------------------------------------------------
+
+class uvm_hasher
+{
+ public:
+
+  //--------------------------------------------------------------------------
+  // Group: Hashing
+  //--------------------------------------------------------------------------
+
+  virtual void hash_field( const uvm_bitstream_t& value, int size );
+
+  virtual void hash_field_int( const uvm_integral_t& value, int size );
+
+  virtual void hash_field_real( double value );
+
+  virtual void hash_string( const std::string& value );
+
+  virtual void hash_object( const uvm_object& value );
+
+  void hash_bytes( const unsigned char* bytes, unsigned int size );
+
+  //--------------------------------------------------------------------------
+  // Operator << for data types that can be hashed using this class
+  //
+  // These will be invoked from uvm_object's do_hash() method
+  //--------------------------------------------------------------------------
+
+  uvm_hasher& operator<< ( bool a );
+  uvm_hasher& operator<< ( double a );
+  uvm_hasher& operator<< ( float a );
+  uvm_hasher& operator<< ( char a );
+  uvm_hasher& operator<< ( unsigned char a );
+  uvm_hasher& operator<< ( short a );
+  uvm_hasher& operator<< ( unsigned short a );
+  uvm_hasher& operator<< ( int a );
+  uvm_hasher& operator<< ( unsigned int a );
+  uvm_hasher& operator<< ( long a );
+  uvm_hasher& operator<< ( unsigned long a );
+  uvm_hasher& operator<< ( long long a );
+  uvm_hasher& operator<< ( unsigned long long a );
+
+  uvm_hasher& operator<< ( const std::string& a );
+  uvm_hasher& operator<< ( const char* a );
+
+  uvm_hasher& operator<< ( const uvm_object& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_logic& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_bv_base& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_lv_base& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_int_base& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_uint_base& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_signed& a );
+  uvm_hasher& operator<< ( const sc_dt::sc_unsigned& a );
+
+  uvm_hasher& operator<< ( const sc_core::sc_time& a );
+
+  template <class T>
+  uvm_hasher& operator<< ( const std::vector<T>& a )
+  {
+    // the size separates the elements from the fields which follow
+    m_mix(a.size());
+    for (typename std::vector<T>::size_type i = 0; i < a.size(); i++)
+      (*this) << a[i];
+    return *this;
+  }
+
+  //--------------------------------------------------------------------------
+  // Group: Hasher settings
+  //--------------------------------------------------------------------------
+
+  void set_policy( uvm_recursion_policy_enum policy = UVM_DEFAULT_POLICY );
+  uvm_recursion_policy_enum get_policy() const;
+
+  sc_dt::uint64 get_hash() const;
+
+  void reset();
+
+  /////////////////////////////////////////////////////
+  // Implementation-defined member functions below,
+  // not part of UVM Class reference / LRM
+  /////////////////////////////////////////////////////
+
+  uvm_hasher(); // constructor
+
+  virtual ~uvm_hasher(); // destructor
+
+  static uvm_hasher* init();
+
+  void m_begin_hash( const uvm_object& obj );
+  void m_end_hash( const uvm_object& obj );
+
+  void m_hash_packed( const uvm_object& obj );
+
+ private:
+  // disabled
+  uvm_hasher( const uvm_hasher& );
+  uvm_hasher& operator=( const uvm_hasher& );
+
+  void m_mix( sc_dt::uint64 word );
+
+  uvm_recursion_policy_enum m_policy;
+
+  sc_dt::uint64 m_state;
+  sc_dt::uint64 m_count; // number of words mixed into m_state
+
+  int m_depth; // nesting of uvm_object::hash calls
+
+  // objects being hashed, to stop at a cycle of references
+  uvm_pointer_set m_cycle;
+
+  // packer used by the default do_hash, created on first use
+  uvm_packer* m_packer;
+
+}; // class uvm_hasher
+
+} // namespace uvm
+
+#endif /* UVM_HASHER_H_ */
@@ -0,0 +1,397 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_LAYOUT_H_
+#define UVM_LAYOUT_H_
+
+#include <cstring>
+#include <systemc>
+
+#include "uvmsc/base/uvm_object_globals.h"
+#include "uvmsc/policy/uvm_packer.h"
+#include "uvmsc/print/uvm_printer.h"
+
+//----------------------------------------------------------------------------
+// Macro: UVM_LAYOUT_FIELD
+//
+//! Declares member \p member of type \p T as a field of a #uvm_layout, with
+//! the width the #uvm_packer uses for the type. The macro must be used in
+//! the class declaring the member, after the member. It declares the type
+//! uvm_layout_field_<member>, which is passed to #uvm_layout.
+//----------------------------------------------------------------------------
+
+#define UVM_LAYOUT_FIELD(T, member) \
+  UVM_LAYOUT_FIELD_BITS(T, member, uvm::uvm_layout_traits<T >::bits)
+
+//----------------------------------------------------------------------------
+// Macro: UVM_LAYOUT_FIELD_BITS
+//
+//! Same as #UVM_LAYOUT_FIELD, for a field of \p W bits (at most 64), packed
+//! the same as uvm_packer::pack_field_int with size \p W. A width outside
+//! 1 to 64 does not compile.
+//----------------------------------------------------------------------------
+
+#define UVM_LAYOUT_FIELD_BITS(T, member, W) \
+  struct uvm_layout_field_##member \
+  { \
+    typedef T type; \
+    static const int bits = W; \
+    typedef char uvm_layout_width_check[(W) > 0 && (W) <= 64 ? 1 : -1]; \
+    static const char* name() { return #member; } \
+    template <class O> static T& get( O& obj ) { return obj.member; } \
+    template <class O> static const T& get( const O& obj ) { return obj.member; } \
+  };
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Class: uvm_layout_traits
+//
+//! Converts a field of type \p T to and from the bits of a packed stream.
+//! The member bits is the default width of the field, and reversed tells
+//! whether the packer reverses the field in big-endian mode. Each trait
+//! matches packing the type with uvm_packer::operator<<.
+//!
+//! Traits are defined for bool, the integer types the packer supports,
+//! float, double, sc_int and sc_uint. A field of any other type does not
+//! compile; a specialization can be added for it, e.g. for an enum.
+//----------------------------------------------------------------------------
+
+template <class T>
+struct uvm_layout_traits; // no generic conversion
+
+// integer types are packed through uvm_packer::pack_field_int
+
+template <class T>
+struct uvm_layout_integer_traits
+{
+  static const int bits = 8 * sizeof(T);
+  static const bool reversed = true;
+
+  static sc_dt::uint64 to_bits( const T& value )
+  { return (sc_dt::uint64)value; }
+
+  static void from_bits( T& value, sc_dt::uint64 bits, int )
+  { value = (T)bits; }
+};
+
+#define UVM_LAYOUT_INTEGER_TRAITS(T) \
+  template <> \
+  struct uvm_layout_traits<T> : uvm_layout_integer_traits<T> {};
+
+UVM_LAYOUT_INTEGER_TRAITS(char)
+UVM_LAYOUT_INTEGER_TRAITS(unsigned char)
+UVM_LAYOUT_INTEGER_TRAITS(short)
+UVM_LAYOUT_INTEGER_TRAITS(unsigned short)
+UVM_LAYOUT_INTEGER_TRAITS(int)
+UVM_LAYOUT_INTEGER_TRAITS(unsigned int)
+UVM_LAYOUT_INTEGER_TRAITS(long)
+UVM_LAYOUT_INTEGER_TRAITS(unsigned long)
+UVM_LAYOUT_INTEGER_TRAITS(long long)
+UVM_LAYOUT_INTEGER_TRAITS(unsigned long long)
+
+#undef UVM_LAYOUT_INTEGER_TRAITS
+
+// reals are packed through uvm_packer::pack_real, as the 64 bits of the
+// IEEE 754 double; a float is converted to double first
+
+template <>
+struct uvm_layout_traits<double>
+{
+  static const int bits = 64;
+  static const bool reversed = true;
+
+  static sc_dt::uint64 to_bits( double value )
+  {
+    sc_dt::uint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  static void from_bits( double& value, sc_dt::uint64 bits, int )
+  { std::memcpy(&value, &bits, sizeof(value)); }
+};
+
+template <>
+struct uvm_layout_traits<float>
+{
+  static const int bits = 64;
+  static const bool reversed = true;
+
+  static sc_dt::uint64 to_bits( float value )
+  { return uvm_layout_traits<double>::to_bits(value); }
+
+  static void from_bits( float& value, sc_dt::uint64 bits, int width )
+  {
+    double d;
+    uvm_layout_traits<double>::from_bits(d, bits, width);
+    value = (float)d;
+  }
+};
+
+template <>
+struct uvm_layout_traits<bool>
+{
+  static const int bits = 1;
+  static const bool reversed = false;
+
+  static sc_dt::uint64 to_bits( bool value )
+  { return value ? 1 : 0; }
+
+  static void from_bits( bool& value, sc_dt::uint64 bits, int )
+  { value = (bits & 1) != 0; }
+};
+
+// SystemC integers are always packed lsb first
+
+template <int N>
+struct uvm_layout_traits< sc_dt::sc_uint<N> >
+{
+  static const int bits = N;
+  static const bool reversed = false;
+
+  static sc_dt::uint64 to_bits( const sc_dt::sc_uint<N>& value )
+  { return value.to_uint64(); }
+
+  static void from_bits( sc_dt::sc_uint<N>& value, sc_dt::uint64 bits, int )
+  { value = bits; }
+};
+
+template <int N>
+struct uvm_layout_traits< sc_dt::sc_int<N> >
+{
+  static const int bits = N;
+  static const bool reversed = false;
+
+  static sc_dt::uint64 to_bits( const sc_dt::sc_int<N>& value )
+  { return (sc_dt::uint64)value.to_int64(); }
+
+  static void from_bits( sc_dt::sc_int<N>& value, sc_dt::uint64 bits, int width )
+  {
+    if (width < 64 && ((bits >> (width - 1)) & 1))
+      bits |= ~sc_dt::uint64(0) << width;
+    value = (sc_dt::int64)bits;
+  }
+};
+
+//----------------------------------------------------------------------------
+// Class: uvm_layout_access
+//
+//! Implementation-defined class through which a #uvm_layout accesses the
+//! stream of a #uvm_packer.
+//----------------------------------------------------------------------------
+
+class uvm_layout_access
+{
+ public:
+  static void reserve( uvm_packer& packer, int nbits )
+  {
+    packer.m_check_size(nbits);
+  }
+
+  static void put( uvm_packer& packer, sc_dt::uint64 value, int nbits, bool reversed )
+  {
+    if (reversed && packer.big_endian)
+      value = uvm_packer::m_reverse_bits(value, nbits);
+    packer.m_put_bits(value, nbits);
+  }
+
+  static bool available( const uvm_packer& packer, int nbits )
+  {
+    return packer.m_enough_bits(nbits, "layout");
+  }
+
+  static sc_dt::uint64 get( uvm_packer& packer, int nbits, bool reversed )
+  {
+    sc_dt::uint64 value = packer.m_get_bits(packer.unpack_index, nbits);
+    packer.unpack_index += nbits;
+    if (reversed && packer.big_endian)
+      value = uvm_packer::m_reverse_bits(value, nbits);
+    return value;
+  }
+
+  static sc_dt::uint64 mask( sc_dt::uint64 value, int nbits )
+  {
+    return (nbits < 64) ? (value & ((sc_dt::uint64(1) << nbits) - 1)) : value;
+  }
+};
+
+//----------------------------------------------------------------------------
+// Class: uvm_layout
+//
+//! Fixed layout of up to 16 fields of an object, declared with
+//! #UVM_LAYOUT_FIELD or #UVM_LAYOUT_FIELD_BITS. The total number of bits of
+//! the layout is the compile-time constant bits.
+//!
+//! The layout packs, unpacks, compares and prints the fields with code
+//! that is expanded at compile time. Packing reserves the space in the
+//! packer once and stores the fields without virtual calls. The stream is
+//! the same as packing the fields one by one with uvm_packer::operator<<,
+//! or with uvm_packer::pack_field_int for fields with an explicit width.
+//! A do_pack implementation can therefore mix #pack with other calls to
+//! the packer, and objects packed either way unpack both ways.
+//!
+//! Example:
+//!
+//!   class bus_txn : public uvm_object
+//!   {
+//!    public:
+//!     unsigned int addr;
+//!     unsigned char be;
+//!     UVM_LAYOUT_FIELD(unsigned int, addr)
+//!     UVM_LAYOUT_FIELD_BITS(unsigned char, be, 4)
+//!     typedef uvm_layout<uvm_layout_field_addr, uvm_layout_field_be> layout;
+//!
+//!     void do_pack( uvm_packer& packer ) const { layout::pack(*this, packer); }
+//!     void do_unpack( uvm_packer& packer ) { layout::unpack(*this, packer); }
+//!   };
+//----------------------------------------------------------------------------
+
+struct uvm_layout_none {};
+
+template < class F0,
+           class F1 = uvm_layout_none, class F2 = uvm_layout_none,
+           class F3 = uvm_layout_none, class F4 = uvm_layout_none,
+           class F5 = uvm_layout_none, class F6 = uvm_layout_none,
+           class F7 = uvm_layout_none, class F8 = uvm_layout_none,
+           class F9 = uvm_layout_none, class F10 = uvm_layout_none,
+           class F11 = uvm_layout_none, class F12 = uvm_layout_none,
+           class F13 = uvm_layout_none, class F14 = uvm_layout_none,
+           class F15 = uvm_layout_none >
+class uvm_layout
+{
+  typedef uvm_layout<F1, F2, F3, F4, F5, F6, F7, F8, F9, F10,
+                     F11, F12, F13, F14, F15, uvm_layout_none> tail;
+  typedef typename F0::type type;
+  typedef uvm_layout_traits<type> traits;
+
+ public:
+  static const int bits = F0::bits + tail::bits;
+  static const int bytes = (bits + 7) / 8;
+
+  //--------------------------------------------------------------------------
+  // member function: pack
+  //
+  //! Packs the fields of \p obj at the current position of \p packer.
+  //--------------------------------------------------------------------------
+
+  template <class O>
+  static void pack( const O& obj, uvm_packer& packer )
+  {
+    uvm_layout_access::reserve(packer, bits);
+    m_pack(obj, packer);
+  }
+
+  //--------------------------------------------------------------------------
+  // member function: unpack
+  //
+  //! Unpacks the fields of \p obj from the current position of \p packer.
+  //! Returns false, and leaves \p obj unchanged, if the packer does not hold
+  //! enough bits.
+  //--------------------------------------------------------------------------
+
+  template <class O>
+  static bool unpack( O& obj, uvm_packer& packer )
+  {
+    if (!uvm_layout_access::available(packer, bits))
+      return false;
+    m_unpack(obj, packer);
+    return true;
+  }
+
+  //--------------------------------------------------------------------------
+  // member function: compare
+  //
+  //! Returns true if all fields of \p lhs and \p rhs have the same packed
+  //! bits.
+  //--------------------------------------------------------------------------
+
+  template <class O>
+  static bool compare( const O& lhs, const O& rhs )
+  {
+    return uvm_layout_access::mask(traits::to_bits(F0::get(lhs)), F0::bits) ==
+           uvm_layout_access::mask(traits::to_bits(F0::get(rhs)), F0::bits) &&
+           tail::compare(lhs, rhs);
+  }
+
+  //--------------------------------------------------------------------------
+  // member function: print
+  //
+  //! Prints the fields of \p obj as integral fields of their layout width.
+  //! A real field is printed as the bits of its IEEE 754 double.
+  //--------------------------------------------------------------------------
+
+  template <class O>
+  static void print( const O& obj, const uvm_printer& printer )
+  {
+    printer.print_field_int(F0::name(),
+      uvm_layout_access::mask(traits::to_bits(F0::get(obj)), F0::bits), F0::bits);
+    tail::print(obj, printer);
+  }
+
+  /////////////////////////////////////////////////////
+  // Implementation-defined member functions below,
+  // not part of UVM Class reference / LRM
+  /////////////////////////////////////////////////////
+
+  template <class O>
+  static void m_pack( const O& obj, uvm_packer& packer )
+  {
+    uvm_layout_access::put(packer, traits::to_bits(F0::get(obj)), F0::bits, traits::reversed);
+    tail::m_pack(obj, packer);
+  }
+
+  template <class O>
+  static void m_unpack( O& obj, uvm_packer& packer )
+  {
+    traits::from_bits(F0::get(obj),
+      uvm_layout_access::get(packer, F0::bits, traits::reversed), F0::bits);
+    tail::m_unpack(obj, packer);
+  }
+};
+
+// end of the list of fields
+
+template <>
+class uvm_layout< uvm_layout_none,
+                  uvm_layout_none, uvm_layout_none, uvm_layout_none,
+                  uvm_layout_none, uvm_layout_none, uvm_layout_none,
+                  uvm_layout_none, uvm_layout_none, uvm_layout_none,
+                  uvm_layout_none, uvm_layout_none, uvm_layout_none,
+                  uvm_layout_none, uvm_layout_none, uvm_layout_none >
+{
+ public:
+  static const int bits = 0;
+
+  template <class O>
+  static bool compare( const O&, const O& ) { return true; }
+
+  template <class O>
+  static void print( const O&, const uvm_printer& ) {}
+
+  template <class O>
+  static void m_pack( const O&, uvm_packer& ) {}
+
+  template <class O>
+  static void m_unpack( O&, uvm_packer& ) {}
+};
+
+} // namespace uvm
+
+#endif // UVM_LAYOUT_H_
@@ -46,19 +46,14 @@ uvm_packer::uvm_packer()
   pack_index = 0;
   unpack_index = 0;
 
-  m_bits = NULL;
   m_size = 0;
-  m_max_size = 0;
+
+  m_ext_bytes = NULL;
+  m_ext_size = 0;
 }
 
 uvm_packer::~uvm_packer()
-{
-  if (m_bits != NULL)
-  {
-    delete m_bits;
-    m_bits = NULL;
-  }
-}
+{}
 
 //------------------------------------------------------------------------------
 // Member function: pack_field (virtual)
@@ -72,21 +67,25 @@ uvm_packer::~uvm_packer()
 
 void uvm_packer::pack_field( const uvm_bitstream_t& value, int size )
 {
-  // TODO should be changed to 4096 size
-  sc_dt::sc_bv<64> tmp = value;
   m_check_size(size);
 
-  if(big_endian)
-    for (int i = 0; i < size; i++)
-      tmp[i] = value[size-1-i].to_bool();
-
-  (*m_bits)(pack_index + size - 1, pack_index) = tmp.range(size-1, 0); // make sure we only copy the size
-  pack_index += size;
+  // the value is inserted in chunks of at most 64 bits; in big-endian
+  // order, the chunks are taken from the most significant end
+  for (int lo = 0; lo < size; lo += 64)
+  {
+    int n = (size - lo < 64) ? size - lo : 64;
+    sc_dt::uint64 v;
+    if (big_endian)
+      v = m_reverse_bits(value.range(size - lo - 1, size - lo - n).to_uint64(), n);
+    else
+      v = value.range(lo + n - 1, lo).to_uint64();
+    m_put_bits(v, n);
+  }
 
-  std::ostringstream str;
-  str << "uvm_packer::pack_field_int 0x" << std::hex << tmp.to_uint64() << ", length = " << size << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  UVM_INFO("PCKFLD", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("PCKFLD",
+    "uvm_packer::pack_field 0x" << std::hex << value.to_uint64() << ", length = " << size << std::endl <<
+    "pack_index = " << pack_index << std::endl,
+    uvm::UVM_DEBUG);
 }
 
 //------------------------------------------------------------------------------
@@ -100,23 +99,20 @@ void uvm_packer::pack_field( const uvm_bitstream_t& value, int size )
 
 void uvm_packer::pack_field_int( const uvm_integral_t& value, int size )
 {
-  sc_dt::sc_bv<64> tmp = value;
   m_check_size(size);
 
+  sc_dt::uint64 v = value.to_uint64();
   if(big_endian)
-    for (int i = 0; i < size; i++)
-      tmp[i] = value[size-1-i].to_bool();
+    v = m_reverse_bits(v, size);
 
-  (*m_bits)(pack_index + size - 1, pack_index) = tmp.range(size-1, 0); // make sure we only copy the size
-  pack_index += size;
+  m_put_bits(v, size);
 
-  std::ostringstream str;
-  str << "uvm_packer::pack_field_int 0x" << std::hex << tmp.to_uint64() << ", length = " << size << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  UVM_INFO("PCKFLDINT", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("PCKFLDINT",
+    "uvm_packer::pack_field_int 0x" << std::hex << v << ", length = " << size << std::endl <<
+    "pack_index = " << pack_index << std::endl,
+    uvm::UVM_DEBUG);
 }
 
-
 //------------------------------------------------------------------------------
 // Member function: pack_string
 //
@@ -140,11 +136,11 @@ void uvm_packer::pack_string( const std::string& value )
   if(use_metadata)
     pack_char(0); // NULL character
 
-  std::ostringstream str;
-  str << "uvm_packer::pack_string '" << value << "'" << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  if(use_metadata) str << "use_metadata = true" << std::endl;
-  UVM_INFO("PCKSTR", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("PCKSTR",
+    "uvm_packer::pack_string '" << value << "'" << std::endl <<
+    "pack_index = " << pack_index << std::endl <<
+    (use_metadata ? "use_metadata = true\n" : ""),
+    uvm::UVM_DEBUG);
 }
 
 //------------------------------------------------------------------------------
@@ -158,10 +154,10 @@ void uvm_packer::pack_time( const sc_core::sc_time& value )
   double v = value.to_seconds();
   pack_field_int(uvm_realtobits(v), 64);
 
-  std::ostringstream str;
-  str << "uvm_packer::pack_time" << v << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  UVM_INFO("PCKTIME", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("PCKTIME",
+    "uvm_packer::pack_time" << v << std::endl <<
+    "pack_index = " << pack_index << std::endl,
+    uvm::UVM_DEBUG);
 }
 
 
@@ -215,8 +211,7 @@ void uvm_packer::pack_object( const uvm_object& value )
     if(use_metadata)
     {
       m_check_size(4);
-      m_bits->range(pack_index+3, pack_index) = 1;
-      pack_index += 4; // to better debug when display packed bits in hexidecimal
+      m_put_bits(1, 4); // to better debug when display packed bits in hexidecimal
     }
     scope.down(val->get_name());
     //value.__m_uvm_field_automation(null, UVM_PACK,""); // TODO do we need this?
@@ -228,8 +223,7 @@ void uvm_packer::pack_object( const uvm_object& value )
     if(use_metadata)
     {
       m_check_size(4);
-      m_bits->range(pack_index+3, pack_index) = 0; // NULL object gets metadata 0
-      pack_index += 4;
+      m_put_bits(0, 4); // NULL object gets metadata 0
     }
   }
   val->__m_uvm_status_container->cycle_check.erase(val);
@@ -250,7 +244,7 @@ void uvm_packer::pack_object( const uvm_object& value )
 
 bool uvm_packer::is_null()
 {
-  return (m_bits->range(unpack_index+3, unpack_index) == 0);
+  return (m_get_bits(unpack_index, 4) == 0);
 }
 
 
@@ -266,26 +260,20 @@ bool uvm_packer::is_null()
 
 uvm_integral_t uvm_packer::unpack_field_int( int size )
 {
-  sc_dt::sc_bv<64> a, tmp;
-
   if (m_enough_bits(size, "integral"))
   {
-    a = (*m_bits)(unpack_index + size - 1, unpack_index);
+    sc_dt::uint64 v = m_get_bits(unpack_index, size);
 
     inc_unpack_index(size);
     if(big_endian)
-    {
-      for (int i = 0; i < size; i++)
-        tmp[i] = a[size-1-i];
-      a = tmp; // content swapped
-    }
+      v = m_reverse_bits(v, size); // content swapped
 
-    std::ostringstream str;
-    str << "uvm_packer::unpack_field_int 0x" << std::hex << a.to_uint64() << ", length = " << size << std::endl;
-    str << "unpack_index = " << unpack_index << std::endl;
-    UVM_INFO("UNPCKFLDINT", str.str(), uvm::UVM_DEBUG);
+    UVM_INFO_STREAM("UNPCKFLDINT",
+      "uvm_packer::unpack_field_int 0x" << std::hex << v << ", length = " << size << std::endl <<
+      "unpack_index = " << unpack_index << std::endl,
+      uvm::UVM_DEBUG);
 
-    return a;
+    return v;
   }
   else
   {
@@ -294,7 +282,6 @@ uvm_integral_t uvm_packer::unpack_field_int( int size )
   }
 }
 
-
 //------------------------------------------------------------------------------
 // Member function: unpack_field (virtual)
 //
@@ -304,23 +291,26 @@ uvm_integral_t uvm_packer::unpack_field_int( int size )
 
 uvm_bitstream_t uvm_packer::unpack_field( int size )
 {
-  sc_dt::sc_bv<64> a, tmp; // TODO maximum to unpack is 4096
-
   if (m_enough_bits(size,"integral"))
   {
-    a = (*m_bits)(unpack_index + size - 1, unpack_index);
-    inc_unpack_index(size);
-    if(big_endian)
+    uvm_bitstream_t a = 0;
+
+    // the inverse of pack_field, in chunks of at most 64 bits
+    for (int lo = 0; lo < size; lo += 64)
     {
-      for (int i = 0; i < size; i++)
-        tmp[i] = a[size-1-i];
-      a = tmp; // content swapped
+      int n = (size - lo < 64) ? size - lo : 64;
+      sc_dt::uint64 v = m_get_bits(unpack_index + lo, n);
+      if (big_endian)
+        a.range(size - lo - 1, size - lo - n) = m_reverse_bits(v, n);
+      else
+        a.range(lo + n - 1, lo) = v;
     }
+    inc_unpack_index(size);
 
-    std::ostringstream str;
-    str << "uvm_packer::unpack_field 0x" << std::hex << a.to_uint64() << ", length = " << size << std::endl;
-    str << "unpack_index = " << unpack_index << std::endl;
-    UVM_INFO("UNPCKFLD", str.str(), uvm::UVM_DEBUG);
+    UVM_INFO_STREAM("UNPCKFLD",
+      "uvm_packer::unpack_field 0x" << std::hex << a.to_uint64() << ", length = " << size << std::endl <<
+      "unpack_index = " << unpack_index << std::endl,
+      uvm::UVM_DEBUG);
 
     return a;
   }
@@ -345,7 +335,6 @@ uvm_bitstream_t uvm_packer::unpack_field( int size )
 
 std::string uvm_packer::unpack_string( int num_chars )
 {
-  sc_dt::sc_bv<8> b;
   bool is_null_term; // Assumes a NULL terminated string
   int i = 0;
 
@@ -357,25 +346,20 @@ std::string uvm_packer::unpack_string( int num_chars )
     is_null_term = false;
 
   while( m_enough_bits(8, "string") &&
-        (( (*m_bits).range(unpack_index+7, unpack_index) != 0 ) || (is_null_term == false)) &&
+        (( m_get_bits(unpack_index, 8) != 0 ) || (is_null_term == false)) &&
         ((i < num_chars) || (is_null_term == true)) )
   {
-    s += " ";
-    if(!big_endian)
-      s[i] = (char)(*m_bits)(unpack_index+7, unpack_index).to_int();
-    else
-    {
-      for(int j = 0; j < 8; ++j)
-        b[7-j] = (*m_bits)[unpack_index+j].to_bool();
-      s[i] = b.to_int();
-    }
+    sc_dt::uint64 c = m_get_bits(unpack_index, 8);
+    if(big_endian)
+      c = m_reverse_bits(c, 8);
+    s += (char)c;
 
     inc_unpack_index(8);
 
-    std::ostringstream str;
-    str << "uvm_packer::unpack_char -> " << s[i] << std::endl;
-    str << "unpack_index = " << unpack_index << std::endl;
-    UVM_INFO("UNPCKSTR", str.str(), uvm::UVM_DEBUG);
+    UVM_INFO_STREAM("UNPCKSTR",
+      "uvm_packer::unpack_char -> " << s[i] << std::endl <<
+      "unpack_index = " << unpack_index << std::endl,
+      uvm::UVM_DEBUG);
 
     ++i;
   }
@@ -386,10 +370,10 @@ std::string uvm_packer::unpack_string( int num_chars )
       inc_unpack_index(8);
   }
 
-  std::ostringstream str;
-  str << "uvm_packer::unpack_string '" << s << "'" << std::endl;
-  str << "unpack_index = " << unpack_index << std::endl;
-  UVM_INFO("UNPCKSTR", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("UNPCKSTR",
+    "uvm_packer::unpack_string '" << s << "'" << std::endl <<
+    "unpack_index = " << unpack_index << std::endl,
+    uvm::UVM_DEBUG);
 
   return s;
 }
@@ -415,10 +399,10 @@ sc_core::sc_time uvm_packer::unpack_time()
   else
     uvm_report_error("UNPCKERR","Not able to unpack time.", UVM_NONE);
 
-  std::ostringstream str;
-  str << "uvm_packer::unpack_time" << sct << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  UVM_INFO("UNPCKTIME", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("UNPCKTIME",
+    "uvm_packer::unpack_time" << sct << std::endl <<
+    "pack_index = " << pack_index << std::endl,
+    uvm::UVM_DEBUG);
 
   return sct;
 }
@@ -476,7 +460,7 @@ void uvm_packer::unpack_object( uvm_object& value )
 
   if(use_metadata)
   {
-    is_non_null = (*m_bits).range(unpack_index+3, unpack_index).to_int();
+    is_non_null = (int)m_get_bits(unpack_index, 4);
     inc_unpack_index(4);
   }
 
@@ -576,8 +560,7 @@ uvm_packer& uvm_packer::operator>> ( sc_core::sc_time& a )
 #define UVM_PACK_UNPACK_OPERATORS(T) \
   uvm_packer& uvm_packer::operator<< ( T a ) \
   { \
-    sc_dt::sc_bv<64> a_ = a; \
-    pack_field_int(a_, 8*sizeof(T));\
+    pack_field_int((sc_dt::uint64)a, 8*sizeof(T));\
     return *this;\
   } \
   uvm_packer& uvm_packer::operator>> ( T& a ) \
@@ -653,6 +636,25 @@ UVM_PACK_UNPACK_SC_OPERATORS( sc_dt::sc_signed, sc_signed )
 UVM_PACK_UNPACK_SC_OPERATORS( sc_dt::sc_unsigned, sc_unsigned )
 
 
+// bytes with their bits in reversed order, for big-endian streams
+
+#define UVM_REVERSE_BITS_2(n) n, n + 2*64, n + 1*64, n + 3*64
+#define UVM_REVERSE_BITS_4(n) UVM_REVERSE_BITS_2(n), UVM_REVERSE_BITS_2(n + 2*16), \
+                              UVM_REVERSE_BITS_2(n + 1*16), UVM_REVERSE_BITS_2(n + 3*16)
+#define UVM_REVERSE_BITS_6(n) UVM_REVERSE_BITS_4(n), UVM_REVERSE_BITS_4(n + 2*4), \
+                              UVM_REVERSE_BITS_4(n + 1*4), UVM_REVERSE_BITS_4(n + 3*4)
+
+static const unsigned char uvm_packer_reversed_bytes[256] =
+{
+  UVM_REVERSE_BITS_6(0), UVM_REVERSE_BITS_6(2),
+  UVM_REVERSE_BITS_6(1), UVM_REVERSE_BITS_6(3)
+};
+
+#undef UVM_REVERSE_BITS_2
+#undef UVM_REVERSE_BITS_4
+#undef UVM_REVERSE_BITS_6
+
+
 //------------------------------------------------------------------------------
 // member function: get_bits
 //
@@ -662,16 +664,12 @@ UVM_PACK_UNPACK_SC_OPERATORS( sc_dt::sc_unsigned, sc_unsigned )
 void uvm_packer::get_bits( std::vector<bool>& bits ) const
 {
   unsigned int n = get_remaining_unpacked_bits();
+  bits.reserve(bits.size() + n);
   for (unsigned int i = 0; i < n; i++)
-  {
-    bool b = (*m_bits)[i].to_bool();
-    bits.push_back(b);
-  }
+    bits.push_back(((m_words[i >> 6] >> (i & 63)) & 1) != 0);
 }
 
 
-
-
 //------------------------------------------------------------------------------
 // member function: get_bytes
 //
@@ -681,21 +679,20 @@ void uvm_packer::get_bits( std::vector<bool>& bits ) const
 void uvm_packer::get_bytes( std::vector<unsigned char>& bytes ) const
 {
   unsigned int n = get_remaining_unpacked_bits();
+  if (n == 0)
+    return;
+
   unsigned int nbytes = 1 + (n-1)/8;
+  bytes.reserve(bytes.size() + nbytes);
 
   for (unsigned int i = 0; i < nbytes; i++)
   {
-    char b = (*m_bits).range(8*i+7,8*i).to_int();
+    sc_dt::uint64 b = (m_words[i >> 3] >> (8 * (i & 7))) & 0xff;
 
     if(big_endian)
-    {
-      sc_dt::sc_bv<8> tmp, tmp2;
-      tmp = b;
-      for(int j = 0; j < 8; ++j) tmp2[j] = tmp[7-j];
-      b = tmp2.to_int();
-    }
+      b = m_reverse_bits(b, 8);
 
-    bytes.push_back(b);
+    bytes.push_back((unsigned char)b);
   }
 }
 
@@ -709,22 +706,77 @@ void uvm_packer::get_bytes( std::vector<unsigned char>& bytes ) const
 void uvm_packer::get_ints( std::vector<unsigned int>& ints ) const
 {
   unsigned int n = get_remaining_unpacked_bits();
+  if (n == 0)
+    return;
+
   unsigned int nints = 1 + (n-1)/32;
+  ints.reserve(ints.size() + nints);
 
   for (unsigned int i = 0; i < nints; i++)
   {
-    int b = (*m_bits).range(32*i+31, 32*i).to_int();
+    sc_dt::uint64 b = (m_words[i >> 1] >> (32 * (i & 1))) & 0xffffffffULL;
 
     if(big_endian)
-    {
-      sc_dt::sc_bv<32> tmp, tmp2;
-      tmp = b;
-      for(int j = 0; j < 32; ++j) tmp2[j] = tmp[31-j];
-      b = tmp2.to_int();
-    }
+      b = m_reverse_bits(b, 32);
+
+    ints.push_back((unsigned int)b);
+  }
+}
+
+//------------------------------------------------------------------------------
+// member function: get_bytes
+//
+//! Implementation defined
+//! Copies the packed stream to the caller-owned array \p bytes of \p size
+//! bytes, in the same format as get_bytes into a vector. Nothing is copied
+//! if the array is too small. Returns the number of bytes of the stream.
+//------------------------------------------------------------------------------
+
+unsigned int uvm_packer::get_bytes( unsigned char* bytes, unsigned int size ) const
+{
+  unsigned int n = get_remaining_unpacked_bits();
+  unsigned int nbytes = (n + 7) / 8;
+
+  if (bytes == NULL || nbytes > size)
+    return nbytes;
 
-    ints.push_back(b);
+  for (unsigned int i = 0; i < nbytes; i++)
+  {
+    unsigned char b = (unsigned char)(m_words[i >> 3] >> (8 * (i & 7)));
+    bytes[i] = big_endian ? uvm_packer_reversed_bytes[b] : b;
   }
+
+  return nbytes;
+}
+
+//------------------------------------------------------------------------------
+// member function: put_bytes
+//
+//! Implementation defined
+//! Unpacks directly from the caller-owned array \p bytes of \p nbytes
+//! bytes, without copying it. The array must stay valid until the
+//! unpacking is done and m_detach_bytes is called.
+//------------------------------------------------------------------------------
+
+void uvm_packer::put_bytes( const unsigned char* bytes, unsigned int nbytes )
+{
+  reset();
+  m_ext_bytes = bytes;
+  m_ext_size = nbytes;
+  pack_index = 8*nbytes;
+}
+
+//------------------------------------------------------------------------------
+// member function: m_detach_bytes
+//
+//! Implementation defined
+//! Stops unpacking from the array given to put_bytes.
+//------------------------------------------------------------------------------
+
+void uvm_packer::m_detach_bytes()
+{
+  m_ext_bytes = NULL;
+  m_ext_size = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -739,18 +791,8 @@ void uvm_packer::put_bits( const std::vector<bool>& bitstream )
   int bit_size = bitstream.size();
   m_set_size(bit_size);
 
-  if(!big_endian)
-    for (int i = 0; i < bit_size; i++)
-    {
-      (*m_bits)[i] = bitstream[i];
-    }
-  else
-    for (int i = bit_size-1; i >= 0; i--)
-    {
-      (*m_bits)[i] = bitstream[i];
-    }
-
-  pack_index = bit_size;
+  for (int i = 0; i < bit_size; i++)
+    m_put_bits(bitstream[i] ? 1 : 0, 1);
 }
 
 
@@ -766,17 +808,24 @@ void uvm_packer::put_bytes( const std::vector<unsigned char>& bytestream )
   int byte_size = bytestream.size();
   m_set_size(byte_size*8);
 
+  // bytes are collected in a word, and stored once the word is complete
+  sc_dt::uint64 w = 0;
   for (int i = 0; i < byte_size; i++)
   {
-    sc_dt::sc_bv<8> b = bytestream[i];
+    sc_dt::uint64 b = bytestream[i];
     if(big_endian)
+      b = m_reverse_bits(b, 8); // swap char first
+
+    w |= b << (8 * (i & 7));
+    if ((i & 7) == 7)
     {
-      sc_dt::sc_bv<8> tmp = b;
-      for(int j = 0; j < 8; ++j)
-        b[j] = tmp[7-j]; // swap char first
+      m_words[i >> 3] = w;
+      w = 0;
     }
-    (*m_bits).range(8*i+7,8*i) = b;
   }
+  if (byte_size & 7)
+    m_words[byte_size >> 3] = w;
+
   pack_index = 8*byte_size;
 }
 
@@ -795,17 +844,12 @@ void uvm_packer::put_ints( const std::vector<unsigned int>& intstream )
 
   for (int i = 0; i < int_size; i++)
   {
-    sc_dt::sc_bv<32> v = intstream[i];
+    sc_dt::uint64 v = intstream[i];
     if(big_endian)
-    {
-      sc_dt::sc_bv<32> tmp = v;
-      for(int j = 0; j < 32; ++j)
-        v[j] = tmp[31-j]; // swap int first
-    }
+      v = m_reverse_bits(v, 32); // swap int first
 
-    (*m_bits).range(32*i+31, 32*i) = v;
+    m_put_bits(v, 32);
   }
-  pack_index = 32*int_size;
 }
 
 
@@ -817,9 +861,10 @@ void uvm_packer::put_ints( const std::vector<unsigned int>& intstream )
 
 void uvm_packer::reset()
 {
+  // the stream keeps its capacity for the next pack
   pack_index = 0;
   unpack_index = 0;
-  m_size = 0;
+  m_detach_bytes();
 }
 
 
@@ -872,31 +917,26 @@ void uvm_packer::m_set_size( int nbits )
 
 void uvm_packer::m_allocate( int nbits, bool copy_ )
 {
-  // allocate new sc_bv_base with new size, and copy over contents from
-  // old sc_bv_base
+  // grow the stream geometrically, in multiples of the block size, so
+  // that packing large objects is not quadratic in their size
 
   int total_bits = pack_index + nbits;
+  if (total_bits <= m_size)
+    return;
+
   int new_size =
       ((total_bits - 1) / UVM_PACKING_BLOCK_SIZE + 1) * UVM_PACKING_BLOCK_SIZE;
+  if (new_size < 2 * m_size)
+    new_size = 2 * m_size;
 #ifdef _NCSC_DEBUG
   assert((new_size % UVM_PACKING_BLOCK_SIZE) == 0);
 #endif
-  m_size = new_size;
 
-  if (m_size > m_max_size)
-  { // need to allocate
-    m_max_size = m_size;
-    sc_dt::sc_bv_base* new_bv = new sc_dt::sc_bv_base(m_size);
-    if (m_bits)
-    {
-      if (copy_)
-      {
-        *new_bv = *m_bits;
-      }
-      delete m_bits;
-    }
-    m_bits = new_bv;
-  }
+  if (!copy_)
+    m_words.clear();
+
+  m_words.resize(new_size / 64, 0);
+  m_size = new_size;
 }
 
 
@@ -921,7 +961,7 @@ unsigned int uvm_packer::get_remaining_unpacked_bits() const
 void uvm_packer::m_check_size( int nbits )
 {
   int capacity = m_size - pack_index;
-  if (nbits >= capacity)
+  if (nbits > capacity)
   {
     m_allocate(nbits);
   }
@@ -946,6 +986,68 @@ void uvm_packer::inc_unpack_index( int n )
   }
 }
 
+//------------------------------------------------------------------------------
+// Member function: m_get_ext_bits
+//
+//! Implementation defined
+//! Same as m_get_bits, for the caller-owned array given to put_bytes. The
+//! bytes are gathered as put_bytes into a vector would store them.
+//------------------------------------------------------------------------------
+
+sc_dt::uint64 uvm_packer::m_get_ext_bits( unsigned int pos, int nbits ) const
+{
+  unsigned int first = pos >> 3;
+  unsigned int off = pos & 7;
+  unsigned int nbytes = (off + nbits + 7) >> 3; // at most 9
+
+  sc_dt::uint64 value = 0;
+  for (unsigned int i = 0; i < nbytes && i < 8; i++)
+  {
+    if (first + i >= m_ext_size)
+      break;
+    unsigned char b = m_ext_bytes[first + i];
+    value |= sc_dt::uint64(big_endian ? uvm_packer_reversed_bytes[b] : b) << (8 * i);
+  }
+  value >>= off;
+
+  if (nbytes == 9 && first + 8 < m_ext_size)
+  {
+    unsigned char b = m_ext_bytes[first + 8];
+    value |= sc_dt::uint64(big_endian ? uvm_packer_reversed_bytes[b] : b) << (64 - off);
+  }
+
+  if (nbits < 64)
+    value &= (sc_dt::uint64(1) << nbits) - 1;
+
+  return value;
+}
+
+
+//------------------------------------------------------------------------------
+// Member function: m_reverse_bits (static)
+//
+//! Implementation defined
+//! Returns the lower \p nbits bits (at most 64) of \p value in reversed
+//! order, as used for big-endian streams. The bytes are reversed through
+//! a lookup table.
+//------------------------------------------------------------------------------
+
+sc_dt::uint64 uvm_packer::m_reverse_bits( sc_dt::uint64 value, int nbits )
+{
+  if (nbits <= 0)
+    return 0;
+
+  sc_dt::uint64 r = 0;
+  for (int i = 0; i < 8; i++)
+  {
+    r = (r << 8) | uvm_packer_reversed_bytes[value & 0xff];
+    value >>= 8;
+  }
+
+  return r >> (64 - nbits);
+}
+
+
 //------------------------------------------------------------------------------
 // Member function: pack_char
 //
@@ -956,30 +1058,17 @@ void uvm_packer::pack_char( char a )
 {
   int nbits = 8;
   m_check_size(nbits);
-  sc_dt::sc_bv<8> b, c;
-  b = a;
 
+  sc_dt::uint64 c = (unsigned char)a;
   if (big_endian)
-  {
-    for (int i = 0; i < 8; i++)
-      c[i] = b[7-i];
-  }
-  else
-    c = b;
+    c = m_reverse_bits(c, 8);
 
-  (*m_bits)(pack_index + nbits - 1, pack_index) = c;
-  pack_index += nbits;
+  m_put_bits(c, nbits);
 
-  std::string s;
-  if (c.to_int())
-    s = (char)c.to_int();
-  else
-    s = "\0";
-
-  std::ostringstream str;
-  str << "uvm_packer::pack_char -> " << s << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  UVM_INFO("PCKCHR", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("PCKCHR",
+    "uvm_packer::pack_char -> " << std::string(c ? 1 : 0, (char)c) << std::endl <<
+    "pack_index = " << pack_index << std::endl,
+    uvm::UVM_DEBUG);
 }
 
 
@@ -992,24 +1081,19 @@ void uvm_packer::pack_char( char a )
 void uvm_packer::unpack_char( char& a )
 {
   unsigned nbits = 8;
-  sc_dt::sc_bv<8> b, c;
-  b = (*m_bits)(unpack_index + nbits - 1, unpack_index);
+  sc_dt::uint64 c = m_get_bits(unpack_index, nbits);
 
   inc_unpack_index(nbits);
 
   if (big_endian)
-  {
-    for (int i = 0; i < 8; i++)
-      c[i] = b[7-i];
-  }
-  else c = b;
+    c = m_reverse_bits(c, 8);
 
-  a = c.to_int();
+  a = (char)c;
 
-  std::ostringstream str;
-  str << "uvm_packer::unpack_char " << c.to_int() << std::endl;
-  str << "unpack_index = " << unpack_index << std::endl;
-  UVM_INFO("UNPCKCHR", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("UNPCKCHR",
+    "uvm_packer::unpack_char " << (int)c << std::endl <<
+    "unpack_index = " << unpack_index << std::endl,
+    uvm::UVM_DEBUG);
 }
 
 
@@ -1017,56 +1101,58 @@ void uvm_packer::pack_bool( bool a )
 {
   m_check_size(1);
 
-  (*m_bits)[pack_index] = a ? 1 : 0;
-  pack_index += 1;
+  m_put_bits(a ? 1 : 0, 1);
 
-  std::ostringstream str;
-  str << "uvm_packer::pack_bool: " << (a ? 1 : 0) << std::endl;
-  str << "pack_index = " << pack_index << std::endl;
-  UVM_INFO("PCKBOOL", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("PCKBOOL",
+    "uvm_packer::pack_bool: " << (a ? 1 : 0) << std::endl <<
+    "pack_index = " << pack_index << std::endl,
+    uvm::UVM_DEBUG);
 }
 
 
 
 void uvm_packer::unpack_bool( bool& a )
 {
-  a = (*m_bits)[unpack_index] == 1;
+  a = m_get_bits(unpack_index, 1) == 1;
 
   inc_unpack_index(1);
 
-  std::ostringstream str;
-  str << "uvm_packer::unpack_char " << (a ? 1 : 0) << std::endl;
-  str << "unpack_index = " << unpack_index << std::endl;
-  UVM_INFO("UNPCKBOOL", str.str(), uvm::UVM_DEBUG);
+  UVM_INFO_STREAM("UNPCKBOOL",
+    "uvm_packer::unpack_char " << (a ? 1 : 0) << std::endl <<
+    "unpack_index = " << unpack_index << std::endl,
+    uvm::UVM_DEBUG);
 
 }
 
 void uvm_packer::pack_sc_logic( const sc_dt::sc_logic& a )
 {
   m_check_size(1);
-  (*m_bits).set_bit(pack_index, a.value());
-  pack_index++;
+  m_put_bits(a.value() & 1, 1);
 }
 
 void uvm_packer::unpack_sc_logic( sc_dt::sc_logic& a )
 {
-  sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t((*m_bits).get_bit(unpack_index));
+  sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t(m_get_bits(unpack_index, 1));
   a = val;
   inc_unpack_index(1);
 }
 
+// bit and logic vectors are copied per 32-bit word of their data plane
+
 void uvm_packer::pack_sc_bv_base( const sc_dt::sc_bv_base& a )
 {
   int nbits = a.length();
   m_check_size(nbits);
-  (*m_bits)(pack_index + nbits - 1, pack_index) = a;
-  pack_index += nbits;
+  for (int lo = 0; lo < nbits; lo += 32)
+    m_put_bits(a.get_word(lo / 32), (nbits - lo < 32) ? nbits - lo : 32);
 }
 
 void uvm_packer::unpack_sc_bv_base( sc_dt::sc_bv_base& a )
 {
   int nbits = a.length();
-  a = (*m_bits)(unpack_index + nbits - 1, unpack_index);
+  for (int lo = 0; lo < nbits; lo += 32)
+    a.set_word(lo / 32, (unsigned int)m_get_bits(unpack_index + lo,
+                                                 (nbits - lo < 32) ? nbits - lo : 32));
   inc_unpack_index(nbits);
 }
 
@@ -1074,152 +1160,100 @@ void uvm_packer::pack_sc_lv_base( const sc_dt::sc_lv_base& a )
 {
   int n = a.length();
   m_check_size(n);
-  for (int i = 0; i < n; i++)
-  {
-    sc_dt::sc_logic_value_t val = a.get_bit(i);
-    (*m_bits).set_bit(pack_index, val);
-    pack_index++;
-  }
+  for (int lo = 0; lo < n; lo += 32)
+    m_put_bits(a.get_word(lo / 32), (n - lo < 32) ? n - lo : 32);
 }
 
 void uvm_packer::unpack_sc_lv_base( sc_dt::sc_lv_base& a )
 {
   int n = a.length();
-  for (int i = 0; i < n; i++)
+  for (int lo = 0; lo < n; lo += 32)
   {
-    sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t((*m_bits).get_bit(unpack_index));
-    a.set_bit(i, val);
-    unpack_index++;
+    a.set_word(lo / 32, (unsigned int)m_get_bits(unpack_index + lo,
+                                                 (n - lo < 32) ? n - lo : 32));
+    a.set_cword(lo / 32, 0);
   }
+  unpack_index += n;
 }
 
 void uvm_packer::pack_sc_int_base( const sc_dt::sc_int_base& a )
 {
   int n = a.length();
   m_check_size(n);
-  for (int i = 0; i < n; i++)
-  {
-    bool val = a.test(i);
-    if (val) {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_1);
-    } else {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_0);
-    }
-    pack_index++;
-  }
+  m_put_bits((sc_dt::uint64)a.to_int64(), n);
 }
 
 void uvm_packer::unpack_sc_int_base( sc_dt::sc_int_base& a )
 {
   int n = a.length();
-  for (int i = 0; i < n; i++)
-  {
-    sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t((*m_bits).get_bit(unpack_index));
-    if (val == sc_dt::Log_1)
-    {
-      a.set(i, true);
-    } else {
-      a.set(i, false);
-    }
-    unpack_index++;
-  }
+  sc_dt::uint64 v = m_get_bits(unpack_index, n);
+
+  // sign-extend from the length of the target
+  if (n < 64 && ((v >> (n - 1)) & 1))
+    v |= ~sc_dt::uint64(0) << n;
+
+  a = (sc_dt::int64)v;
+  unpack_index += n;
 }
 
 void uvm_packer::pack_sc_uint_base( const sc_dt::sc_uint_base& a )
 {
   int n = a.length();
   m_check_size(n);
-  for (int i = 0; i < n; i++)
-  {
-    bool val = a.test(i);
-    if (val)
-    {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_1);
-    } else {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_0);
-    }
-    pack_index++;
-  }
+  m_put_bits(a.to_uint64(), n);
 }
 
 void uvm_packer::unpack_sc_uint_base( sc_dt::sc_uint_base& a )
 {
   int n = a.length();
-  for (int i = 0; i < n; i++)
-  {
-    sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t((*m_bits).get_bit(unpack_index));
-    if (val == sc_dt::Log_1)
-    {
-      a.set(i, true);
-    } else {
-      a.set(i, false);
-    }
-    unpack_index++;
-  }
+  a = m_get_bits(unpack_index, n);
+  unpack_index += n;
 }
 
+// arbitrary precision integers are copied in chunks of 64 bits
+
 void uvm_packer::pack_sc_signed( const sc_dt::sc_signed& a )
 {
   int n = a.length();
   m_check_size(n);
-  for (int i = 0; i < n; i++) {
-    bool val = a.test(i);
-    if (val) {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_1);
-    } else {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_0);
-    }
-    pack_index++;
+  for (int lo = 0; lo < n; lo += 64)
+  {
+    int nbits = (n - lo < 64) ? n - lo : 64;
+    m_put_bits(a.range(lo + nbits - 1, lo).to_uint64(), nbits);
   }
 }
 
 void uvm_packer::unpack_sc_signed( sc_dt::sc_signed& a )
 {
   int n = a.length();
-  for (int i = 0; i < n; i++)
+  for (int lo = 0; lo < n; lo += 64)
   {
-    sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t((*m_bits).get_bit(unpack_index));
-    if (val == sc_dt::Log_1)
-    {
-      a.set(i, true);
-    } else {
-      a.set(i, false);
-    }
-    unpack_index++;
+    int nbits = (n - lo < 64) ? n - lo : 64;
+    a.range(lo + nbits - 1, lo) = m_get_bits(unpack_index + lo, nbits);
   }
+  unpack_index += n;
 }
 
 void uvm_packer::pack_sc_unsigned( const sc_dt::sc_unsigned& a )
 {
   int n = a.length();
   m_check_size(n);
-  for (int i = 0; i < n; i++)
+  for (int lo = 0; lo < n; lo += 64)
   {
-    bool val = a.test(i);
-    if (val)
-    {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_1);
-    } else {
-      (*m_bits).set_bit(pack_index, sc_dt::Log_0);
-    }
-    pack_index++;
+    int nbits = (n - lo < 64) ? n - lo : 64;
+    m_put_bits(a.range(lo + nbits - 1, lo).to_uint64(), nbits);
   }
 }
 
 void uvm_packer::unpack_sc_unsigned( sc_dt::sc_unsigned& a )
 {
   int n = a.length();
-  for (int i = 0; i < n; i++)
+  for (int lo = 0; lo < n; lo += 64)
   {
-    sc_dt::sc_logic_value_t val = sc_dt::sc_logic_value_t((*m_bits).get_bit(unpack_index));
-    if (val == sc_dt::Log_1)
-    {
-      a.set(i, true);
-    } else {
-      a.set(i, false);
-    }
-    unpack_index++;
+    int nbits = (n - lo < 64) ? n - lo : 64;
+    a.range(lo + nbits - 1, lo) = m_get_bits(unpack_index + lo, nbits);
   }
+  unpack_index += n;
 }
 
 
@@ -25,6 +25,7 @@
 
 #include <systemc>
 #include <sstream>
+#include <vector>
 
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/misc/uvm_scope_stack.h"
@@ -35,6 +36,8 @@ namespace uvm {
 
 // forward class references
 class uvm_object;
+class uvm_layout_access;
+class uvm_hasher;
 
 //------------------------------------------------------------------------------
 // Class: uvm_packer
@@ -52,6 +55,8 @@ class uvm_packer
 {
  public:
   friend class uvm_object;
+  friend class uvm_layout_access;
+  friend class uvm_hasher;
 
   //--------------------------------------------------------------------------
   // UVM Standard LRM API below
@@ -286,9 +291,14 @@ class uvm_packer
 
   uvm_recursion_policy_enum policy;
 
-  sc_dt::sc_bv_base* m_bits; // TODO was uvm_pack_bitstream_t m_bits;
+  // the packed stream: bit i is stored in bit i%64 of word i/64; m_size
+  // is the capacity in bits, grown geometrically by m_allocate
+  std::vector<sc_dt::uint64> m_words;
   int m_size;
-  int m_max_size;
+
+  // caller-owned bytes being unpacked in place of m_words, if not NULL
+  const unsigned char* m_ext_bytes;
+  unsigned int m_ext_size;
 
   virtual void get_bits( std::vector<bool>& bits ) const;
   virtual void get_bytes( std::vector<unsigned char>& bytes ) const;
@@ -298,6 +308,10 @@ class uvm_packer
   virtual void put_bytes( const std::vector<unsigned char>& bytestream );
   virtual void put_ints( const std::vector<unsigned int>& intstream );
 
+  unsigned int get_bytes( unsigned char* bytes, unsigned int size ) const;
+  void put_bytes( const unsigned char* bytes, unsigned int nbytes );
+  void m_detach_bytes();
+
   void reset();
 
   bool m_enough_bits( int needed, std::string id ) const;
@@ -312,6 +326,12 @@ class uvm_packer
 
   void inc_unpack_index( int n );
 
+  void m_put_bits( sc_dt::uint64 value, int nbits );
+  sc_dt::uint64 m_get_bits( unsigned int pos, int nbits ) const;
+  sc_dt::uint64 m_get_ext_bits( unsigned int pos, int nbits ) const;
+
+  static sc_dt::uint64 m_reverse_bits( sc_dt::uint64 value, int nbits );
+
   void pack_char( char a );
   void unpack_char( char& a );
 
@@ -342,6 +362,71 @@ class uvm_packer
   void set_packed_size();
 };
 
+//------------------------------------------------------------------------------
+// Member function: m_put_bits
+//
+//! Implementation defined
+//! Appends the lower \p nbits bits (at most 64) of \p value at pack_index.
+//! The bits of the stream above the new pack_index are cleared, so the
+//! unused bits of the last byte or int of the stream are always zero. The
+//! caller must have reserved the space with m_check_size.
+//------------------------------------------------------------------------------
+
+inline void uvm_packer::m_put_bits( sc_dt::uint64 value, int nbits )
+{
+  if (nbits <= 0)
+    return;
+
+  if (nbits < 64)
+    value &= (sc_dt::uint64(1) << nbits) - 1;
+
+  unsigned int w = pack_index >> 6;
+  unsigned int off = pack_index & 63;
+
+  if (off == 0)
+    m_words[w] = value;
+  else
+  {
+    m_words[w] = (m_words[w] & ((sc_dt::uint64(1) << off) - 1)) | (value << off);
+    if (off + nbits > 64)
+      m_words[w + 1] = value >> (64 - off);
+  }
+
+  pack_index += nbits;
+}
+
+//------------------------------------------------------------------------------
+// Member function: m_get_bits
+//
+//! Implementation defined
+//! Returns the \p nbits bits (at most 64) of the stream starting at bit
+//! \p pos. Bits beyond the end of the stream read as zero.
+//------------------------------------------------------------------------------
+
+inline sc_dt::uint64 uvm_packer::m_get_bits( unsigned int pos, int nbits ) const
+{
+  if (nbits <= 0)
+    return 0;
+
+  if (m_ext_bytes != NULL)
+    return m_get_ext_bits(pos, nbits);
+
+  unsigned int w = pos >> 6;
+  unsigned int off = pos & 63;
+
+  if (w >= m_words.size())
+    return 0;
+
+  sc_dt::uint64 value = m_words[w] >> off;
+  if (off != 0 && off + nbits > 64 && w + 1 < m_words.size())
+    value |= m_words[w + 1] << (64 - off);
+
+  if (nbits < 64)
+    value &= (sc_dt::uint64(1) << nbits) - 1;
+
+  return value;
+}
+
 } // namespace uvm
 
 #endif // UVM_PACKER_H_
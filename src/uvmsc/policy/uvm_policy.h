@@ -22,6 +22,8 @@
 
 #include "uvmsc/policy/uvm_recorder.h"
 #include "uvmsc/policy/uvm_comparer.h"
+#include "uvmsc/policy/uvm_hasher.h"
 #include "uvmsc/policy/uvm_packer.h"
+#include "uvmsc/policy/uvm_layout.h"
 
 #endif /* UVM_POLICY_H_ */
@@ -27,18 +27,15 @@
 #include "uvmsc/policy/uvm_recorder.h"
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/misc/uvm_status_container.h"
+#include "uvmsc/base/uvm_tr_database.h"
+#include "uvmsc/base/uvm_coreservice_t.h"
+#include "uvmsc/base/uvm_default_coreservice_t.h"
 
 using namespace sc_core;
 using namespace sc_dt;
 
 namespace uvm {
 
-//----------------------------------------------------------------------
-// Static data member initialization here
-//----------------------------------------------------------------------
-
-int uvm_recorder::handle = 0;
-
 //--------------------------------------------------------------------------
 // Constructor
 //--------------------------------------------------------------------------
@@ -51,9 +48,7 @@ uvm_recorder::uvm_recorder( const std::string& name ) : uvm_object(name)
   identifier = true;
   policy = UVM_DEFAULT_POLICY;
   scope = new uvm_scope_stack();
-  filename = "tr_db.log";
-
-  outstr = NULL;
+  m_db = NULL;
 }
 
 //--------------------------------------------------------------------------
@@ -76,26 +71,21 @@ uvm_recorder::~uvm_recorder()
 //! name of the field.
 //!
 //! \p value is the value of the field to record. \p size is the number of bits
-//! of the field which apply. \p radix is the #uvm_radix_enum to use.
+//! of the field which apply. The value is recorded in binary; \p radix is
+//! not used by the default database.
 //--------------------------------------------------------------------------
 
 void uvm_recorder::record_field( const std::string& name,
                                  uvm_bitstream_t value,
                                  int size,
-                                 uvm_radix_enum radix )
+                                 uvm_radix_enum )
 {
   if(tr_handle==0)
     return;
 
   scope->set_arg(name);
 
-  if(!radix)
-    radix = default_radix;
-
-  std::ostringstream str;
-  str << value.to_string(SC_BIN);
-
-  set_attribute(tr_handle, scope->get(), str.str(), radix, size);
+  get_db()->set_attribute(tr_handle, scope->get(), value, size);
 }
 
 //--------------------------------------------------------------------------
@@ -107,15 +97,12 @@ void uvm_recorder::record_field( const std::string& name,
 void uvm_recorder::record_field_real( const std::string& name,
                                       double value)
 {
-  std::ostringstream str;
-  str << value;
-
   if(tr_handle == 0)
     return;
 
   scope->set_arg(name);
 
-  set_attribute( tr_handle, scope->get(), str.str(), UVM_REAL, 64);
+  get_db()->set_attribute_real(tr_handle, scope->get(), value);
 }
 
 
@@ -130,16 +117,10 @@ void uvm_recorder::record_field_real( const std::string& name,
 
 void uvm_recorder::record_object( const std::string& name, uvm_object* value )
 {
-  std::ostringstream str;
-
-  if(identifier)
+  if(identifier && value != NULL)
   {
-    if(value != NULL)
-    {
-      str << value->get_inst_id();
-    }
     scope->set_arg(name);
-    set_attribute(tr_handle, scope->get(), str.str(), UVM_DEC, 32);
+    get_db()->set_attribute_int(tr_handle, scope->get(), value->get_inst_id(), 32);
   }
 
   if(policy != UVM_REFERENCE)
@@ -166,13 +147,12 @@ void uvm_recorder::record_object( const std::string& name, uvm_object* value )
 
 void uvm_recorder::record_string( const std::string& name, const std::string& value)
 {
+  if(tr_handle == 0)
+    return;
+
   scope->set_arg(name);
 
-  set_attribute( tr_handle,
-                 scope->get(),
-                 value,
-                 UVM_STRING,
-                 8*value.length());
+  get_db()->set_attribute_string(tr_handle, scope->get(), value);
 }
 
 
@@ -180,17 +160,17 @@ void uvm_recorder::record_string( const std::string& name, const std::string& va
 // member function: record_time
 //
 //! Records a time value. \p name is the name to record to the database.
+//! The time is recorded in units of the time resolution.
 //--------------------------------------------------------------------------
 
 void uvm_recorder::record_time( const std::string& name, const sc_time& value )
 {
+  if(tr_handle == 0)
+    return;
+
   scope->set_arg(name);
 
-  set_attribute( tr_handle,
-                 scope->get(),
-                 value.to_string(),
-                 UVM_TIME,
-                 64 );
+  get_db()->set_attribute_int(tr_handle, scope->get(), value.value(), 64);
 }
 
 
@@ -203,51 +183,48 @@ void uvm_recorder::record_time( const std::string& name, const sc_time& value )
 
 void uvm_recorder::record_generic( const std::string& name, const std::string& value )
 {
+  if(tr_handle == 0)
+    return;
+
   scope->set_arg(name);
 
-  set_attribute( tr_handle,
-                 scope->get(),
-                 value,
-                 UVM_STRING,
-                 8*value.length());
+  get_db()->set_attribute_string(tr_handle, scope->get(), value);
 }
 
-
 //--------------------------------------------------------------------------
-// Group: Vendor-Independent API
+// member function: set_db
 //
-// UVM provides only a text-based default implementation.
-// Vendors provide subtype implementations and overwrite the
-// #uvm_default_recorder handle.
+//! Sets the database to which this recorder writes. The database is not
+//! owned by the recorder.
 //--------------------------------------------------------------------------
 
+void uvm_recorder::set_db( uvm_tr_database* db )
+{
+  m_db = db;
+}
 
 //--------------------------------------------------------------------------
-// member function: open_file
-//
-//! Opens the file in the #filename property and assigns to the
-//! file descriptor #FILE.
+// member function: get_db
 //
+//! Returns the database to which this recorder writes. Unless set with
+//! #set_db, this is the default database of the core service.
 //--------------------------------------------------------------------------
 
-bool uvm_recorder::open_file()
+uvm_tr_database* uvm_recorder::get_db()
 {
-  std::ios_base::openmode mode = std::ios_base::out;
+  if (m_db == NULL)
+    m_db = uvm_coreservice_t::get()->get_default_tr_database();
+  return m_db;
+}
 
-  if(!file)
-    file.open(filename.c_str(), mode);
 
-  if(file)
-  {
-    outstr = &file;
-    return true;
-  }
-  else
-  {
-    outstr = NULL;
-    return false;
-  }
-}
+//--------------------------------------------------------------------------
+// Group: Vendor-Independent API
+//
+// The default implementation writes to the #uvm_tr_database returned by
+// get_db. Vendors provide subtype implementations and overwrite the
+// #uvm_default_recorder handle.
+//--------------------------------------------------------------------------
 
 
 //--------------------------------------------------------------------------
@@ -258,19 +235,10 @@ int uvm_recorder::create_stream( const std::string& name,
                                  const std::string& t,
                                  const std::string& scope )
 {
-  if (open_file())
-  {
-    m_handles()[++handle] = 1;
-
-   *outstr << "CREATE_STREAM @" << sc_time_stamp()
-           << "NAME: " << name
-           << "T: " << t
-           << "SCOPE: " << scope
-           << "STREAM: " << handle;
+  uvm_tr_database* db = get_db();
+  uvm_tr_stream* stream = db->open_stream(name, scope, t);
 
-    return handle;
-  }
-  return 0;
+  return db->is_open() ? stream->get_handle() : 0;
 }
 
 
@@ -282,36 +250,24 @@ void uvm_recorder::m_set_attribute( int txh,
                                     const std::string& nm,
                                     const std::string& value )
 {
-  if (open_file())
-  {
-    *outstr << "SET_ATTR @" << sc_time_stamp()
-            << "TXH: " << txh
-            << "NAME: " << nm
-            << "VALUE: " << value;
-  }
+  get_db()->set_attribute_string(txh, nm, value);
 }
 
 
 //--------------------------------------------------------------------------
 // member function: set_attribute
+//
+// The value is recorded as a string; the radix and number of bits are
+// not used by the default database.
 //--------------------------------------------------------------------------
 
 void uvm_recorder::set_attribute( int txh,
                                   const std::string& nm,
                                   const std::string& value, // TODO was logic [1023:0]
-                                  uvm_radix_enum radix,
-                                  int numbits)
+                                  uvm_radix_enum,
+                                  int )
 {
-  if (open_file())
-  {
-    *outstr << "SET_ATTR @" << sc_time_stamp()
-            << "TXH: " << txh
-            << "NAME: " << nm
-            << "VALUE: " << value
-            << "RADIX: " << uvm_radix_enum_name[radix]
-            << "BITS = " << numbits;
-  }
-
+  get_db()->set_attribute_string(txh, nm, value);
 }
 
 
@@ -321,37 +277,35 @@ void uvm_recorder::set_attribute( int txh,
 
 bool uvm_recorder::check_handle_kind( const std::string& htype, int handle )
 {
-  return (m_handles().find(handle) != m_handles().end()); //exists
+  if (htype == "Fiber")
+    return get_db()->m_get_stream(handle) != NULL;
+  return get_db()->is_valid_handle(handle);
 }
 
 
 //--------------------------------------------------------------------------
 // member function: begin_tr
+//
+// The default database does not distinguish transaction types, so
+// txtype is not recorded.
 //--------------------------------------------------------------------------
 
-int uvm_recorder::begin_tr( const std::string& txtype,
+int uvm_recorder::begin_tr( const std::string&,
                             int stream,
                             const std::string& nm,
                             const std::string& label,
                             const std::string& desc,
                             const sc_time begin_time )
 {
-  if (open_file())
-  {
-    m_handles()[++handle] = 1;
-
-    *outstr << "BEGIN @" << sc_time_stamp()
-            << "TXH: " << handle
-            << "STREAM: " << stream
-            << "NAME: " << nm
-            << "TIME = " << begin_time
-            << "TYPE = " << txtype
-            << "LABEL: " << label
-            << "DESC: " << desc;
-
-    return handle;
-  }
-  return -1;
+  uvm_tr_database* db = get_db();
+  int handle = db->begin_tr(db->m_get_stream(stream), nm, begin_time);
+
+  if (!label.empty())
+    db->set_attribute_string(handle, "label", label);
+  if (!desc.empty())
+    db->set_attribute_string(handle, "desc", desc);
+
+  return handle;
 }
 
 
@@ -361,12 +315,7 @@ int uvm_recorder::begin_tr( const std::string& txtype,
 
 void uvm_recorder::end_tr( int handle, sc_time end_time )
 {
-  if (open_file())
-  {
-    *outstr << "END @" << sc_time_stamp()
-            << "TXH: " << handle
-            << "TIME= " << end_time;
-  }
+  get_db()->end_tr(handle, end_time);
 }
 
 //--------------------------------------------------------------------------
@@ -377,39 +326,18 @@ void uvm_recorder::link_tr( int h1,
                             int h2,
                             const std::string& relation )
 {
-  if (open_file())
-  {
-    *outstr << "LINK @" << sc_time_stamp()
-            << "TXH1: " << h1
-            << "TXH2: " << h2
-            << "RELATION= " << relation;
-  }
+  get_db()->establish_link(h1, h2, relation);
 }
 
 //--------------------------------------------------------------------------
 // member function: free_tr
+//
+// The records of a transaction are written when they are made, so there
+// is nothing left to release.
 //--------------------------------------------------------------------------
 
-void uvm_recorder::free_tr( int handle )
-{
-  if (open_file())
-  {
-    *outstr << "FREE @" << sc_time_stamp()
-            << "TXH: " << handle;
-
-    if (m_handles().find(handle) != m_handles().end()) //exists
-      m_handles().erase(handle);
-  }
-}
-
-//--------------------------------------------------------------------------
-// member function: m_handles (static)
-//--------------------------------------------------------------------------
-
-std::map<int, bool>& uvm_recorder::m_handles()
+void uvm_recorder::free_tr( int )
 {
-  static std::map<int, bool> handles;
-  return handles;
 }
 
 /////////////
@@ -35,6 +35,7 @@ namespace uvm {
 
 // forward class declarations
 class uvm_scope_stack;
+class uvm_tr_database;
 
 //------------------------------------------------------------------------------
 // CLASS: uvm_recorder
@@ -45,6 +46,9 @@ class uvm_scope_stack;
 //!
 //! A default recorder instance, #uvm_default_recorder, is used when the
 //! uvm_object::record is called without specifying a recorder.
+//!
+//! The recorder writes to a #uvm_tr_database, by default the database of
+//! the core service. Integral fields are recorded as binary values.
 //----------------------------------------------------------------------------
 
 
@@ -75,6 +79,10 @@ class uvm_recorder : public uvm_object
 
   virtual void record_generic( const std::string& name, const std::string& value );
 
+  void set_db( uvm_tr_database* db );
+
+  uvm_tr_database* get_db();
+
 
   //--------------------------------------------------------------------------
   // data member: tr_handle
@@ -150,17 +158,9 @@ class uvm_recorder : public uvm_object
  private:
 
 
-  std::ofstream file;
-  std::ostream* outstr;
-  std::string filename;
-
   uvm_scope_stack* scope;
 
-  static int handle;
-
-  static std::map<int, bool>& m_handles();
-
-  virtual bool open_file();
+  uvm_tr_database* m_db;
 
   virtual int create_stream( const std::string& name,
                              const std::string& t,
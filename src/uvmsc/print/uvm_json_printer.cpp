@@ -0,0 +1,259 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <systemc>
+
+#include "uvmsc/print/uvm_json_printer.h"
+
+//////////////
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// Class implementation: uvm_json_printer
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Constructor
+//
+//! Creates a new instance of #uvm_json_printer
+//------------------------------------------------------------------------------
+
+uvm_json_printer::uvm_json_printer()
+: m_written(false), m_stream(NULL)
+{}
+
+//------------------------------------------------------------------------------
+// Destructor
+//------------------------------------------------------------------------------
+
+uvm_json_printer::~uvm_json_printer()
+{
+}
+
+//------------------------------------------------------------------------------
+// member function: emit
+//
+//! Completes the JSON output of the prior calls to print_* and returns
+//! it. Returns an empty string if the output is written to a stream set
+//! with #set_stream.
+//------------------------------------------------------------------------------
+
+std::string uvm_json_printer::emit()
+{
+  m_close(0);
+  if (m_written)
+    m_write("\n");
+  m_written = false;
+  m_num_rows = 0;
+
+  std::string s = m_buffer;
+  m_buffer.clear(); // keeps the capacity for the next object
+  return s;
+}
+
+//------------------------------------------------------------------------------
+// member function: emit
+//
+//! Completes the JSON output of the prior calls to print_* and writes it
+//! to \p os.
+//------------------------------------------------------------------------------
+
+void uvm_json_printer::emit( std::ostream& os )
+{
+  m_close(0);
+  if (m_written)
+    m_write("\n");
+  m_written = false;
+  m_num_rows = 0;
+
+  os << m_buffer;
+  m_buffer.clear();
+}
+
+//------------------------------------------------------------------------------
+// member function: set_stream
+//
+//! Writes the output directly to \p os as the fields are printed, instead
+//! of collecting it for emit. Passing NULL restores the default.
+//------------------------------------------------------------------------------
+
+void uvm_json_printer::set_stream( std::ostream* os )
+{
+  m_stream = os;
+}
+
+//------------------------------------------------------------------------------
+// member function: get_stream
+//
+//! Returns the stream set with #set_stream, or NULL.
+//------------------------------------------------------------------------------
+
+std::ostream* uvm_json_printer::get_stream() const
+{
+  return m_stream;
+}
+
+////////////////////////////////////////////////////////////////////////
+//////// Implementation-defined member functions start here ////////////
+////////////////////////////////////////////////////////////////////////
+
+//------------------------------------------------------------------------------
+// member function: m_row_added
+//
+//! Implementation defined
+//!
+//! Writes the row just printed. The JSON object of the row is left open,
+//! as rows printed next at a deeper level are its fields. It is closed
+//! when a row at the same or a higher level arrives, or by emit.
+//------------------------------------------------------------------------------
+
+void uvm_json_printer::m_row_added() const
+{
+  const uvm_printer_row_info& row = m_rows[m_num_rows - 1];
+
+  m_close(row.level);
+
+  if (!m_open.empty())
+  {
+    if (m_open.back().has_fields)
+      m_write(",");
+    else
+    {
+      m_write(",\"fields\":[");
+      m_open.back().has_fields = true;
+    }
+  }
+  else if (m_written)
+    m_write("\n");
+
+  m_write("{");
+  bool first = true;
+  if (knobs.identifier)
+  {
+    m_write_member("name", row.name);
+    first = false;
+  }
+  if (knobs.type_name)
+  {
+    if (!first) m_write(",");
+    m_write_member("type", row.type_name);
+    first = false;
+  }
+  if (knobs.size)
+  {
+    if (!first) m_write(",");
+    m_write_member("size", row.size);
+    first = false;
+  }
+  if (!first) m_write(",");
+  m_write_member("value", row.val);
+
+  m_open_object obj;
+  obj.level = row.level;
+  obj.has_fields = false;
+  m_open.push_back(obj);
+  m_written = true;
+
+  m_num_rows--; // no rows are kept
+}
+
+//------------------------------------------------------------------------------
+// member function: m_close
+//
+//! Implementation defined
+//!
+//! Closes the open JSON objects at \p level or deeper.
+//------------------------------------------------------------------------------
+
+void uvm_json_printer::m_close( int level ) const
+{
+  while (!m_open.empty() && m_open.back().level >= level)
+  {
+    m_write(m_open.back().has_fields ? "]}" : "}");
+    m_open.pop_back();
+  }
+}
+
+//------------------------------------------------------------------------------
+// member function: m_write_member
+//
+//! Implementation defined
+//!
+//! Writes the member \p key with the string \p value, escaped for JSON.
+//------------------------------------------------------------------------------
+
+void uvm_json_printer::m_write_member( const char* key, const std::string& value ) const
+{
+  static const char hex[] = "0123456789abcdef";
+
+  m_scratch.clear();
+  m_scratch += '"';
+  m_scratch += key;
+  m_scratch += "\":\"";
+  for (std::string::const_iterator it = value.begin(); it != value.end(); it++)
+  {
+    unsigned char c = *it;
+    switch (c)
+    {
+      case '"':  m_scratch += "\\\""; break;
+      case '\\': m_scratch += "\\\\"; break;
+      case '\n': m_scratch += "\\n"; break;
+      case '\r': m_scratch += "\\r"; break;
+      case '\t': m_scratch += "\\t"; break;
+      default:
+        if (c < 0x20)
+        {
+          m_scratch += "\\u00";
+          m_scratch += hex[c >> 4];
+          m_scratch += hex[c & 0xf];
+        }
+        else
+          m_scratch += c;
+    }
+  }
+  m_scratch += '"';
+  m_write(m_scratch);
+}
+
+//------------------------------------------------------------------------------
+// member function: m_write
+//
+//! Implementation defined
+//------------------------------------------------------------------------------
+
+void uvm_json_printer::m_write( const char* s ) const
+{
+  if (m_stream != NULL)
+    *m_stream << s;
+  else
+    m_buffer += s;
+}
+
+void uvm_json_printer::m_write( const std::string& s ) const
+{
+  if (m_stream != NULL)
+    *m_stream << s;
+  else
+    m_buffer += s;
+}
+
+//////////////
+
+} // namespace uvm
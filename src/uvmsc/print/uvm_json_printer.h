@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_JSON_PRINTER_H_
+#define UVM_JSON_PRINTER_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <systemc>
+
+#include "uvmsc/print/uvm_printer.h"
+
+
+//////////////
+
+namespace uvm {
+
+
+//------------------------------------------------------------------------------
+// Class: uvm_json_printer
+//
+//! The JSON printer writes each field in JSON format as soon as it is
+//! printed, without collecting the rows or calculating column widths.
+//! Each top-level object is written as one JSON object on a line of its
+//! own:
+//!
+//!   {"name":"pkt","type":"packet","size":"-","value":"@12","fields":[
+//!     {"name":"addr","type":"int","size":"32","value":"'h1000"}]}
+//!
+//! (without the line break shown). The members name, type and size are
+//! written when the corresponding knobs are set. Values are written as
+//! the same strings the other printers show, in the radix selected by the
+//! knobs.
+//!
+//! By default the output is collected in a string, which is returned by
+//! emit. With #set_stream, the output is instead written directly to the
+//! given stream as it is produced.
+//------------------------------------------------------------------------------
+
+class uvm_json_printer : public uvm_printer
+{
+ public:
+  uvm_json_printer();
+  virtual ~uvm_json_printer();
+
+  virtual std::string emit();
+  virtual void emit( std::ostream& os );
+
+  void set_stream( std::ostream* os );
+  std::ostream* get_stream() const;
+
+  /////////////////////////////////////////////////////
+  // Implementation-defined member functions below,
+  // not part of UVM Class reference / LRM
+  /////////////////////////////////////////////////////
+
+ protected:
+  virtual void m_row_added() const;
+
+  void m_close( int level ) const;
+  void m_write_member( const char* key, const std::string& value ) const;
+  void m_write( const char* s ) const;
+  void m_write( const std::string& s ) const;
+
+  // open JSON objects, with their level and whether their fields have started
+  struct m_open_object
+  {
+    int level;
+    bool has_fields;
+  };
+
+  mutable std::vector<m_open_object> m_open;
+  mutable std::string m_buffer;
+  mutable std::string m_scratch;
+  mutable bool m_written;
+  std::ostream* m_stream;
+};
+
+//////////////
+
+} // namespace uvm
+
+#endif /* UVM_JSON_PRINTER_H_ */
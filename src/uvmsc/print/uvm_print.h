@@ -25,6 +25,7 @@
 #include "uvmsc/print/uvm_table_printer.h"
 #include "uvmsc/print/uvm_tree_printer.h"
 #include "uvmsc/print/uvm_line_printer.h"
+#include "uvmsc/print/uvm_json_printer.h"
 #include "uvmsc/print/uvm_printer_knobs.h"
 
 #endif /* UVM_PRINT_H_ */
@@ -23,6 +23,7 @@
 //----------------------------------------------------------------------
 
 #include <sstream>
+#include <cstdio>
 
 #include "uvmsc/base/uvm_component.h"
 #include "uvmsc/base/uvm_object.h"
@@ -61,7 +62,6 @@ void uvm_printer::print_field( const std::string& name,
                                const char* scope_separator,
                                const std::string& type_name ) const
 {
-  uvm_printer_row_info row_info;
   std::string sz_str, val_str;
   std::string loc_type_name = type_name;
 
@@ -84,9 +84,7 @@ void uvm_printer::print_field( const std::string& name,
   if (size == -1)
     size = value.length();
 
-  std::ostringstream str;
-  str << size;
-  sz_str = str.str(); //itoa
+  sz_str = m_int_str(size);
 
   if(radix == UVM_NORADIX)
     radix = knobs.default_radix;
@@ -94,13 +92,13 @@ void uvm_printer::print_field( const std::string& name,
   val_str = uvm_vector_to_string( value, size, radix,
                                   knobs.get_radix_str(radix));
 
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
   row_info.name = adjust_name(m_scope.get(), scope_separator);
   row_info.type_name = loc_type_name;
   row_info.size = sz_str;
   row_info.val = val_str;
-
-  m_rows.push_back(row_info);
+  m_row_added();
 }
 
 //----------------------------------------------------------------------
@@ -125,7 +123,6 @@ void uvm_printer::print_field_int( const std::string& name,
                                    const char* scope_separator,
                                    const std::string& type_name ) const
 {
-  uvm_printer_row_info row_info;
   std::string sz_str, val_str;
   std::string loc_type_name = type_name;
 
@@ -148,9 +145,7 @@ void uvm_printer::print_field_int( const std::string& name,
   if (size == -1)
     size = value.length();
 
-  std::ostringstream str;
-  str << size;
-  sz_str = str.str(); //itoa
+  sz_str = m_int_str(size);
 
   if(radix == UVM_NORADIX)
     radix = knobs.default_radix;
@@ -158,13 +153,13 @@ void uvm_printer::print_field_int( const std::string& name,
   val_str = uvm_vector_to_string( value.to_int(), size, radix,
                                   knobs.get_radix_str(radix));
 
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
   row_info.name = adjust_name(m_scope.get(), scope_separator);
   row_info.type_name = loc_type_name;
   row_info.size = sz_str;
   row_info.val = val_str;
-
-  m_rows.push_back(row_info);
+  m_row_added();
 }
 
 
@@ -178,27 +173,22 @@ void uvm_printer::print_real( const std::string& name,
                               double value,
                               const char* scope_separator ) const
 {
-  uvm_printer_row_info row_info;
-
   if (!name.empty() && name != "...")
   {
     m_scope.set_arg(name);
     //name = m_scope.get(); // no need to return changed name
   }
 
-  std::ostringstream str_size;
-  str_size << sizeof(value)*CHAR_BIT;
-
   std::ostringstream str_val;
   str_val << value;
 
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
   row_info.name = adjust_name(m_scope.get(), scope_separator);
   row_info.type_name = "double";
-  row_info.size = str_size.str();
+  row_info.size = m_int_str(sizeof(value)*CHAR_BIT);
   row_info.val = str_val.str();
-
-  m_rows.push_back(row_info);
+  m_row_added();
 }
 
 //----------------------------------------------------------------------
@@ -279,7 +269,6 @@ void uvm_printer::print_object_header( const std::string& name,
                                        const uvm_object& obj,
                                        const char* scope_separator ) const
 {
-  uvm_printer_row_info row_info;
   const uvm_component* comp;
   std::string lname = name;
 
@@ -301,6 +290,8 @@ void uvm_printer::print_object_header( const std::string& name,
     lname = "<unnamed>";
 
   m_scope.set_arg(lname);
+
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
 
   if(row_info.level == 0 && knobs.show_root == true)
@@ -311,8 +302,7 @@ void uvm_printer::print_object_header( const std::string& name,
   row_info.type_name = (objp != NULL) ?  objp->get_type_name() : "object";
   row_info.size = "-";
   row_info.val = knobs.reference ? uvm_object_value_str(objp) : "-";
-
-  m_rows.push_back(row_info);
+  m_row_added();
 }
 
 //----------------------------------------------------------------------
@@ -325,23 +315,16 @@ void uvm_printer::print_string( const std::string& name,
                                 const std::string& value,
                                 const char* scope_separator ) const
 {
-  uvm_printer_row_info row_info;
-  std::string lname = name;
-
   if(!name.empty())
     m_scope.set_arg(name);
 
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
   row_info.name = adjust_name(m_scope.get(),scope_separator);
   row_info.type_name = "string";
-
-  std::ostringstream str;
-  str << value.length();
-
-  row_info.size = str.str();
+  row_info.size = m_int_str(value.length());
   row_info.val = (value.empty() ? "\"\"" : value);
-
-  m_rows.push_back(row_info);
+  m_row_added();
 }
 
 //----------------------------------------------------------------------
@@ -371,7 +354,6 @@ void uvm_printer::print_generic( const std::string& name,
                                  const std::string& value,
                                  const char* scope_separator ) const
 {
-  uvm_printer_row_info row_info;
   std::string lname = name;
 
   if (!name.empty() && name != "...")
@@ -380,15 +362,13 @@ void uvm_printer::print_generic( const std::string& name,
     lname = m_scope.get();
   }
 
-  std::ostringstream str;
-  str << size;
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
   row_info.name = adjust_name(lname, scope_separator);
   row_info.type_name = type_name;
-  row_info.size = (size == -2 ? "..." : str.str());
+  row_info.size = (size == -2 ? std::string("...") : m_int_str(size));
   row_info.val = (value.empty() ? "\"\"" : value);
-
-  m_rows.push_back(row_info);
+  m_row_added();
 }
 
 //----------------------------------------------------------------------
@@ -404,6 +384,20 @@ std::string uvm_printer::emit()
   return "";
 }
 
+//----------------------------------------------------------------------
+// member function: emit
+//
+//! Writes the output of #emit to \p os. Printers override this member
+//! function to write their output in a single pass, without building
+//! it in a string first. The default implementation writes the string
+//! returned by #emit.
+//----------------------------------------------------------------------
+
+void uvm_printer::emit( std::ostream& os )
+{
+  os << emit();
+}
+
 //----------------------------------------------------------------------
 // member function: format_row
 //
@@ -466,22 +460,16 @@ void uvm_printer::print_array_header( const std::string& name,
                                       const std::string& arraytype,
                                       const char* scope_separator ) const
 {
-  uvm_printer_row_info row_info;
-
   if(!name.empty())
     m_scope.set_arg(name);
 
+  uvm_printer_row_info& row_info = m_add_row();
   row_info.level = m_scope.depth();
   row_info.name = adjust_name(m_scope.get(),scope_separator);
   row_info.type_name = arraytype;
-
-  std::ostringstream str;
-  str << size;
-
-  row_info.size = str.str();
+  row_info.size = m_int_str(size);
   row_info.val = "-";
-
-  m_rows.push_back(row_info);
+  m_row_added();
 
   m_scope.down(name);
   const_cast<uvm_printer *>(this)->m_array_stack.push_back(true);
@@ -539,6 +527,7 @@ void uvm_printer::print_array_footer( int size ) const
 //----------------------------------------------------------------------
 
 uvm_printer::uvm_printer()
+: m_num_rows(0)
 {
   uvm_scope_stack m_scope;
 }
@@ -565,5 +554,63 @@ bool uvm_printer::istop() const
   return (m_scope.depth() == 0);
 }
 
+//----------------------------------------------------------------------
+// member function: m_add_row
+//
+//! Appends a row to the rows to be emitted, and returns it to be filled
+//! in place. Rows emitted before are reused, so that their strings keep
+//! their capacity; the caller assigns every field of the row.
+//----------------------------------------------------------------------
+
+uvm_printer_row_info& uvm_printer::m_add_row() const
+{
+  if (m_num_rows == m_rows.size())
+    m_rows.push_back(uvm_printer_row_info());
+  return m_rows[m_num_rows++];
+}
+
+//----------------------------------------------------------------------
+// member function: m_row_added
+//
+//! Called by the print_* member functions after they filled the row
+//! returned by m_add_row. Printers that write each row as it arrives,
+//! instead of in emit, override this member function.
+//----------------------------------------------------------------------
+
+void uvm_printer::m_row_added() const
+{
+}
+
+//----------------------------------------------------------------------
+// member function: m_int_str
+//
+//! Returns the decimal representation of \p value.
+//----------------------------------------------------------------------
+
+std::string uvm_printer::m_int_str( int value )
+{
+  char buf[16];
+  std::sprintf(buf, "%d", value);
+  return buf;
+}
+
+//----------------------------------------------------------------------
+// member function: m_pad
+//
+//! Writes \p n times the character \p c to \p os. As the fixed column
+//! templates of the printers, the padding is limited to 98 characters.
+//----------------------------------------------------------------------
+
+void uvm_printer::m_pad( std::ostream& os, char c, unsigned int n )
+{
+  static const unsigned int max_pad = 98;
+  static const std::string spaces(max_pad, ' ');
+  static const std::string dashes(max_pad, '-');
+
+  if (n > max_pad)
+    n = max_pad;
+  os.write((c == '-' ? dashes : spaces).data(), n);
+}
+
 
 } /* namespace uvm */
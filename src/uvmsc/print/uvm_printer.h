@@ -24,6 +24,7 @@
 #define UVM_PRINTER_H_
 
 #include <list>
+#include <ostream>
 
 #include <systemc>
 
@@ -118,6 +119,8 @@ class uvm_printer
 
   virtual std::string emit();
 
+  virtual void emit( std::ostream& os );
+
   virtual std::string format_row( const uvm_printer_row_info& row );
 
   virtual std::string format_header();
@@ -167,8 +170,21 @@ class uvm_printer
 
   typedef std::vector<uvm_printer_row_info> m_row_vecT;
   typedef m_row_vecT::iterator m_row_vecItT;
+  typedef m_row_vecT::const_iterator m_row_vecCItT;
   mutable m_row_vecT m_rows;
 
+  // number of rows to be emitted; the elements of m_rows after them are
+  // kept from earlier objects and reused by m_add_row
+  mutable std::size_t m_num_rows;
+
+  uvm_printer_row_info& m_add_row() const;
+
+  virtual void m_row_added() const;
+
+  static std::string m_int_str( int value );
+
+  static void m_pad( std::ostream& os, char c, unsigned int n );
+
   std::list<bool> m_array_stack;
 
 }; // class uvm_printer
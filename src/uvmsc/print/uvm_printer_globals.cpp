@@ -67,6 +67,15 @@ uvm_tree_printer* uvm_default_tree_printer = new uvm_tree_printer();
 
 uvm_line_printer* uvm_default_line_printer = new uvm_line_printer();
 
+//----------------------------------------------------------------------
+// Member variable: uvm_default_json_printer
+//
+//! The JSON printer is a global object that can be used with
+//! uvm_object::do_print to get machine-readable JSON output.
+//----------------------------------------------------------------------
+
+uvm_json_printer* uvm_default_json_printer = new uvm_json_printer();
+
 
 } /* namespace uvm */
 
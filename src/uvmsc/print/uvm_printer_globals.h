@@ -23,6 +23,7 @@
 #include "uvmsc/print/uvm_table_printer.h"
 #include "uvmsc/print/uvm_tree_printer.h"
 #include "uvmsc/print/uvm_line_printer.h"
+#include "uvmsc/print/uvm_json_printer.h"
 
 #ifndef UVM_PRINTER_GLOBALS_H_
 #define UVM_PRINTER_GLOBALS_H_
@@ -72,6 +73,15 @@ extern uvm_tree_printer* uvm_default_tree_printer;
 
 extern uvm_line_printer* uvm_default_line_printer;
 
+//----------------------------------------------------------------------
+// Member variable: uvm_default_json_printer
+//
+//! The JSON printer is a global object that can be used with
+//! uvm_object::do_print to get machine-readable JSON output.
+//----------------------------------------------------------------------
+
+extern uvm_json_printer* uvm_default_json_printer;
+
 
 
 } /* namespace uvm */
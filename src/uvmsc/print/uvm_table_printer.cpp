@@ -23,6 +23,7 @@
 //----------------------------------------------------------------------
 
 #include <systemc>
+#include <sstream>
 
 #include "uvmsc/print/uvm_table_printer.h"
 
@@ -57,11 +58,22 @@ uvm_table_printer::uvm_table_printer()
 
 std::string uvm_table_printer::emit()
 {
-  std::string s;
+  std::ostringstream s;
+  emit(s);
+  return s.str();
+}
+
+//------------------------------------------------------------------------------
+// member function: emit
+//
+//! Writes the collected information from prior calls to print_*
+//! in table format to \p os, in a single pass over the rows.
+//------------------------------------------------------------------------------
+
+void uvm_table_printer::emit( std::ostream& os )
+{
   std::string user_format;
-  std::string dash = "---------------------------------------------------------------------------------------------------";
-  std::string space= "                                                                                                   ";
-  std::string dashes;
+  bool dashes = false;
 
   std::string linefeed = '\n'+ knobs.prefix;
 
@@ -69,70 +81,80 @@ std::string uvm_table_printer::emit()
 
   if (knobs.header)
   {
-    std::string header;
     user_format = format_header();
     if (user_format.empty())
     {
-      std::string dash_id, dash_typ, dash_sz;
-      std::string head_id, head_typ, head_sz;
+      dashes = true;
+      m_emit_dashes(os, linefeed);
 
       if (knobs.identifier)
       {
-        dashes = dash.substr(1,m_max_name+2);
-        header = "Name" + space.substr(1,m_max_name-2);
+        os << "Name";
+        m_pad(os, ' ', m_max_name-2);
       }
       if (knobs.type_name)
       {
-        dashes = dashes + dash.substr(1,m_max_type+2);
-        header = header + "Type" + space.substr(1,m_max_type-2);
+        os << "Type";
+        m_pad(os, ' ', m_max_type-2);
       }
       if (knobs.size)
       {
-        dashes = dashes + dash.substr(1,m_max_size+2);
-        header = header + "Size" + space.substr(1,m_max_size-2);
+        os << "Size";
+        m_pad(os, ' ', m_max_size-2);
       }
-      dashes = dashes + dash.substr(1,m_max_value) + linefeed;
-      header = header + "Value" + space.substr(1,m_max_value-5) + linefeed;
+      os << "Value";
+      m_pad(os, ' ', m_max_value-5);
+      os << linefeed;
 
-      s = s + dashes + header + dashes;
+      m_emit_dashes(os, linefeed);
     }
     else
-      s = s + user_format + linefeed;
+      os << user_format << linefeed;
   } // header
 
-  for( m_row_vecItT it = m_rows.begin(); it < m_rows.end(); it++ )
+  for( std::size_t i = 0; i < m_num_rows; i++ )
   {
-    uvm_printer_row_info row = (*it);
+    const uvm_printer_row_info& row = m_rows[i];
     user_format = format_row(row);
 
     if (user_format.empty())
     {
-      std::string row_str;
       if (knobs.identifier)
-        row_str = space.substr(1,row.level * knobs.indent) + row.name +
-                  space.substr(1,m_max_name-row.name.length()-(row.level*knobs.indent)+2);
+      {
+        m_pad(os, ' ', row.level * knobs.indent);
+        os << row.name;
+        m_pad(os, ' ', m_max_name-row.name.length()-(row.level*knobs.indent)+2);
+      }
       if (knobs.type_name)
-        row_str = row_str + row.type_name + space.substr(1,m_max_type-row.type_name.length()+2);
+      {
+        os << row.type_name;
+        m_pad(os, ' ', m_max_type-row.type_name.length()+2);
+      }
       if (knobs.size)
-        row_str = row_str + row.size + space.substr(1,m_max_size-row.size.length()+2);
+      {
+        os << row.size;
+        m_pad(os, ' ', m_max_size-row.size.length()+2);
+      }
       // value
-      s = s + row_str + row.val + linefeed; // space.substr(1,m_max_value-row.val.length())
+      os << row.val << linefeed;
     }
     else
-      s = s + user_format + linefeed;
+      os << user_format << linefeed;
   } // rows
 
   if (knobs.footer)
   {
     user_format = format_footer();
     if (user_format.empty())
-      s = s + dashes;
+    {
+      if (dashes)
+        m_emit_dashes(os, linefeed);
+    }
     else
-      s = s + user_format + linefeed;
+      os << user_format << linefeed;
   } // footer
-  /* */
-  m_rows.clear(); // flush content
-  return s;
+
+  m_num_rows = 0; // flush content, keep the rows for reuse
 }
 
 //------------------------------------------------------------------------------
@@ -143,11 +165,11 @@ std::string uvm_table_printer::emit()
 
 void uvm_table_printer::calculate_max_widths()
 {
-  for( m_row_vecItT it = m_rows.begin(); it < m_rows.end(); it++ )
+  for( std::size_t i = 0; i < m_num_rows; i++ )
   {
     unsigned int name_len;
 
-    uvm_printer_row_info row = (*it);
+    const uvm_printer_row_info& row = m_rows[i];
 
     name_len = knobs.indent * row.level + row.name.length();
 
@@ -170,6 +192,24 @@ void uvm_table_printer::calculate_max_widths()
   if (m_max_value< 5) m_max_value= 5;
 }
 
+//------------------------------------------------------------------------------
+// member function: m_emit_dashes
+//
+//! Implementation defined
+//------------------------------------------------------------------------------
+
+void uvm_table_printer::m_emit_dashes( std::ostream& os, const std::string& linefeed )
+{
+  if (knobs.identifier)
+    m_pad(os, '-', m_max_name+2);
+  if (knobs.type_name)
+    m_pad(os, '-', m_max_type+2);
+  if (knobs.size)
+    m_pad(os, '-', m_max_size+2);
+  m_pad(os, '-', m_max_value);
+  os << linefeed;
+}
+
 //////////////
 
 } // namespace uvm
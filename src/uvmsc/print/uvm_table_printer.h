@@ -47,6 +47,8 @@ class uvm_table_printer : public uvm_printer
 
   virtual std::string emit();
 
+  virtual void emit( std::ostream& os );
+
   // Variables: m_max_*
   //
   // holds max size of each column, so table columns can be resized dynamically
@@ -59,6 +61,8 @@ class uvm_table_printer : public uvm_printer
 
   void calculate_max_widths();
 
+  void m_emit_dashes( std::ostream& os, const std::string& linefeed );
+
 };
 
 //////////////
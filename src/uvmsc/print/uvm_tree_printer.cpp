@@ -23,6 +23,7 @@
 //----------------------------------------------------------------------
 
 #include <systemc>
+#include <sstream>
 
 #include "uvmsc/print/uvm_tree_printer.h"
 
@@ -61,13 +62,25 @@ uvm_tree_printer::~uvm_tree_printer()
 // member function: emit
 //
 //! Formats the collected information from prior calls to print_*
-//! into table format.
+//! into tree format.
 //------------------------------------------------------------------------------
 
 std::string uvm_tree_printer::emit()
 {
-  std::string s = knobs.prefix;
-  std::string space= "                                                                                                   ";
+  std::ostringstream s;
+  emit(s);
+  return s.str();
+}
+
+//------------------------------------------------------------------------------
+// member function: emit
+//
+//! Writes the collected information from prior calls to print_*
+//! in tree format to \p os, in a single pass over the rows.
+//------------------------------------------------------------------------------
+
+void uvm_tree_printer::emit( std::ostream& os )
+{
   std::string user_format;
 
   std::string linefeed = (newline.empty() || newline == " ") ? newline : (newline + knobs.prefix);
@@ -75,6 +88,8 @@ std::string uvm_tree_printer::emit()
   std::string separator_start;
   std::string separator_end;
 
+  os << knobs.prefix;
+
   // make sure we access the separator characters only for a valid string length
   if (knobs.separator.size() > 1)
   {
@@ -87,78 +102,72 @@ std::string uvm_tree_printer::emit()
   {
     user_format = format_header();
     if (!user_format.empty())
-      s = s + user_format + linefeed;
+      os << user_format << linefeed;
   }
 
-  for( unsigned int i = 0; i < m_rows.size(); i++ )
+  for( unsigned int i = 0; i < m_num_rows; i++ )
   {
-    uvm_printer_row_info row = m_rows[i];
+    const uvm_printer_row_info& row = m_rows[i];
     user_format = format_row(row);
     if (user_format.empty())
     {
-      std::string indent_str;
-      indent_str = space.substr(1,row.level * knobs.indent);
-
       // Name (id)
       if (knobs.identifier)
       {
-        s = s + indent_str + row.name;
+        m_pad(os, ' ', row.level * knobs.indent);
+        os << row.name;
         if (!row.name.empty() && row.name != "...")
-          s = s + ": ";
+          os << ": ";
       }
 
       // Type Name
       if (row.val[0] == '@') // is an object w/ knobs.reference on
-        s = s + "(" + row.type_name + row.val + ") ";
+        os << "(" << row.type_name << row.val << ") ";
       else
         if (knobs.type_name &&
              (!row.type_name.empty() ||
               row.type_name != "-" ||
               row.type_name != "..."))
-          s = s + "(" + row.type_name + ") ";
+          os << "(" << row.type_name << ") ";
 
       // Size
       if (knobs.size)
       {
         if (!row.size.empty() || row.size != "-")
-            s = s + "(" + row.size + ") ";
+          os << "(" << row.size << ") ";
       }
 
-      if ( i < m_rows.size()-1 )
+      if ( i < m_num_rows-1 )
       {
         if (m_rows[i+1].level > row.level)
         {
-          s = s + separator_start + linefeed;
+          os << separator_start << linefeed;
           continue;
         }
       }
 
       // Value (unconditional)
-      s = s + row.val + " " + linefeed;
+      os << row.val << " " << linefeed;
 
       // Scope handling...
-      if (i <= m_rows.size()-1)
+      if (i <= m_num_rows-1)
       {
         int end_level;
-        if (i == m_rows.size()-1)
+        if (i == m_num_rows-1)
           end_level = 0;
         else
           end_level = m_rows[i+1].level;
 
-        if (end_level < row.level)
+        for (int l = row.level-1; l >= end_level; l--)
         {
-          std::string indent_str;
-          for (int l = row.level-1; l >= end_level; l--)
-          {
-            indent_str = space.substr(1,l * knobs.indent);
-            s = s + indent_str + separator_end + linefeed;
-          }
+          m_pad(os, ' ', l * knobs.indent);
+          os << separator_end << linefeed;
         }
       }
 
     }
     else
-      s = s + user_format;
+      os << user_format;
   }
 
   // Footer
@@ -166,17 +175,15 @@ std::string uvm_tree_printer::emit()
   {
     user_format = format_footer();
     if (!user_format.empty())
-      s = s + user_format + linefeed;
+      os << user_format << linefeed;
   }
 
   if (newline.empty() || newline == " ")
-    s = s + '\n';
+    os << '\n';
 
-  m_rows.clear();
-  return s;
+  m_num_rows = 0; // keep the rows for reuse
 }
 
-
 //////////////
 
 } // namespace uvm
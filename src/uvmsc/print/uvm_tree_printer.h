@@ -46,6 +46,7 @@ class uvm_tree_printer: public uvm_printer
   uvm_tree_printer();
   virtual ~uvm_tree_printer();
   virtual std::string emit();
+  virtual void emit( std::ostream& os );
   std::string newline;
 };
 
@@ -180,13 +180,12 @@ class uvm_reg_single_bit_bash_seq
     uvm_reg_data_t val, exp, v;
     bool bit_val;
 
-    std::ostringstream str;
-    str << "...Bashing "
+    UVM_INFO_STREAM("uvm_reg_bit_bash_seq",
+        "...Bashing "
         << mode
         << " bit #"
-        << k;
-
-    UVM_INFO("uvm_reg_bit_bash_seq", str.str(), UVM_HIGH);
+        << k,
+        UVM_HIGH);
 
     for (int i = 0; i < 2; i++) // repeat(2)
     {
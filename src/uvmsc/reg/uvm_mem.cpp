@@ -34,6 +34,7 @@
 #include "uvmsc/reg/uvm_vreg_field.h"
 #include "uvmsc/conf/uvm_object_string_pool.h"
 #include "uvmsc/dpi/uvm_hdl.h" // for backdoor access
+#include "uvmsc/macros/uvm_message_defines.h"
 
 namespace uvm {
 
@@ -910,15 +911,15 @@ void uvm_mem::poke( uvm_status_e& status, // output
 
   status = rw->status;
 
-  std::ostringstream inf;
-  inf << "Poked memory '"
+  UVM_INFO_STREAM("RegModel",
+      "Poked memory '"
       << get_full_name()
       << "[0x"
       << std::hex << offset.to_uint64()
       << "]' with value 0x"
       << std::hex << value.to_uint64()
-      << ".";
-  UVM_INFO("RegModel", inf.str(), UVM_HIGH);
+      << ".",
+      UVM_HIGH);
 }
 
 //----------------------------------------------------------------------
@@ -978,15 +979,15 @@ void uvm_mem::peek( uvm_status_e& status, // output
   status = rw->status;
   value  = rw->value[0];
 
-  std::ostringstream inf;
-  inf << "Peeked memory '"
+  UVM_INFO_STREAM("RegModel",
+      "Peeked memory '"
       << get_full_name()
       << "[Ox"
       << offset
       << "]' has value 0x"
       << std::hex << value.to_uint64()
-      << ".";
-  UVM_INFO("RegModel", inf.str(), UVM_HIGH);
+      << ".",
+      UVM_HIGH);
 }
 
 //----------------------------------------------------------------------
@@ -1402,11 +1403,11 @@ void uvm_mem::backdoor_write( uvm_reg_item* rw )
       // TODO implement slices
       for ( unsigned int j = 0; j < hdl_concat.slices.size(); j++)
       {
-        std::ostringstream str;
-        str << "backdoor_write to "
+        UVM_INFO_STREAM("RegModel",
+            "backdoor_write to "
             << hdl_concat.slices[j].path
-            << ".";
-        UVM_INFO("RegModel", str.str(), UVM_DEBUG);
+            << ".",
+            UVM_DEBUG);
 
         if (hdl_concat.slices[j].offset < 0)
         {
@@ -2084,7 +2085,8 @@ void uvm_mem::do_write( uvm_reg_item* rw )
     cb->post_write(rw);
 
   // REPORT
-  if (uvm_report_enabled(UVM_HIGH, UVM_INFO, "RegModel"))
+  if (UVM_VERBOSITY_ALLOWED_M(UVM_HIGH) &&
+      uvm_report_enabled(UVM_HIGH, UVM_INFO, "RegModel"))
   {
     std::ostringstream path_s, value_s, pre_s, range_s;
     if (rw->path == UVM_FRONTDOOR)
@@ -2109,7 +2111,7 @@ void uvm_mem::do_write( uvm_reg_item* rw )
       range_s << "[%" << rw->offset << "]";
     }
 
-    uvm_report_info("RegModel", pre_s.str() + "wrote memory via " +
+    UVM_INFO("RegModel", pre_s.str() + "wrote memory via " +
         path_s.str() + ": " + get_full_name() + range_s.str() + value_s.str(), UVM_HIGH);
   }
 
@@ -2197,7 +2199,8 @@ void uvm_mem::do_read( uvm_reg_item* rw )
     cb->post_read(rw);
 
   // REPORT
-  if (uvm_report_enabled(UVM_HIGH, UVM_INFO, "RegModel"))
+  if (UVM_VERBOSITY_ALLOWED_M(UVM_HIGH) &&
+      uvm_report_enabled(UVM_HIGH, UVM_INFO, "RegModel"))
   {
     std::ostringstream path_s, value_s, pre_s, range_s;
     if (rw->path == UVM_FRONTDOOR)
@@ -2223,7 +2226,7 @@ void uvm_mem::do_read( uvm_reg_item* rw )
       range_s << "[" << rw->offset << "]";
     }
 
-    uvm_report_info("RegModel", pre_s.str() + "read memory via " + path_s.str() + ": " +
+    UVM_INFO("RegModel", pre_s.str() + "read memory via " + path_s.str() + ": " +
         get_full_name() + range_s.str() + value_s.str(), UVM_HIGH);
   }
 
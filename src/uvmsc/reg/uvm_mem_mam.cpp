@@ -60,6 +60,7 @@ uvm_mem_mam::uvm_mem_mam( const std::string& name,
   m_for_each_idx = -1;
   m_lineno = 0;
   m_fname = "";
+  m_name = name;
 }
 
 //----------------------------------------------------------------------
@@ -283,13 +284,17 @@ uvm_mem_region* uvm_mem_mam::request_region( unsigned int n_bytes,
   alloc->max_offset = m_cfg->end_offset;
   alloc->in_use     = m_in_use;
 
-  /* TODO error for randomize
-  if (!alloc->randomize())
+  // the stream is seeded on first use, when the full name of the
+  // memory is known
+  if (!m_random_stream.is_seeded())
+    m_random_stream.reseed(m_memory != NULL ? m_memory->get_full_name() + "." + m_name : m_name);
+
+  if (!alloc->randomize(m_random_stream))
   {
     UVM_ERROR("RegModel", "Unable to randomize policy");
     return NULL;
   }
-  */
+
   return reserve_region(alloc->start_offset, n_bytes);
 }
 
@@ -26,6 +26,8 @@
 #include <string>
 #include <vector>
 
+#include "uvmsc/misc/uvm_random_stream.h"
+
 namespace uvm {
 
 // forward class declaration
@@ -148,6 +150,10 @@ class uvm_mem_mam
   std::string m_fname;
   int m_lineno;
 
+  // random stream used to randomize the allocation policy
+  std::string m_name;
+  uvm_random_stream m_random_stream;
+
 }; // class uvm_mem_mam
 
 } // namespace uvm
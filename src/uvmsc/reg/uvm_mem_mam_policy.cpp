@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "uvmsc/reg/uvm_mem_region.h"
+#include "uvmsc/reg/uvm_mem_mam_policy.h"
+
+namespace uvm {
+
+// sort regions on their start offset
+static bool m_region_before( const uvm_mem_region* a, const uvm_mem_region* b )
+{
+  return a->get_start_offset() < b->get_start_offset();
+}
+
+//----------------------------------------------------------------------
+// Class: uvm_mem_mam_policy - implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Member function: randomize
+//
+//! Randomize the start offset
+//!
+//! Procedural equivalent of the SystemVerilog constraints of this class:
+//! #start_offset is chosen uniformly, using the random stream \p rng, among
+//! all offsets for which a region of #len addresses lies between
+//! #min_offset and #max_offset without overlapping any region in #in_use.
+//! Returns false if no such offset exists, in which case #start_offset is
+//! left unchanged.
+//!
+//! Extensions can add their own procedural constraints by overriding
+//! this member function or the #pre_randomize and #post_randomize hooks.
+//----------------------------------------------------------------------
+
+bool uvm_mem_mam_policy::randomize( uvm_random_stream& rng )
+{
+  typedef std::pair<unsigned long, unsigned long> rangeT;
+  std::vector<rangeT> ranges;
+  unsigned long total = 0;
+
+  pre_randomize();
+
+  if (len == 0 || max_offset < min_offset || max_offset - min_offset < len - 1)
+    return false;
+
+  // valid start offsets are [low, high], minus those overlapping a region
+  unsigned long low = min_offset;
+  const unsigned long high = max_offset - (len - 1);
+
+  std::vector<uvm_mem_region*> regions(in_use);
+  std::sort(regions.begin(), regions.end(), m_region_before);
+
+  bool done = false;
+
+  for (unsigned int i = 0; i < regions.size() && !done; i++)
+  {
+    unsigned long r_start = regions[i]->get_start_offset();
+    unsigned long r_end = regions[i]->get_end_offset();
+
+    // start offsets ending before this region
+    if (r_start >= low + len)
+    {
+      unsigned long last = std::min(high, r_start - len);
+      ranges.push_back(rangeT(low, last));
+      total += last - low + 1;
+      if (last == high)
+      {
+        done = true;
+        break;
+      }
+    }
+
+    // skip the region itself
+    if (r_end >= high)
+      done = true;
+    else if (r_end >= low)
+      low = r_end + 1;
+  }
+
+  if (!done)
+  {
+    ranges.push_back(rangeT(low, high));
+    total += high - low + 1;
+  }
+
+  if (ranges.empty())
+    return false;
+
+  // pick an offset uniformly across all ranges; total wraps to 0 only
+  // when the whole address space is available
+  unsigned long pick = rng.urandom();
+  if (sizeof(unsigned long) > 4)
+    pick = (pick << 16 << 16) | rng.urandom();
+  if (total != 0)
+    pick %= total;
+
+  for (unsigned int i = 0; i < ranges.size(); i++)
+  {
+    unsigned long size = ranges[i].second - ranges[i].first + 1;
+    if (size == 0 || pick < size) // size 0: range covers the full space
+    {
+      start_offset = ranges[i].first + pick;
+      break;
+    }
+    pick -= size;
+  }
+
+  post_randomize();
+
+  return true;
+}
+
+} // namespace uvm
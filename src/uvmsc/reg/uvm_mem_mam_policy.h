@@ -23,8 +23,14 @@
 #ifndef UVM_MEM_MAM_POLICY_H_
 #define UVM_MEM_MAM_POLICY_H_
 
+#include <vector>
+
+#include "uvmsc/misc/uvm_random_stream.h"
+
 namespace uvm {
 
+class uvm_mem_region;
+
 
 
 //----------------------------------------------------------------------
@@ -85,6 +91,14 @@ class uvm_mem_mam_policy
     in_use.clear();
   }
 
+  virtual ~uvm_mem_mam_policy() {}
+
+  virtual bool randomize( uvm_random_stream& rng );
+
+  virtual void pre_randomize() {}
+
+  virtual void post_randomize() {}
+
 }; // uvm_mem_mam_policy
 
 } // namespace uvm
@@ -894,12 +894,12 @@ void uvm_reg::poke( uvm_status_e& status,
 
   status = rw->status;
 
-  std::ostringstream str;
-  str << "Poked register '"
+  UVM_INFO_STREAM("RegModel",
+      "Poked register '"
       << get_full_name()
       << "': 0x"
-      << std::hex << value.to_uint64();
-  UVM_INFO("RegModel", str.str(), UVM_HIGH);
+      << std::hex << value.to_uint64(),
+      UVM_HIGH);
 
   do_predict(rw, UVM_PREDICT_WRITE);
 
@@ -967,12 +967,12 @@ void uvm_reg::peek( uvm_status_e& status,
   status = rw->status;
   value = rw->value[0];
 
-  std::ostringstream str;
-  str << "Peeked register '"
+  UVM_INFO_STREAM("RegModel",
+      "Peeked register '"
       << get_full_name()
       << "': 0x"
-      << std::hex << value.to_uint64();
-  UVM_INFO("RegModel", str.str(), UVM_HIGH);
+      << std::hex << value.to_uint64(),
+      UVM_HIGH);
 
   do_predict(rw, UVM_PREDICT_READ);
 
@@ -1651,10 +1651,10 @@ uvm_status_e uvm_reg::backdoor_read_func( uvm_reg_item* rw )
 
     foreach (hdl_concat.slices[j])
     {
-      std::ostringstream str;
-      str << "backdoor_read from "
-          << hdl_concat.slices[j].path;
-      UVM_INFO("RegMem", str.str(), UVM_DEBUG);
+      UVM_INFO_STREAM("RegMem",
+          "backdoor_read from "
+          << hdl_concat.slices[j].path,
+          UVM_DEBUG);
 
       if (hdl_concat.slices[j].offset < 0)
       {
@@ -1696,10 +1696,10 @@ uvm_status_e uvm_reg::backdoor_read_func( uvm_reg_item* rw )
       UVM_ERROR("RegModel", str.str());
       return UVM_NOT_OK;
     }
-    std::ostringstream str;
-    str << "returned backdoor value 0x"
-        << std::hex << rw->value[0].to_uint64();
-    UVM_INFO("RegMem", str.str(), UVM_DEBUG);
+    UVM_INFO_STREAM("RegMem",
+        "returned backdoor value 0x"
+        << std::hex << rw->value[0].to_uint64(),
+        UVM_DEBUG);
   }
 
   rw->status = (ok) ? UVM_IS_OK : UVM_NOT_OK;
@@ -2734,7 +2734,8 @@ void uvm_reg::do_write( uvm_reg_item* rw )
   rw->element_kind = UVM_REG;
 
   // REPORT
-  if(uvm_report_enabled(UVM_HIGH, UVM_INFO, "RegModel"))
+  if(UVM_VERBOSITY_ALLOWED_M(UVM_HIGH) &&
+     uvm_report_enabled(UVM_HIGH, UVM_INFO, "RegModel"))
   {
     std::string path_s;
     std::ostringstream value_s;
@@ -2754,7 +2755,7 @@ void uvm_reg::do_write( uvm_reg_item* rw )
         << get_full_name()
         << value_s.str();
 
-    uvm_report_info("RegModel", str.str(), UVM_HIGH);
+    UVM_INFO("RegModel", str.str(), UVM_HIGH);
   }
 
   m_write_in_progress = false;
@@ -2981,7 +2982,8 @@ void uvm_reg::do_read( uvm_reg_item* rw )
   rw->element_kind = UVM_REG;
 
   // REPORT
-  if (uvm_report_enabled( UVM_HIGH, UVM_INFO, "RegModel" ) )
+  if (UVM_VERBOSITY_ALLOWED_M(UVM_HIGH) &&
+      uvm_report_enabled( UVM_HIGH, UVM_INFO, "RegModel" ) )
   {
     std::string path_s;
     std::ostringstream value_s;
@@ -3000,7 +3002,7 @@ void uvm_reg::do_read( uvm_reg_item* rw )
         << ": "
         << get_full_name()
         << value_s.str();
-    uvm_report_info("RegModel", str.str(), UVM_HIGH);
+    UVM_INFO("RegModel", str.str(), UVM_HIGH);
   }
 
   m_read_in_progress = false;
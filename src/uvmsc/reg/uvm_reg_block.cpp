@@ -1236,27 +1236,26 @@ void uvm_reg_block::update( uvm_status_e status,
 
   if (!needs_update())
   {
-    std::ostringstream str;
-    str << fname
+    UVM_INFO_STREAM("RegModel",
+        fname
         << ":"
         << lineno
         << "RegModel block "
         << get_name()
-        << "does not need updating";
-
-    UVM_INFO("RegModel", str.str(), UVM_HIGH);
+        << "does not need updating",
+        UVM_HIGH);
     return;
   }
 
-  std::ostringstream inf;
-  inf << fname
+  UVM_INFO_STREAM("RegModel",
+      fname
       << ":"
       << lineno
       << " - Updating model block "
       << get_name()
       << " with "
-      << uvm_path_name[path];
-  UVM_INFO("RegModel", inf.str(), UVM_HIGH);
+      << uvm_path_name[path],
+      UVM_HIGH);
 
   for( m_regs_itt it = m_regs.begin(); it != m_regs.end(); it++ )
   {
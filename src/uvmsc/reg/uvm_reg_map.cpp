@@ -1179,15 +1179,15 @@ void uvm_reg_map::do_bus_write( uvm_reg_item* rw,
       // eq: (value >> (curr_byte*8)) & (( 1 << (bus_width * 8))-1);
       data = (value >> (curr_byte*8)) & uvm_mask_size(bus_width * 8);
 
-      std::ostringstream str;
-      str << "Writing 0x"
+      UVM_INFO_STREAM(get_type_name(),
+          "Writing 0x"
           <<  data.to_string(sc_dt::SC_HEX_US, false)
           << " at address 0x"
           << std::hex << addrs[i].to_uint64()
           << " via map '"
           << rw->map->get_full_name()
-          << "'...";
-      UVM_INFO(get_type_name(), str.str(), UVM_FULL);
+          << "'...",
+          UVM_FULL);
 
       if (rw->element_kind == UVM_FIELD)
       {
@@ -1233,17 +1233,17 @@ void uvm_reg_map::do_bus_write( uvm_reg_item* rw,
 
       rw->status = rw_access.status;
 
-      std::ostringstream str1;
-      str1 << "Wrote 0x"
-           << data.to_string(sc_dt::SC_HEX_US, false)
-           << " at address 0x"
-           << std::hex << addrs[i].to_uint64()
-           << " via map '"
-           << rw->map->get_full_name()
-           << "': "
-           << uvm_status_name[rw->status]
-           << "...";
-      UVM_INFO(get_type_name(), str1.str(), UVM_FULL);
+      UVM_INFO_STREAM(get_type_name(),
+          "Wrote 0x"
+          << data.to_string(sc_dt::SC_HEX_US, false)
+          << " at address 0x"
+          << std::hex << addrs[i].to_uint64()
+          << " via map '"
+          << rw->map->get_full_name()
+          << "': "
+          << uvm_status_name[rw->status]
+          << "...",
+          UVM_FULL);
 
       if (rw->status == UVM_NOT_OK)
         break;
@@ -1336,13 +1336,13 @@ void uvm_reg_map::do_bus_read( uvm_reg_item* rw,
       uvm_reg_bus_op rw_access;
       uvm_reg_data_logic_t data;
 
-      std::ostringstream inf;
-      inf << "Reading address 0x"
+      UVM_INFO_STREAM(get_type_name(),
+          "Reading address 0x"
           << std::hex << addrs[i].to_uint64()
           << " via map '"
           << get_full_name()
-          << "'...";
-      UVM_INFO(get_type_name(), inf.str(), UVM_FULL);
+          << "'...",
+          UVM_FULL);
 
       if (rw->element_kind == UVM_FIELD)
         for( unsigned int z = 0; z < bus_width; z++)
@@ -1390,18 +1390,17 @@ void uvm_reg_map::do_bus_read( uvm_reg_item* rw,
           (data_str.find("X") < data_str.size()) ) // TODO check
         rw->status = UVM_HAS_X;
 
-      std::ostringstream str1;
-      str1 << "Read 0x"
-           << data.to_string(sc_dt::SC_HEX_US, false)
-           << " at address 0x"
-           << std::hex << addrs[i].to_uint64()
-           << " via map '"
-           << get_full_name()
-           << "': "
-           << uvm_status_name[rw->status]
-           << "...";
-
-      UVM_INFO(get_type_name(), str1.str(), UVM_FULL);
+      UVM_INFO_STREAM(get_type_name(),
+          "Read 0x"
+          << data.to_string(sc_dt::SC_HEX_US, false)
+          << " at address 0x"
+          << std::hex << addrs[i].to_uint64()
+          << " via map '"
+          << get_full_name()
+          << "': "
+          << uvm_status_name[rw->status]
+          << "...",
+          UVM_FULL);
 
       if (rw->status == UVM_NOT_OK)
         break;
@@ -265,23 +265,23 @@ void uvm_reg_predictor<BUSTYPE>::write( const BUSTYPE& tr )
 
           if(reg_item->access_kind == UVM_WRITE)
           {
-            std::ostringstream str;
-            str << "Observed WRITE transaction to register "
+            UVM_INFO_STREAM("REG_PREDICT",
+                "Observed WRITE transaction to register "
                 << ir->get_full_name()
                 << ": value = 0x"
                 << std::hex << reg_item->value[0].to_uint64()
                 << " : updated value = 0x"
-                << std::hex << ir->get().to_uint64();
-            UVM_INFO("REG_PREDICT", str.str(), UVM_HIGH);
+                << std::hex << ir->get().to_uint64(),
+                UVM_HIGH);
           }
           else
           {
-            std::ostringstream str;
-            str << "Observed READ transaction to register "
+            UVM_INFO_STREAM("REG_PREDICT",
+                "Observed READ transaction to register "
                 << ir->get_full_name()
                 << ": value= 0x"
-                << std::hex << reg_item->value[0].to_uint64();
-            UVM_INFO("REG_PREDICT", str.str(), UVM_HIGH);
+                << std::hex << reg_item->value[0].to_uint64(),
+                UVM_HIGH);
 
             reg_ap.write(*reg_item); // TODO check dereferencing
           }
@@ -298,10 +298,11 @@ void uvm_reg_predictor<BUSTYPE>::write( const BUSTYPE& tr )
   }
   else
   {
-    std::ostringstream str;
-    str << "Observed transaction does not target a register: "
-        << tr; // TODO check if all template arguments support operator<<
-    UVM_INFO("REG_PREDICT_NOT_FOR_ME", str.str(), UVM_FULL);
+    // TODO check if all template arguments support operator<<
+    UVM_INFO_STREAM("REG_PREDICT_NOT_FOR_ME",
+        "Observed transaction does not target a register: "
+        << tr,
+        UVM_FULL);
   }
 }
 
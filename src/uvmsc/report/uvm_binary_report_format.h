@@ -0,0 +1,70 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_BINARY_REPORT_FORMAT_H_
+#define UVM_BINARY_REPORT_FORMAT_H_
+
+// This header does not include SystemC, so that tools which only read
+// logs, such as uvm-report-decode, need not be linked against it.
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// File format of the binary report log
+//
+//! A log starts with the eight character magic "UVMBLOG1", followed by a
+//! 32-bit byte order mark (0x01020304) and a 32-bit format version. All
+//! integers are written in the byte order of the producing host.
+//!
+//! The remainder of the file is a sequence of records, each starting with
+//! a one byte tag:
+//!
+//! - UVM_BINARY_REPORT_STRING: 32-bit handle, 32-bit length and the
+//!   characters of a string. Every id, file name, report handler name and
+//!   context is emitted once, before the first message which refers to it.
+//!
+//! - UVM_BINARY_REPORT_MESSAGE: severity (8 bits), flags (8 bits, bit 0
+//!   set when the verbosity is shown, bit 1 when the terminator is shown),
+//!   time resolution as a power of ten femtoseconds (8 bits), verbosity
+//!   (32 bits), string handles of the id, file name, report handler name
+//!   and context (32 bits each), line number (32 bits), simulation time in
+//!   units of the time resolution (64 bits), message length (32 bits) and
+//!   the characters of the message body.
+//----------------------------------------------------------------------------
+
+enum uvm_binary_report_tag
+{
+  UVM_BINARY_REPORT_STRING  = 'S',
+  UVM_BINARY_REPORT_MESSAGE = 'M'
+};
+
+#define UVM_BINARY_REPORT_MAGIC "UVMBLOG1"
+#define UVM_BINARY_REPORT_BOM 0x01020304u
+#define UVM_BINARY_REPORT_VERSION 1u
+
+// unsigned 64-bit integer, the same type as sc_dt::uint64
+#if defined(_MSC_VER)
+typedef unsigned __int64 uvm_binary_report_uint64;
+#else
+typedef unsigned long long uvm_binary_report_uint64;
+#endif
+
+} // namespace uvm
+
+#endif // UVM_BINARY_REPORT_FORMAT_H_
@@ -0,0 +1,437 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "uvmsc/report/uvm_binary_report_reader.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+uvm_binary_report_reader::uvm_binary_report_reader()
+: m_data(NULL),
+  m_size(0),
+  m_pos(0),
+  m_header_size(0),
+  m_mapped(false)
+{}
+
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+uvm_binary_report_reader::~uvm_binary_report_reader()
+{
+  close();
+}
+
+//----------------------------------------------------------------------------
+// member function: open
+//
+//! Maps the log \p filename into memory and checks its header. Returns
+//! false, with a description in #get_error, if this fails.
+//----------------------------------------------------------------------------
+
+bool uvm_binary_report_reader::open( const std::string& filename )
+{
+  close();
+
+#if !defined(_WIN32)
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return m_fail("cannot open '" + filename + "'");
+
+  struct stat st;
+  if (::fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void* p = ::mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      m_data = static_cast<const char*>(p);
+      m_size = st.st_size;
+      m_mapped = true;
+    }
+  }
+  ::close(fd);
+#endif
+
+  if (!m_mapped)
+  {
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!in)
+      return m_fail("cannot open '" + filename + "'");
+
+    m_contents.assign(std::istreambuf_iterator<char>(in),
+                      std::istreambuf_iterator<char>());
+    m_data = m_contents.empty() ? NULL : &m_contents[0];
+    m_size = m_contents.size();
+  }
+
+  unsigned int bom = 0;
+  unsigned int version = 0;
+
+  if ( m_size < 8 || std::memcmp(m_data, UVM_BINARY_REPORT_MAGIC, 8) != 0 )
+    return m_fail("'" + filename + "' is not a binary report log");
+
+  m_pos = 8;
+  if (!m_get_u32(bom) || !m_get_u32(version))
+    return m_fail("'" + filename + "' is not a binary report log");
+
+  if (bom != UVM_BINARY_REPORT_BOM)
+    return m_fail("'" + filename + "' was written on a host with a different byte order");
+
+  if (version != UVM_BINARY_REPORT_VERSION)
+  {
+    std::ostringstream str;
+    str << "'" << filename << "' has unsupported format version " << version;
+    return m_fail(str.str());
+  }
+
+  m_header_size = m_pos;
+  m_error.clear();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// member function: close
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_reader::close()
+{
+#if !defined(_WIN32)
+  if (m_mapped)
+    ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+  m_mapped = false;
+  m_contents.clear();
+  m_data = NULL;
+  m_size = 0;
+  m_pos = 0;
+  m_header_size = 0;
+  m_strings.clear();
+}
+
+//----------------------------------------------------------------------------
+// member function: is_open
+//----------------------------------------------------------------------------
+
+bool uvm_binary_report_reader::is_open() const
+{
+  return m_header_size != 0;
+}
+
+//----------------------------------------------------------------------------
+// member function: next
+//
+//! Reads the next message into \p record. Returns false at the end of the
+//! log, or when the log is corrupt or truncated; in the latter case
+//! #get_error describes the problem.
+//----------------------------------------------------------------------------
+
+bool uvm_binary_report_reader::next( uvm_binary_report_record& record )
+{
+  if (!is_open())
+    return false;
+
+  while (m_pos < m_size)
+  {
+    std::size_t start = m_pos;
+    unsigned int tag = 0;
+    m_get_u8(tag);
+
+    if (tag == UVM_BINARY_REPORT_STRING)
+    {
+      unsigned int handle, length;
+      if (!m_get_u32(handle) || !m_get_u32(length) || m_size - m_pos < length)
+      {
+        m_pos = start;
+        break;
+      }
+
+      // the server allocates handles in sequence
+      if (handle != m_strings.size())
+      {
+        std::ostringstream str;
+        str << "corrupt string record at offset " << start;
+        return m_fail(str.str());
+      }
+
+      m_strings.push_back(std::string(m_data + m_pos, length));
+      m_pos += length;
+    }
+    else if (tag == UVM_BINARY_REPORT_MESSAGE)
+    {
+      unsigned int severity, flags, exponent, verbosity, line, length;
+      if ( !m_get_u8(severity) || !m_get_u8(flags) || !m_get_u8(exponent) ||
+           !m_get_u32(verbosity) || !m_get_u32(record.id) ||
+           !m_get_u32(record.filename) || !m_get_u32(record.name) ||
+           !m_get_u32(record.context) || !m_get_u32(line) ||
+           !m_get_u64(record.time) || !m_get_u32(length) ||
+           m_size - m_pos < length )
+      {
+        m_pos = start;
+        break;
+      }
+
+      if ( severity_name(severity) == NULL ||
+           record.id >= m_strings.size() || record.filename >= m_strings.size() ||
+           record.name >= m_strings.size() || record.context >= m_strings.size() )
+      {
+        std::ostringstream str;
+        str << "corrupt message record at offset " << start;
+        return m_fail(str.str());
+      }
+
+      record.severity = static_cast<int>(severity);
+      record.show_verbosity = (flags & 1) != 0;
+      record.show_terminator = (flags & 2) != 0;
+      record.time_exponent = exponent;
+      record.verbosity = static_cast<int>(verbosity);
+      record.line = static_cast<int>(line);
+      record.message = m_data + m_pos;
+      record.message_length = length;
+      m_pos += length;
+      return true;
+    }
+    else
+    {
+      std::ostringstream str;
+      str << "unknown record type at offset " << start;
+      return m_fail(str.str());
+    }
+  }
+
+  if (m_pos < m_size)
+  {
+    std::ostringstream str;
+    str << "log is truncated after offset " << m_pos;
+    m_pos = m_size;
+    m_error = str.str();
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// member function: rewind
+//
+//! Restarts reading at the first record.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_reader::rewind()
+{
+  m_pos = m_header_size;
+  m_error.clear();
+}
+
+//----------------------------------------------------------------------------
+// member function: get_error
+//----------------------------------------------------------------------------
+
+const std::string& uvm_binary_report_reader::get_error() const
+{
+  return m_error;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_string
+//
+//! Returns the string with handle \p handle, as used in the records, or
+//! an empty string if no such handle has been read yet.
+//----------------------------------------------------------------------------
+
+const std::string& uvm_binary_report_reader::get_string( unsigned int handle ) const
+{
+  static const std::string empty;
+
+  if (handle >= m_strings.size())
+    return empty;
+
+  return m_strings[handle];
+}
+
+//----------------------------------------------------------------------------
+// member function: compose
+//
+//! Returns the text of \p record in the format of
+//! uvm_default_report_server::compose_report_message.
+//----------------------------------------------------------------------------
+
+std::string uvm_binary_report_reader::compose( const uvm_binary_report_record& record ) const
+{
+  std::string sev_string = severity_name(record.severity);
+  const std::string& filename = m_strings[record.filename];
+  const std::string& context = m_strings[record.context];
+
+  std::ostringstream str;
+
+  str << sev_string;
+
+  if (record.show_verbosity)
+    str << "(" << record.verbosity << ")";
+
+  str << " ";
+
+  if (!filename.empty())
+    str << filename << "(" << record.line << ") ";
+
+  str << "@ " << time_string(record) << ": " << m_strings[record.name];
+
+  if (!context.empty())
+    str << "@@" << context;
+
+  str << " [" << m_strings[record.id] << "] ";
+  str.write(record.message, record.message_length);
+
+  if (record.show_terminator)
+    str << " -" << sev_string;
+
+  return str.str();
+}
+
+//----------------------------------------------------------------------------
+// member function: time_string (static)
+//
+//! Returns the simulation time of \p record as sc_core::sc_time prints it.
+//----------------------------------------------------------------------------
+
+std::string uvm_binary_report_reader::time_string( const uvm_binary_report_record& record )
+{
+  static const char* time_units[] = { "fs", "ps", "ns", "us", "ms", "s" };
+
+  uvm_binary_report_uint64 val = record.time;
+  if (val == 0)
+    return "0 s";
+
+  int n = record.time_exponent;
+  while ((val % 10) == 0)
+  {
+    val /= 10;
+    n++;
+  }
+
+  std::ostringstream str;
+  str << val;
+
+  if (n >= 15)
+  {
+    str << std::string(n - 15, '0') << " s";
+  }
+  else
+  {
+    str << std::string(n % 3, '0') << " " << time_units[n / 3];
+  }
+  return str.str();
+}
+
+//----------------------------------------------------------------------------
+// member function: time_seconds (static)
+//
+//! Returns the simulation time of \p record in seconds.
+//----------------------------------------------------------------------------
+
+double uvm_binary_report_reader::time_seconds( const uvm_binary_report_record& record )
+{
+  double t = static_cast<double>(record.time);
+  for (int i = 0; i < record.time_exponent; i++)
+    t *= 10.0;
+  return t * 1e-15;
+}
+
+//----------------------------------------------------------------------------
+// member function: severity_name (static)
+//
+//! Returns the name of \p severity, such as "UVM_ERROR", or NULL if it is
+//! not a severity. The names are those of uvm_severity_name, repeated here
+//! so that the reader does not depend on the rest of the library.
+//----------------------------------------------------------------------------
+
+const char* uvm_binary_report_reader::severity_name( int severity )
+{
+  static const char* names[] = {
+    "UVM_INFO",
+    "UVM_WARNING",
+    "UVM_ERROR",
+    "UVM_FATAL"
+  };
+
+  if (severity < 0 || severity >= static_cast<int>(sizeof(names) / sizeof(names[0])))
+    return NULL;
+  return names[severity];
+}
+
+//----------------------------------------------------------------------------
+// member function: m_fail
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+bool uvm_binary_report_reader::m_fail( const std::string& error )
+{
+  close();
+  m_error = error;
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// member functions: m_get_u8, m_get_u32, m_get_u64
+//
+//! Implementation-defined member functions
+//! Read a field in host byte order. Return false at the end of the data.
+//----------------------------------------------------------------------------
+
+bool uvm_binary_report_reader::m_get_u8( unsigned int& value )
+{
+  if (m_size - m_pos < 1)
+    return false;
+  value = static_cast<unsigned char>(m_data[m_pos++]);
+  return true;
+}
+
+bool uvm_binary_report_reader::m_get_u32( unsigned int& value )
+{
+  if (m_size - m_pos < 4)
+    return false;
+  std::memcpy(&value, m_data + m_pos, 4);
+  m_pos += 4;
+  return true;
+}
+
+bool uvm_binary_report_reader::m_get_u64( uvm_binary_report_uint64& value )
+{
+  if (m_size - m_pos < 8)
+    return false;
+  std::memcpy(&value, m_data + m_pos, 8);
+  m_pos += 8;
+  return true;
+}
+
+} // namespace uvm
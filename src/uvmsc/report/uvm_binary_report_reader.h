@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_BINARY_REPORT_READER_H_
+#define UVM_BINARY_REPORT_READER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "uvmsc/report/uvm_binary_report_format.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_binary_report_record
+//
+//! Implementation-defined class holding the fields of one message read by
+//! the #uvm_binary_report_reader. Strings are given as handles, which the
+//! reader resolves with uvm_binary_report_reader::get_string. The message
+//! body points into the mapped log file. The severity is the value of the
+//! #uvm_severity of the message.
+//----------------------------------------------------------------------------
+
+struct uvm_binary_report_record
+{
+  int severity;
+  bool show_verbosity;
+  bool show_terminator;
+  int time_exponent;
+  int verbosity;
+  unsigned int id;
+  unsigned int filename;
+  unsigned int name;
+  unsigned int context;
+  int line;
+  uvm_binary_report_uint64 time;
+  const char* message;
+  std::size_t message_length;
+};
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_binary_report_reader
+//
+//! Implementation-defined class which reads a log written by the
+//! #uvm_binary_report_server. The file is mapped into memory and decoded
+//! one record at a time, so logs larger than the available memory can be
+//! processed. The text of a message, as the #uvm_default_report_server
+//! would have displayed it, is rebuilt by #compose.
+//!
+//! The reader does not depend on SystemC or on the rest of the library, so
+//! that it can be linked into a stand-alone tool such as uvm-report-decode.
+//----------------------------------------------------------------------------
+
+class uvm_binary_report_reader
+{
+ public:
+  uvm_binary_report_reader();
+
+  ~uvm_binary_report_reader();
+
+  bool open( const std::string& filename );
+
+  void close();
+
+  bool is_open() const;
+
+  bool next( uvm_binary_report_record& record );
+
+  void rewind();
+
+  const std::string& get_error() const;
+
+  const std::string& get_string( unsigned int handle ) const;
+
+  std::string compose( const uvm_binary_report_record& record ) const;
+
+  static std::string time_string( const uvm_binary_report_record& record );
+
+  static double time_seconds( const uvm_binary_report_record& record );
+
+  static const char* severity_name( int severity );
+
+ private:
+  // disabled
+  uvm_binary_report_reader( const uvm_binary_report_reader& );
+  uvm_binary_report_reader& operator=( const uvm_binary_report_reader& );
+
+  bool m_fail( const std::string& error );
+
+  bool m_get_u8( unsigned int& value );
+  bool m_get_u32( unsigned int& value );
+  bool m_get_u64( uvm_binary_report_uint64& value );
+
+  const char* m_data;
+  std::size_t m_size;
+  std::size_t m_pos;
+  std::size_t m_header_size;
+
+  // file contents, when the file cannot be mapped
+  std::vector<char> m_contents;
+  bool m_mapped;
+
+  std::vector<std::string> m_strings;
+  std::string m_error;
+
+}; // class uvm_binary_report_reader
+
+} // namespace uvm
+
+#endif // UVM_BINARY_REPORT_READER_H_
@@ -0,0 +1,345 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <systemc>
+
+#include <cstring>
+
+#include "uvmsc/report/uvm_binary_report_server.h"
+#include "uvmsc/report/uvm_report_message.h"
+#include "uvmsc/report/uvm_report_catcher.h"
+#include "uvmsc/report/uvm_report_handler.h"
+#include "uvmsc/report/uvm_report_profiler.h"
+#include "uvmsc/print/uvm_printer.h"
+#include "uvmsc/print/uvm_printer_globals.h"
+#include "uvmsc/base/uvm_coreservice_t.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Constructor
+//
+//! Creates the server and opens the log file \p filename. When the file
+//! cannot be opened, #is_open returns false and messages are discarded.
+//----------------------------------------------------------------------------
+
+uvm_binary_report_server::uvm_binary_report_server( const std::string& filename,
+                                                    const std::string& name )
+: uvm_default_report_server(name),
+  m_filename(filename),
+  m_file(NULL),
+  m_file_buffer(1 << 20),
+  m_echo_severity(UVM_ERROR),
+  m_time_exponent(-1)
+{
+  m_file = std::fopen(filename.c_str(), "wb");
+
+  if (m_file == NULL)
+    return;
+
+  std::setvbuf(m_file, &m_file_buffer[0], _IOFBF, m_file_buffer.size());
+
+  std::fwrite(UVM_BINARY_REPORT_MAGIC, 1, 8, m_file);
+  m_put_u32(UVM_BINARY_REPORT_BOM);
+  m_put_u32(UVM_BINARY_REPORT_VERSION);
+  std::fwrite(&m_record[0], 1, m_record.size(), m_file);
+  m_record.clear();
+}
+
+//----------------------------------------------------------------------------
+// member function: process_report_message (virtual)
+//
+//! Same as uvm_default_report_server::process_report_message, except that
+//! a message is only composed as text when it is echoed to the console.
+//! Display limits apply to the log as well.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::process_report_message( uvm_report_message* report_message )
+{
+  report_message->set_report_server(this);
+
+  uvm_report_profile_entry* profile = m_profile_entry(report_message);
+
+  bool report_ok = uvm_report_catcher::process_all_report_catchers(report_message);
+
+  if (profile != NULL && !report_ok)
+    profile->caught++;
+
+  if (report_message->get_action() == UVM_NO_ACTION)
+    report_ok = false;
+
+  if (report_ok)
+  {
+    std::string m;
+    uvm_coreservice_t* cs = uvm_coreservice_t::get();
+    uvm_report_server* svr = cs->get_report_server();
+
+    m_apply_report_limits(report_message);
+
+    double start = (profile != NULL) ? uvm_report_profiler::m_now() : 0.0;
+
+    if ( (report_message->get_action() & UVM_DISPLAY) &&
+         (report_message->get_severity() >= m_echo_severity) )
+      m = svr->compose_report_message(report_message);
+
+    if (profile != NULL)
+      start = m_profile_compose(profile, report_message, start);
+
+    svr->execute_report_message(report_message, m);
+
+    if (profile != NULL)
+      profile->write_time += uvm_report_profiler::m_now() - start;
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: execute_report_message (virtual)
+//
+//! Writes a record for messages with the UVM_DISPLAY or UVM_LOG action,
+//! and lets uvm_default_report_server::execute_report_message process the
+//! remaining actions. The composed message, if any, is displayed as well.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::execute_report_message(
+    uvm_report_message* report_message,
+    const std::string& composed_message )
+{
+  uvm_action action = report_message->get_action();
+  uvm_action output = action & (UVM_DISPLAY | UVM_LOG);
+
+  if (output != 0)
+  {
+    m_write_message(report_message);
+
+    // only an echoed message is still displayed as text
+    uvm_action suppress = composed_message.empty() ? output : (output & UVM_LOG);
+    report_message->set_action(action & ~suppress);
+  }
+
+  if ( (report_message->get_severity() >= UVM_ERROR) ||
+       (action & (UVM_COUNT | UVM_EXIT | UVM_STOP)) )
+    flush();
+
+  uvm_default_report_server::execute_report_message(report_message, composed_message);
+
+  report_message->set_action(report_message->get_action() | output);
+}
+
+//----------------------------------------------------------------------------
+// member function: report_summarize (virtual)
+//
+//! Logs the summary and writes all pending records to the file.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::report_summarize( UVM_FILE file ) const
+{
+  uvm_default_report_server::report_summarize(file);
+  flush();
+}
+
+//----------------------------------------------------------------------------
+// member function: get_type_name
+//----------------------------------------------------------------------------
+
+const std::string uvm_binary_report_server::get_type_name() const
+{
+  return "uvm_binary_report_server";
+}
+
+//----------------------------------------------------------------------------
+// member function: is_open
+//
+//! Returns true if the log file was opened successfully.
+//----------------------------------------------------------------------------
+
+bool uvm_binary_report_server::is_open() const
+{
+  return m_file != NULL;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_filename
+//----------------------------------------------------------------------------
+
+const std::string& uvm_binary_report_server::get_filename() const
+{
+  return m_filename;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_echo_severity
+//
+//! Messages with a severity of at least \p severity are also displayed
+//! as text. Use a value above UVM_FATAL to log all messages silently.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::set_echo_severity( uvm_severity severity )
+{
+  m_echo_severity = severity;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_echo_severity
+//----------------------------------------------------------------------------
+
+uvm_severity uvm_binary_report_server::get_echo_severity() const
+{
+  return m_echo_severity;
+}
+
+//----------------------------------------------------------------------------
+// member function: flush
+//
+//! Writes all buffered records to the log file.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::flush() const
+{
+  if (m_file != NULL)
+    std::fflush(m_file);
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+uvm_binary_report_server::~uvm_binary_report_server()
+{
+  if (m_file != NULL)
+    std::fclose(m_file);
+}
+
+//----------------------------------------------------------------------------
+// member function: m_intern
+//
+//! Implementation-defined member function
+//! Returns the handle of \p str. A string which has not been seen before
+//! is assigned a new handle, which is written to the record first.
+//----------------------------------------------------------------------------
+
+unsigned int uvm_binary_report_server::m_intern( const std::string& str )
+{
+  string_handle_mapT::iterator it = m_string_handles.lower_bound(str);
+
+  if (it != m_string_handles.end() && it->first == str)
+    return it->second;
+
+  unsigned int handle = m_string_handles.size();
+  m_string_handles.insert(it, string_handle_mapT::value_type(str, handle));
+
+  m_put_u8(UVM_BINARY_REPORT_STRING);
+  m_put_u32(handle);
+  m_put_str(str);
+
+  return handle;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_write_message
+//
+//! Implementation-defined member function
+//! Writes the string and message records of \p report_message. The message
+//! body holds the same text as uvm_default_report_server::compose_report_message
+//! uses, including the element container.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::m_write_message( uvm_report_message* report_message )
+{
+  if (m_file == NULL)
+    return;
+
+  if (m_time_exponent < 0)
+  {
+    // the resolution is fixed once the first time object exists
+    double res_fs = sc_core::sc_get_time_resolution().to_seconds() * 1e15;
+    m_time_exponent = 0;
+    while (res_fs > 5.0)
+    {
+      res_fs /= 10.0;
+      m_time_exponent++;
+    }
+  }
+
+  unsigned int id = m_intern(report_message->get_id());
+  unsigned int fname = m_intern(report_message->get_filename());
+  unsigned int rep_name = m_intern(report_message->get_report_handler()->get_full_name());
+  unsigned int context = m_intern(report_message->get_context());
+
+  uvm_report_message_element_container* el_container =
+    report_message->get_element_container();
+
+  std::string msg_body_str;
+  if (el_container->size() == 0)
+    msg_body_str = report_message->get_message();
+  else
+  {
+    std::string prefix = uvm_default_printer->knobs.prefix;
+    uvm_default_printer->knobs.prefix = " +";
+    msg_body_str = report_message->get_message() + "\n" + el_container->sprint();
+    uvm_default_printer->knobs.prefix = prefix;
+  }
+
+  m_put_u8(UVM_BINARY_REPORT_MESSAGE);
+  m_put_u8(report_message->get_severity());
+  m_put_u8((show_verbosity ? 1 : 0) | (show_terminator ? 2 : 0));
+  m_put_u8(m_time_exponent);
+  m_put_u32(report_message->get_verbosity());
+  m_put_u32(id);
+  m_put_u32(fname);
+  m_put_u32(rep_name);
+  m_put_u32(context);
+  m_put_u32(report_message->get_line());
+  m_put_u64(sc_core::sc_time_stamp().value());
+  m_put_str(msg_body_str);
+
+  std::fwrite(&m_record[0], 1, m_record.size(), m_file);
+  m_record.clear();
+}
+
+//----------------------------------------------------------------------------
+// member functions: m_put_u8, m_put_u32, m_put_u64, m_put_str
+//
+//! Implementation-defined member functions
+//! Append a field, in host byte order, to the record under construction.
+//----------------------------------------------------------------------------
+
+void uvm_binary_report_server::m_put_u8( unsigned int value )
+{
+  m_record.push_back(static_cast<char>(value & 0xff));
+}
+
+void uvm_binary_report_server::m_put_u32( unsigned int value )
+{
+  const char* p = reinterpret_cast<const char*>(&value);
+  m_record.insert(m_record.end(), p, p + 4);
+}
+
+void uvm_binary_report_server::m_put_u64( sc_dt::uint64 value )
+{
+  const char* p = reinterpret_cast<const char*>(&value);
+  m_record.insert(m_record.end(), p, p + 8);
+}
+
+void uvm_binary_report_server::m_put_str( const std::string& str )
+{
+  m_put_u32(str.size());
+  m_record.insert(m_record.end(), str.begin(), str.end());
+}
+
+} // namespace uvm
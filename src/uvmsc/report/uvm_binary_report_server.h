@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_BINARY_REPORT_SERVER_H_
+#define UVM_BINARY_REPORT_SERVER_H_
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "uvmsc/base/uvm_object_globals.h"
+#include "uvmsc/report/uvm_binary_report_format.h"
+#include "uvmsc/report/uvm_default_report_server.h"
+
+namespace uvm {
+
+// forward class declarations
+class uvm_report_message;
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_binary_report_server
+//
+//! Implementation-defined report server which does not format messages,
+//! but writes their fields as compact binary records to a log file. The
+//! text of each message can be reconstructed offline, byte for byte, with
+//! the #uvm_binary_report_reader.
+//!
+//! Messages with the UVM_DISPLAY or UVM_LOG action are written to the log
+//! once. All other actions, and the severity and id counts, are processed
+//! by the #uvm_default_report_server. Messages with a severity of at least
+//! the echo severity (UVM_ERROR by default) are also displayed as text.
+//!
+//! The server is installed by the core service when the environment
+//! variable UVM_SYSTEMC_REPORT_BINARY names the log file.
+//----------------------------------------------------------------------------
+
+class uvm_binary_report_server : public uvm_default_report_server
+{
+ public:
+  explicit uvm_binary_report_server( const std::string& filename,
+                                     const std::string& name = "uvm_report_server" );
+
+  virtual ~uvm_binary_report_server();
+
+  virtual void process_report_message( uvm_report_message* report_message );
+
+  virtual void execute_report_message( uvm_report_message* report_message,
+                                       const std::string& composed_message );
+
+  virtual void report_summarize( UVM_FILE file = 0 ) const;
+
+  const std::string get_type_name() const;
+
+  bool is_open() const;
+
+  const std::string& get_filename() const;
+
+  void set_echo_severity( uvm_severity severity );
+
+  uvm_severity get_echo_severity() const;
+
+  void flush() const;
+
+ private:
+  unsigned int m_intern( const std::string& str );
+
+  void m_write_message( uvm_report_message* report_message );
+
+  void m_put_u8( unsigned int value );
+  void m_put_u32( unsigned int value );
+  void m_put_u64( sc_dt::uint64 value );
+  void m_put_str( const std::string& str );
+
+  std::string m_filename;
+  std::FILE* m_file;
+  std::vector<char> m_file_buffer;
+
+  // record under construction
+  std::vector<char> m_record;
+
+  typedef std::map<std::string, unsigned int> string_handle_mapT;
+  string_handle_mapT m_string_handles;
+
+  uvm_severity m_echo_severity;
+  int m_time_exponent;
+
+}; // class uvm_binary_report_server
+
+} // namespace uvm
+
+#endif // UVM_BINARY_REPORT_SERVER_H_
@@ -28,6 +28,8 @@
 #include <ostream>
 #include <iostream>
 #include <iomanip>  // setw
+#include <cstdlib>  // getenv, atoi
+#include <cstring>  // strchr, strlen
 
 #include "uvmsc/report/uvm_default_report_server.h"
 #include "uvmsc/macros/uvm_string_defines.h"
@@ -36,6 +38,9 @@
 #include "uvmsc/report/uvm_report_message.h"
 #include "uvmsc/report/uvm_report_catcher.h"
 #include "uvmsc/report/uvm_report_handler.h"
+#include "uvmsc/report/uvm_report_profiler.h"
+#include "uvmsc/base/uvm_tr_database.h"
+#include "uvmsc/report/uvm_report_sink.h"
 #include "uvmsc/print/uvm_printer.h"
 #include "uvmsc/base/uvm_globals.h"
 #include "uvmsc/base/uvm_coreservice_t.h"
@@ -48,13 +53,52 @@ namespace uvm {
 // Constructor
 //
 //! Creates an instance of the class.
+//!
+//! When the environment variable UVM_SYSTEMC_REPORT_BUFFERED is set, the
+//! server writes its output through a #uvm_buffered_report_sink. A positive
+//! numeric value sets the flush interval of the sink in milliseconds.
+//!
+//! The environment variable UVM_SYSTEMC_REPORT_LIMIT, with the value
+//! "first" or "first,every", sets the display limit for all ids (see
+//! #set_id_limit). When UVM_SYSTEMC_REPORT_COLLAPSE is set, identical
+//! consecutive messages are collapsed (see #set_collapse_duplicates).
+//!
+//! When UVM_SYSTEMC_REPORT_PROFILE is set, the #uvm_report_profiler is
+//! enabled. A value other than "1" is the name of the CSV file to which
+//! the profile is written by #report_summarize.
 //----------------------------------------------------------------------------
 
 uvm_default_report_server::uvm_default_report_server( const std::string& name )
-: uvm_report_server(name)
+: uvm_report_server(name),
+  m_sink(NULL),
+  m_own_sink(NULL),
+  m_default_limit(NULL),
+  m_collapse_duplicates(false),
+  m_repeat_count(0),
+  m_last_severity(UVM_INFO),
+  m_last_line(0),
+  m_last_handler(NULL),
+  m_compose_buffer(),
+  m_time_stamp(),
+  m_time_str(),
+  m_time_valid(false)
 {
   max_quit_overridable = true;
 
+  const char* buffered = std::getenv("UVM_SYSTEMC_REPORT_BUFFERED");
+  if (buffered != NULL)
+  {
+    int interval = std::atoi(buffered);
+    if (interval > 0)
+      m_own_sink = new uvm_buffered_report_sink(1 << 20, interval);
+    else
+      m_own_sink = new uvm_buffered_report_sink();
+  }
+  else
+    m_own_sink = new uvm_report_sink();
+
+  m_sink = m_own_sink;
+
   enable_report_id_count_summary = true;
   record_all_messages = false;
   show_verbosity = false;
@@ -63,6 +107,26 @@ uvm_default_report_server::uvm_default_report_server( const std::string& name )
   set_max_quit_count(0);
   reset_quit_count();
   reset_severity_counts();
+
+  const char* limit = std::getenv("UVM_SYSTEMC_REPORT_LIMIT");
+  if (limit != NULL)
+  {
+    int first = std::atoi(limit);
+    const char* every = std::strchr(limit, ',');
+    set_id_limit("*", first, (every != NULL) ? std::atoi(every + 1) : 0);
+  }
+
+  if (std::getenv("UVM_SYSTEMC_REPORT_COLLAPSE") != NULL)
+    set_collapse_duplicates(true);
+
+  const char* profile = std::getenv("UVM_SYSTEMC_REPORT_PROFILE");
+  if (profile != NULL)
+  {
+    uvm_report_profiler* profiler = uvm_report_profiler::get();
+    profiler->enable();
+    if (*profile != '\0' && std::string(profile) != "1")
+      profiler->set_csv_file(profile);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -353,10 +417,220 @@ void uvm_default_report_server::get_id_set( std::vector<std::string>& q ) const
 
 void uvm_default_report_server::f_display( UVM_FILE file, const std::string& str ) const
 {
-  if (file == 0) // NULL pointer
-    std::cout << str << std::endl;
-  else
-    *file << str << std::endl;
+  m_sink->write(file, str);
+}
+
+//----------------------------------------------------------------------------
+// member function: set_report_sink
+//
+//! Sets the sink which writes the composed messages. The sink is not
+//! deleted by the server. Passing NULL restores the sink the server was
+//! created with. Output pending in the previous sink is written first.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::set_report_sink( uvm_report_sink* sink )
+{
+  m_sink->flush();
+  m_sink = (sink == NULL) ? m_own_sink : sink;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_report_sink
+//
+//! Returns the sink which writes the composed messages
+//----------------------------------------------------------------------------
+
+uvm_report_sink* uvm_default_report_server::get_report_sink() const
+{
+  return m_sink;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_id_limit
+//
+//! Limits the display of messages with id \p id: the first \p first
+//! messages are shown, after that only every \p every-th message (none if
+//! \p every is 0). Suppressed messages are not composed or written, but
+//! still counted and processed for their other actions. The id "*" sets
+//! the limit for all ids without a limit of their own. A negative \p first
+//! removes the limit. Fatal messages are never suppressed.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::set_id_limit( const std::string& id,
+                                              int first, int every )
+{
+  if (first < 0)
+  {
+    m_id_limits.erase(id);
+    if (id == "*")
+      m_default_limit = NULL;
+    return;
+  }
+
+  m_report_limit& limit = m_id_limits[id];
+  limit.first = first;
+  limit.every = every;
+  limit.seen = 0;
+
+  if (id == "*")
+    m_default_limit = &limit;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_location_limit
+//
+//! Same as #set_id_limit, for the messages issued from line \p line of
+//! file \p filename.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::set_location_limit( const std::string& filename,
+                                                    int line,
+                                                    int first, int every )
+{
+  location_t location(filename, line);
+
+  if (first < 0)
+  {
+    m_location_limits.erase(location);
+    return;
+  }
+
+  m_report_limit& limit = m_location_limits[location];
+  limit.first = first;
+  limit.every = every;
+  limit.seen = 0;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_collapse_duplicates
+//
+//! When enabled, a message identical to the previous one (same severity,
+//! id, text, location and report handler) is not shown. The number of
+//! repetitions is shown when a different message arrives.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::set_collapse_duplicates( bool collapse )
+{
+  if (!collapse)
+    m_flush_repeats();
+  m_collapse_duplicates = collapse;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_suppressed_count
+//
+//! Returns the number of messages with id \p id which were not shown due
+//! to a display limit or duplicate collapsing.
+//----------------------------------------------------------------------------
+
+int uvm_default_report_server::get_suppressed_count( const std::string& id ) const
+{
+  id_count_citt it = m_suppressed_count.find(id);
+  return (it == m_suppressed_count.end()) ? 0 : it->second;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_apply_report_limits
+//
+//! Implementation-defined member function
+//! Removes the UVM_DISPLAY and UVM_LOG actions from \p report_message if
+//! a display limit or duplicate collapsing suppresses it. Called before the
+//! message is composed.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::m_apply_report_limits( uvm_report_message* report_message )
+{
+  if ( m_id_limits.empty() && m_location_limits.empty() && !m_collapse_duplicates )
+    return;
+
+  if ( !(report_message->get_action() & (UVM_DISPLAY | UVM_LOG)) ||
+       (report_message->get_severity() == UVM_FATAL) )
+    return;
+
+  bool suppress = false;
+  const std::string id = report_message->get_id();
+
+  if (!m_id_limits.empty())
+  {
+    m_report_limit* limit = m_default_limit;
+    id_limit_map::iterator it = m_id_limits.find(id);
+
+    if (it != m_id_limits.end())
+      limit = &it->second;
+    else if (limit != NULL)
+      // every id counts its own messages against the default limit
+      limit = &m_id_limits.insert(it, id_limit_map::value_type(id, *m_default_limit))->second;
+
+    if (limit != NULL)
+    {
+      unsigned int n = limit->seen++;
+      if (n >= static_cast<unsigned int>(limit->first))
+        suppress = (limit->every <= 0) ||
+                   ((n - limit->first + 1) % limit->every != 0);
+    }
+  }
+
+  if (!suppress && !m_location_limits.empty())
+  {
+    location_limit_map::iterator it = m_location_limits.find(
+      location_t(report_message->get_filename(), report_message->get_line()));
+
+    if (it != m_location_limits.end())
+    {
+      unsigned int n = it->second.seen++;
+      if (n >= static_cast<unsigned int>(it->second.first))
+        suppress = (it->second.every <= 0) ||
+                   ((n - it->second.first + 1) % it->second.every != 0);
+    }
+  }
+
+  if (!suppress && m_collapse_duplicates)
+  {
+    if ( report_message->get_severity() == m_last_severity &&
+         report_message->get_report_handler() == m_last_handler &&
+         report_message->get_line() == m_last_line &&
+         id == m_last_id &&
+         report_message->get_message() == m_last_message &&
+         report_message->get_filename() == m_last_filename )
+    {
+      m_repeat_count++;
+      suppress = true;
+    }
+    else
+    {
+      m_flush_repeats();
+      m_last_severity = report_message->get_severity();
+      m_last_handler = report_message->get_report_handler();
+      m_last_line = report_message->get_line();
+      m_last_id = id;
+      m_last_message = report_message->get_message();
+      m_last_filename = report_message->get_filename();
+    }
+  }
+
+  if (suppress)
+  {
+    m_suppressed_count[id]++;
+    report_message->set_action(report_message->get_action() & ~(UVM_DISPLAY | UVM_LOG));
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: m_flush_repeats
+//
+//! Implementation-defined member function
+//! Shows how often the previous message was repeated, if it was.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::m_flush_repeats() const
+{
+  if (m_repeat_count == 0)
+    return;
+
+  std::ostringstream str;
+  str << "    (previous message repeated " << m_repeat_count << " times)";
+  m_repeat_count = 0;
+  f_display(0, str.str());
 }
 
 //----------------------------------------------------------------------------
@@ -371,9 +645,14 @@ void uvm_default_report_server::process_report_message( uvm_report_message* repo
   // Set the report server for this message
   report_message->set_report_server(this);
 
+  uvm_report_profile_entry* profile = m_profile_entry(report_message);
+
   if(report_ok)
     report_ok = uvm_report_catcher::process_all_report_catchers(report_message);
 
+  if(profile != NULL && !report_ok)
+    profile->caught++;
+
   if(report_message->get_action() == UVM_NO_ACTION)
     report_ok = false;
 
@@ -384,14 +663,69 @@ void uvm_default_report_server::process_report_message( uvm_report_message* repo
     // give the global server a chance to intercept the calls
     uvm_report_server* svr = cs->get_report_server();
 
+    m_apply_report_limits(report_message);
+
+    double start = (profile != NULL) ? uvm_report_profiler::m_now() : 0.0;
+
     // no need to compose when neither UVM_DISPLAY nor UVM_LOG is set
     if (report_message->get_action() & (UVM_LOG|UVM_DISPLAY))
       m = svr->compose_report_message(report_message);
 
+    if (profile != NULL)
+      start = m_profile_compose(profile, report_message, start);
+
     svr->execute_report_message(report_message, m);
+
+    if (profile != NULL)
+      profile->write_time += uvm_report_profiler::m_now() - start;
   }
 }
 
+//----------------------------------------------------------------------------
+// member function: m_profile_entry
+//
+//! Implementation-defined member function
+//! Returns the profile of the call site of \p report_message, with its
+//! report count incremented, or NULL if profiling is disabled.
+//----------------------------------------------------------------------------
+
+uvm_report_profile_entry* uvm_default_report_server::m_profile_entry(
+    uvm_report_message* report_message ) const
+{
+  if (!uvm_report_profiler::m_enabled)
+    return NULL;
+
+  uvm_report_profile_entry* profile =
+    &uvm_report_profiler::get()->m_entry(report_message->get_filename(),
+                                         report_message->get_line(),
+                                         report_message->get_id());
+  profile->reports++;
+  return profile;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_profile_compose
+//
+//! Implementation-defined member function
+//! Adds the time since \p start to the compose time of \p profile, and
+//! counts the message as displayed if it is displayed or logged. Returns
+//! the current time.
+//----------------------------------------------------------------------------
+
+double uvm_default_report_server::m_profile_compose(
+    uvm_report_profile_entry* profile,
+    uvm_report_message* report_message,
+    double start ) const
+{
+  double now = uvm_report_profiler::m_now();
+  profile->compose_time += now - start;
+
+  if (report_message->get_action() & (UVM_LOG|UVM_DISPLAY))
+    profile->displayed++;
+
+  return now;
+}
+
 //----------------------------------------------------------------------------
 // member function: execute_report_message (virtual)
 //
@@ -463,7 +797,7 @@ void uvm_default_report_server::execute_report_message(
 
   // DISPLAY action (to stdout)
   if(report_message->get_action() & UVM_DISPLAY)
-    std::cout << composed_message << std::endl;
+    f_display(0, composed_message);
 
   // LOG action (to file)
   if(report_message->get_action() & UVM_LOG)
@@ -472,6 +806,10 @@ void uvm_default_report_server::execute_report_message(
     f_display(tmp_file, composed_message);
   }
 
+  // errors and fatals must be visible before anything else happens
+  if(report_message->get_severity() >= UVM_ERROR)
+    m_sink->flush();
+
   // Process the UVM_COUNT action
   if(report_message->get_action() & UVM_COUNT)
   {
@@ -493,12 +831,16 @@ void uvm_default_report_server::execute_report_message(
     uvm_coreservice_t* cs;
     cs = uvm_coreservice_t::get();
     l_root = cs->get_root();
+    m_sink->flush();
     l_root->die();
   }
 
   // Process the UVM_STOP action
   if (report_message->get_action() & UVM_STOP)
+  {
+    m_sink->flush();
     sc_core::sc_stop(); // TODO different stop mechanism?
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -514,88 +856,135 @@ std::string uvm_default_report_server::compose_report_message(
     uvm_report_message* report_message,
     const std::string& report_object_name ) const
 {
-  std::string sev_string;
-  std::string rep_name;
+  const char* sev_string = uvm_severity_name[report_message->m_severity];
+  const std::string& time_str = m_compose_time();
+
+  const std::string* rep_name = &report_object_name;
+  if (report_object_name.empty())
+    rep_name = &report_message->get_report_handler()->m_get_full_name();
 
-  std::string filename_line_string;
-  std::string time_str;
-  std::string context_str;
-  std::string verbosity_str;
-  std::string terminator_str;
-  std::string msg_body_str;
+  // message elements are printed through the default printer
+  std::string elements_str;
+  uvm_report_message_element_container* el_container = report_message->get_element_container();
+  bool has_elements = (el_container->size() != 0);
+  if (has_elements)
+  {
+    std::string prefix = uvm_default_printer->knobs.prefix;
+    uvm_default_printer->knobs.prefix = " +";
+    elements_str = el_container->sprint();
+    uvm_default_printer->knobs.prefix = prefix;
+  }
 
-  uvm_report_message_element_container* el_container;
-  std::string prefix;
-  uvm_report_handler* l_report_handler;
+  // the buffer keeps its capacity, so in steady state the message is
+  // composed without further allocations
+  std::string& message = m_compose_buffer;
+  message.clear();
+  message.reserve( 2 * std::strlen(sev_string) + time_str.size() + rep_name->size() +
+                   report_message->m_filename.size() + report_message->m_context_name.size() +
+                   report_message->m_id.size() + report_message->m_message.size() +
+                   elements_str.size() + 48 );
 
-  sev_string = uvm_severity_name[report_message->get_severity()];
+  message.append(sev_string);
 
-  if (!report_message->get_filename().empty())
+  // the verbosity is shown as its numeric value
+  if (show_verbosity)
   {
-    std::ostringstream str;
-    str << report_message->get_filename()
-        << "("
-        << report_message->get_line()
-        << ") ";
-    filename_line_string = str.str();
+    message += '(';
+    m_append_int(message, report_message->m_verbosity);
+    message += ')';
   }
 
-  // Make definable in terms of units.
+  message += ' ';
 
-  std::ostringstream time_ostr;
-  time_ostr << sc_core::sc_time_stamp();
-  time_str = time_ostr.str();
+  if (!report_message->m_filename.empty())
+  {
+    message.append(report_message->m_filename);
+    message += '(';
+    m_append_int(message, report_message->m_line);
+    message.append(") ");
+  }
 
-  if (!report_message->get_context().empty())
-    context_str = "@@" + report_message->get_context();
+  message.append("@ ");
+  message.append(time_str);
+  message.append(": ");
+  message.append(*rep_name);
 
-  if (show_verbosity)
+  if (!report_message->m_context_name.empty())
   {
-    int verb = report_message->get_verbosity();
-      if ( (verb == UVM_NONE) &&
-           (verb == UVM_LOW) &&
-           (verb == UVM_MEDIUM) &&
-           (verb == UVM_HIGH) &&
-           (verb == UVM_FULL) &&
-           (verb == UVM_DEBUG) )
-      verbosity_str = uvm_verbosity_name[verb/100];
-    else
-    {
-      std::ostringstream str;
-      str << "(" << report_message->get_verbosity() << ")";
-      verbosity_str = str.str();
-    }
+    message.append("@@");
+    message.append(report_message->m_context_name);
   }
 
-  if (show_terminator)
-    terminator_str = " -" + sev_string;
+  message.append(" [");
+  message.append(report_message->m_id);
+  message.append("] ");
+  message.append(report_message->m_message);
 
-  el_container = report_message->get_element_container();
-  if (el_container->size() == 0)
-    msg_body_str = report_message->get_message();
-  else
+  if (has_elements)
   {
-    prefix = uvm_default_printer->knobs.prefix;
-    uvm_default_printer->knobs.prefix = " +";
-    msg_body_str = report_message->get_message() + "\n" + el_container->sprint();
-    uvm_default_printer->knobs.prefix = prefix;
+    message += '\n';
+    message.append(elements_str);
   }
 
-  if (report_object_name.empty())
+  if (show_terminator)
   {
-    l_report_handler = report_message->get_report_handler();
-    rep_name = l_report_handler->get_full_name();
+    message.append(" -");
+    message.append(sev_string);
   }
-  else
-    rep_name = report_object_name;
-
-  std::string message = sev_string + verbosity_str + " " + filename_line_string + "@ " +
-      time_str + ": " + rep_name + context_str +
-      " [" + report_message->get_id() + "] " + msg_body_str + terminator_str;
 
   return message;
 }
 
+//----------------------------------------------------------------------------
+// member function: m_compose_time
+//
+//! Implementation-defined member function
+//! Returns the current simulation time as formatted in composed messages.
+//! The string is only formatted again when the time has advanced.
+//----------------------------------------------------------------------------
+
+const std::string& uvm_default_report_server::m_compose_time() const
+{
+  const sc_core::sc_time& now = sc_core::sc_time_stamp();
+
+  if (!m_time_valid || now != m_time_stamp)
+  {
+    std::ostringstream str;
+    str << now;
+    m_time_str = str.str();
+    m_time_stamp = now;
+    m_time_valid = true;
+  }
+
+  return m_time_str;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_append_int (static)
+//
+//! Implementation-defined member function
+//! Appends the decimal representation of \p value to \p str, formatted
+//! the same as by an output stream.
+//----------------------------------------------------------------------------
+
+void uvm_default_report_server::m_append_int( std::string& str, int value )
+{
+  char buf[16];
+  char* p = buf + sizeof(buf);
+  unsigned int u = (value < 0) ? 0u - static_cast<unsigned int>(value)
+                               : static_cast<unsigned int>(value);
+  do
+  {
+    *--p = static_cast<char>('0' + u % 10);
+    u /= 10;
+  } while (u != 0);
+
+  if (value < 0)
+    *--p = '-';
+
+  str.append(p, buf + sizeof(buf) - p);
+}
+
 //----------------------------------------------------------------------------
 // member function: report_summarize (virtual)
 //
@@ -663,7 +1052,58 @@ void uvm_default_report_server::report_summarize( UVM_FILE file ) const
     }
   }
 
+  if (!m_suppressed_count.empty())
+  {
+    q.push_back("** Suppressed reports by id\n");
+    for( id_count_citt it = m_suppressed_count.begin();
+         it != m_suppressed_count.end();
+         it++)
+    {
+      std::ostringstream output_str;
+      output_str << "["
+                 << it->first
+                 << "] "
+                 << space.substr(1, 20-(it->first).length())
+                 << std::setw(2)
+                 << it->second
+                 << "\n";
+      q.push_back(output_str.str());
+    }
+  }
+
+  if (uvm_report_profiler::m_enabled)
+  {
+    uvm_report_profiler* profiler = uvm_report_profiler::get();
+
+    std::ostringstream output_str;
+    profiler->print_ranked(output_str);
+    q.push_back(output_str.str());
+
+    if ( !profiler->get_csv_file().empty() &&
+         !profiler->write_csv(profiler->get_csv_file()) )
+      UVM_WARNING("UVM/REPORT/PROFILE",
+        "Cannot write the report profile to '" + profiler->get_csv_file() + "'.");
+  }
+
+  const std::vector<uvm_tr_database*>& dbs = uvm_tr_database::m_get_databases();
+  for (unsigned int i = 0; i < dbs.size(); i++)
+  {
+    // write the pending records, so that the statistics are complete
+    dbs[i]->flush();
+
+    if (dbs[i]->get_statistics().bytes == 0)
+      continue;
+
+    std::ostringstream output_str;
+    dbs[i]->print_statistics(output_str);
+    q.push_back(output_str.str());
+  }
+
+  m_flush_repeats();
+
   UVM_INFO("UVM/REPORT/SERVER", UVM_STRING_QUEUE_STREAMING_PACK(q), UVM_LOW);
+
+  m_sink->flush();
 }
 
 
@@ -678,5 +1118,15 @@ const std::string uvm_default_report_server::get_type_name() const
   return "uvm_default_report_server";
 }
 
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+uvm_default_report_server::~uvm_default_report_server()
+{
+  m_sink->flush();
+  delete m_own_sink;
+}
+
 
 } // namespace uvm
@@ -37,6 +37,9 @@ namespace uvm {
 //class uvm_tr_stream;
 class uvm_object_server;
 class uvm_report_message;
+class uvm_report_sink;
+class uvm_report_handler;
+struct uvm_report_profile_entry;
 
 //----------------------------------------------------------------------------
 // CLASS: uvm_default_report_server
@@ -138,11 +141,38 @@ class uvm_default_report_server : public uvm_report_server
 
   void f_display( UVM_FILE file, const std::string& str ) const;
 
+  void set_report_sink( uvm_report_sink* sink );
 
+  uvm_report_sink* get_report_sink() const;
+
+  void set_id_limit( const std::string& id, int first, int every = 0 );
+
+  void set_location_limit( const std::string& filename, int line,
+                           int first, int every = 0 );
+
+  void set_collapse_duplicates( bool collapse );
+
+  int get_suppressed_count( const std::string& id ) const;
 
   const std::string get_type_name() const;
 
+  virtual ~uvm_default_report_server();
+
+ protected:
+  void m_apply_report_limits( uvm_report_message* report_message );
+
+  uvm_report_profile_entry* m_profile_entry( uvm_report_message* report_message ) const;
+
+  double m_profile_compose( uvm_report_profile_entry* profile,
+                            uvm_report_message* report_message,
+                            double start ) const;
+
+  const std::string& m_compose_time() const;
+
+  static void m_append_int( std::string& str, int value );
+
  private:
+  void m_flush_repeats() const;
   // local data members
 
   int m_quit_count;
@@ -150,6 +180,11 @@ class uvm_default_report_server : public uvm_report_server
 
   bool max_quit_overridable;
 
+  // output sink for composed messages, and the sink created by the
+  // server itself (if any), which it deletes
+  uvm_report_sink* m_sink;
+  uvm_report_sink* m_own_sink;
+
   typedef std::map<uvm_severity, int> severity_count_map;
   mutable severity_count_map m_severity_count;
   typedef severity_count_map::iterator severity_count_itt;
@@ -160,6 +195,43 @@ class uvm_default_report_server : public uvm_report_server
   typedef id_count_map::iterator id_count_itt;
   typedef id_count_map::const_iterator id_count_citt;
 
+  // display limits: the first messages are shown, after that only every
+  // m-th message; a limit with id "*" applies to all other ids
+  struct m_report_limit
+  {
+    int first;
+    int every;
+    unsigned int seen;
+  };
+
+  typedef std::map<std::string, m_report_limit> id_limit_map;
+  id_limit_map m_id_limits;
+  m_report_limit* m_default_limit;
+
+  typedef std::pair<std::string, int> location_t;
+  typedef std::map<location_t, m_report_limit> location_limit_map;
+  location_limit_map m_location_limits;
+
+  // number of suppressed messages per id
+  id_count_map m_suppressed_count;
+
+  // collapsing of identical consecutive messages
+  bool m_collapse_duplicates;
+  mutable unsigned int m_repeat_count;
+  uvm_severity m_last_severity;
+  std::string m_last_id;
+  std::string m_last_message;
+  std::string m_last_filename;
+  int m_last_line;
+  uvm_report_handler* m_last_handler;
+
+  // reused by compose_report_message, and the formatted simulation time,
+  // which only changes when the time advances
+  mutable std::string m_compose_buffer;
+  mutable sc_core::sc_time m_time_stamp;
+  mutable std::string m_time_str;
+  mutable bool m_time_valid;
+
   // TODO transaction database
   //uvm_tr_database* m_message_db;
   //uvm_tr_stream* m_streams[string][string]; // ro.name,rh.name
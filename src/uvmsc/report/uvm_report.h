@@ -26,5 +26,9 @@
 #include "uvmsc/report/uvm_report_server.h"
 #include "uvmsc/report/uvm_report_message.h"
 #include "uvmsc/report/uvm_default_report_server.h"
+#include "uvmsc/report/uvm_report_sink.h"
+#include "uvmsc/report/uvm_binary_report_server.h"
+#include "uvmsc/report/uvm_report_profiler.h"
+#include "uvmsc/report/uvm_binary_report_reader.h"
 
 #endif // UVM_REPORT_H_
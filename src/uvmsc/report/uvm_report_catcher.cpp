@@ -22,6 +22,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 #include "uvmsc/report/uvm_report_object.h"
 #include "uvmsc/report/uvm_report_message.h"
@@ -41,7 +42,11 @@ namespace uvm {
 uvm_report_catcher::uvm_report_catcher( const std::string& name )
 : uvm_callback(name)
 {
-  uvm_report_catcher_data::get().do_report = true;
+  uvm_report_catcher_data& rcd = uvm_report_catcher_data::get();
+
+  rcd.do_report = true;
+  rcd.m_catchers.push_back(this);
+  rcd.m_dispatch_valid = false;
 
   // register the catcher callback
   // this differs from UVMSV since we cannot register using the macro
@@ -49,6 +54,21 @@ uvm_report_catcher::uvm_report_catcher( const std::string& name )
   m_register_cb();
 }
 
+//------------------------------------------------------------------------------
+// Destructor
+//------------------------------------------------------------------------------
+
+uvm_report_catcher::~uvm_report_catcher()
+{
+  uvm_report_catcher_data& rcd = uvm_report_catcher_data::get();
+
+  std::vector<uvm_report_catcher*>::iterator it =
+    std::find(rcd.m_catchers.begin(), rcd.m_catchers.end(), this);
+  if (it != rcd.m_catchers.end())
+    rcd.m_catchers.erase(it);
+  rcd.m_dispatch_valid = false;
+}
+
 //------------------------------------------------------------------------------
 // Group: Current Message State
 //------------------------------------------------------------------------------
@@ -529,10 +549,11 @@ void uvm_report_catcher::uvm_report( uvm_severity severity,
       return;
   }
 
-  l_report_message = uvm_report_message::new_report_message();
+  l_report_message = uvm_report_message::m_get_report_message();
   l_report_message->set_report_message(severity, id, message,
                                       verbosity, fname, line, context_name);
   uvm_process_report_message(l_report_message);
+  uvm_report_message::m_free_report_message(l_report_message);
 
 }
 
@@ -573,7 +594,7 @@ void uvm_report_catcher::issue()
 bool uvm_report_catcher::process_all_report_catchers( uvm_report_message* rm )
 {
   uvm_report_catcher_data& rcd = uvm_report_catcher_data::get();
-  int iter;
+  int pos = -1;
   uvm_report_catcher* catcher;
   int thrown = true;
   uvm_severity orig_severity;
@@ -583,13 +604,17 @@ bool uvm_report_catcher::process_all_report_catchers( uvm_report_message* rm )
   if(in_catcher)
     return true;
 
+  // skip the catcher machinery if no catcher is interested in the message
+  if(m_dispatch(rm->get_severity(), rm->get_id()).empty())
+    return true;
+
   in_catcher = true;
   uvm_callbacks_base::m_tracing = false;  //turn off cb tracing so catcher stuff doesn't print
 
   orig_severity = rm->get_severity();
   rcd.m_modified_report_message = rm;
 
-  catcher = uvm_report_cb::get_first(iter, l_report_object);
+  catcher = m_next_catcher(l_report_object, pos);
   if (catcher != NULL)
   {
     if(rcd.m_debug_flags & rcd.DO_NOT_MODIFY)
@@ -608,12 +633,6 @@ bool uvm_report_catcher::process_all_report_catchers( uvm_report_message* rm )
   {
     uvm_severity prev_sev;
 
-    if (!catcher->callback_mode())
-    {
-      catcher = uvm_report_cb::get_next(iter, l_report_object);
-      continue;
-    }
-
     prev_sev = rcd.m_modified_report_message->get_severity();
     rcd.m_set_action_called = false;
     thrown = catcher->process_report_catcher();
@@ -642,7 +661,7 @@ bool uvm_report_catcher::process_all_report_catchers( uvm_report_message* rm )
       }
       break;
     } // if
-    catcher = uvm_report_cb::get_next(iter, l_report_object);
+    catcher = m_next_catcher(l_report_object, pos);
   } //while
 
   //update counters if message was returned with demoted severity
@@ -655,6 +674,9 @@ bool uvm_report_catcher::process_all_report_catchers( uvm_report_message* rm )
     default: break;
   }
 
+  delete rcd.m_orig_report_message;
+  rcd.m_orig_report_message = NULL;
+
   in_catcher = false;
   uvm_callbacks_base::m_tracing = true;  // turn tracing stuff back on
 
@@ -662,6 +684,177 @@ bool uvm_report_catcher::process_all_report_catchers( uvm_report_message* rm )
 }
 
 
+//------------------------------------------------------------------------------
+// member function: add_id_filter
+//
+//! Restricts the catcher to messages with id \p id. The filter can be
+//! extended by multiple calls. Messages which no catcher is interested in
+//! bypass the report catchers entirely.
+//------------------------------------------------------------------------------
+
+void uvm_report_catcher::add_id_filter( const std::string& id )
+{
+  m_filter_ids.insert(id);
+  uvm_report_catcher_data::get().m_dispatch_valid = false;
+}
+
+//------------------------------------------------------------------------------
+// member function: add_severity_filter
+//
+//! Restricts the catcher to messages with severity \p severity. The filter
+//! can be extended by multiple calls, and combines with the id filter.
+//------------------------------------------------------------------------------
+
+void uvm_report_catcher::add_severity_filter( uvm_severity severity )
+{
+  m_filter_severities.insert(severity);
+  uvm_report_catcher_data::get().m_dispatch_valid = false;
+}
+
+//------------------------------------------------------------------------------
+// member function: clear_filters
+//
+//! Removes the id and severity filters, so the catcher sees all messages.
+//------------------------------------------------------------------------------
+
+void uvm_report_catcher::clear_filters()
+{
+  m_filter_ids.clear();
+  m_filter_severities.clear();
+  uvm_report_catcher_data::get().m_dispatch_valid = false;
+}
+
+//------------------------------------------------------------------------------
+// member function: is_interested
+//
+//! Returns true if the filters of the catcher accept a message with
+//! severity \p severity and id \p id.
+//------------------------------------------------------------------------------
+
+bool uvm_report_catcher::is_interested( uvm_severity severity,
+                                        const std::string& id ) const
+{
+  return ( m_filter_severities.empty() ||
+           m_filter_severities.find(severity) != m_filter_severities.end() ) &&
+         ( m_filter_ids.empty() ||
+           m_filter_ids.find(id) != m_filter_ids.end() );
+}
+
+//------------------------------------------------------------------------------
+// member function: m_build_dispatch (static)
+//
+//! Implementation-defined member function
+//! Builds the dispatch lists from the filters of the catchers in existence.
+//------------------------------------------------------------------------------
+
+void uvm_report_catcher::m_build_dispatch()
+{
+  uvm_report_catcher_data& rcd = uvm_report_catcher_data::get();
+
+  rcd.m_dispatch_any = uvm_report_catcher_data::m_dispatch_lists();
+  rcd.m_dispatch_ids.clear();
+
+  for (unsigned int i = 0; i < rcd.m_catchers.size(); i++)
+  {
+    const std::set<std::string>& ids = rcd.m_catchers[i]->m_filter_ids;
+    for (std::set<std::string>::const_iterator it = ids.begin(); it != ids.end(); it++)
+      rcd.m_dispatch_ids[*it];
+  }
+
+  for (int s = UVM_INFO; s <= UVM_FATAL; s++)
+  {
+    uvm_severity severity = static_cast<uvm_severity>(s);
+
+    for (unsigned int i = 0; i < rcd.m_catchers.size(); i++)
+    {
+      uvm_report_catcher* catcher = rcd.m_catchers[i];
+
+      if (catcher->m_filter_ids.empty() && catcher->is_interested(severity, ""))
+        rcd.m_dispatch_any.severity[s].push_back(catcher);
+
+      for (uvm_report_catcher_data::dispatch_mapT::iterator it = rcd.m_dispatch_ids.begin();
+           it != rcd.m_dispatch_ids.end(); it++)
+        if (catcher->is_interested(severity, it->first))
+          it->second.severity[s].push_back(catcher);
+    }
+  }
+
+  rcd.m_dispatch_valid = true;
+}
+
+//------------------------------------------------------------------------------
+// member function: m_dispatch (static)
+//
+//! Implementation-defined member function
+//! Returns the catchers whose filters accept a message with severity
+//! \p severity and id \p id, in order of creation.
+//------------------------------------------------------------------------------
+
+const std::vector<uvm_report_catcher*>& uvm_report_catcher::m_dispatch( uvm_severity severity,
+                                                                        const std::string& id )
+{
+  static const std::vector<uvm_report_catcher*> none;
+  uvm_report_catcher_data& rcd = uvm_report_catcher_data::get();
+
+  if (severity < UVM_INFO || severity > UVM_FATAL)
+    return none;
+
+  if (!rcd.m_dispatch_valid)
+    m_build_dispatch();
+
+  if (!rcd.m_dispatch_ids.empty())
+  {
+    uvm_report_catcher_data::dispatch_mapT::const_iterator it = rcd.m_dispatch_ids.find(id);
+    if (it != rcd.m_dispatch_ids.end())
+      return it->second.severity[severity];
+  }
+
+  return rcd.m_dispatch_any.severity[severity];
+}
+
+//------------------------------------------------------------------------------
+// member function: m_next_catcher (static)
+//
+//! Implementation-defined member function
+//! Returns the enabled catcher registered for \p obj which follows position
+//! \p pos in its callback queue and accepts the message being processed,
+//! and sets \p pos to its position. Only the dispatch list of the current
+//! severity and id of the message is examined, which may have been changed
+//! by the previous catcher. Returns NULL if there is none.
+//------------------------------------------------------------------------------
+
+uvm_report_catcher* uvm_report_catcher::m_next_catcher( uvm_report_object* obj,
+                                                        int& pos )
+{
+  uvm_report_catcher_data& rcd = uvm_report_catcher_data::get();
+
+  const std::vector<uvm_report_catcher*>& candidates =
+    m_dispatch(rcd.m_modified_report_message->get_severity(),
+               rcd.m_modified_report_message->get_id());
+
+  uvm_report_catcher* next = NULL;
+  int next_pos = 0;
+
+  for (unsigned int i = 0; i < candidates.size(); i++)
+  {
+    uvm_report_catcher* catcher = candidates[i];
+    if (!catcher->callback_mode())
+      continue;
+
+    int p = uvm_report_cb::m_find(obj, catcher);
+    if (p > pos && (next == NULL || p < next_pos))
+    {
+      next = catcher;
+      next_pos = p;
+    }
+  }
+
+  if (next != NULL)
+    pos = next_pos;
+
+  return next;
+}
+
 //------------------------------------------------------------------------------
 // member function: process_report_catcher
 //
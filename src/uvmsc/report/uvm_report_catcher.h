@@ -23,7 +23,9 @@
 #ifndef UVM_REPORT_CATCHER_H_
 #define UVM_REPORT_CATCHER_H_
 
+#include <set>
 #include <string>
+#include <vector>
 
 #include "uvmsc/macros/uvm_callback_defines.h"
 #include "uvmsc/cb/uvm_callbacks.h"
@@ -226,8 +228,29 @@ class uvm_report_catcher : public uvm_callback
 
   static void debug_report_catcher( int what = 0 );
 
+  void add_id_filter( const std::string& id );
+
+  void add_severity_filter( uvm_severity severity );
+
+  void clear_filters();
+
+  bool is_interested( uvm_severity severity, const std::string& id ) const;
+
+  virtual ~uvm_report_catcher();
+
  private:
 
+  static void m_build_dispatch();
+
+  static const std::vector<uvm_report_catcher*>& m_dispatch( uvm_severity severity,
+                                                             const std::string& id );
+
+  static uvm_report_catcher* m_next_catcher( uvm_report_object* obj, int& pos );
+
+  // ids and severities this catcher is interested in; empty means all
+  std::set<std::string> m_filter_ids;
+  std::set<uvm_severity> m_filter_severities;
+
   std::string get_context() const;
 
   int process_report_catcher();
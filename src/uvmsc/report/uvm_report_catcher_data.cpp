@@ -38,7 +38,8 @@ uvm_report_catcher_data::uvm_report_catcher_data()
     m_caught_error(0),
     m_caught_warning(0),
     DO_NOT_CATCH(1),
-    DO_NOT_MODIFY(2)
+    DO_NOT_MODIFY(2),
+    m_dispatch_valid(false)
 {
 }
 
@@ -23,13 +23,18 @@
 #ifndef UVM_REPORT_CATCHER_DATA_H_
 #define UVM_REPORT_CATCHER_DATA_H_
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/report/uvm_report_object.h"
 
 namespace uvm {
 
+// forward class declarations
+class uvm_report_catcher;
+
 //----------------------------------------------------------------------------
 // CLASS: uvm_report_catcher_data
 //
@@ -75,6 +80,28 @@ class uvm_report_catcher_data
 
   bool do_report;
 
+  // All catchers in existence, in order of creation
+
+  std::vector<uvm_report_catcher*> m_catchers;
+
+  // Dispatch lists of the catchers whose filters accept a message: per
+  // severity for the ids which no id filter names, and per severity for
+  // each id named in an id filter. The lists are rebuilt from the filters
+  // for the next message after a catcher is created or destroyed, or its
+  // filter changes, so their number is bounded by the filters.
+
+  struct m_dispatch_lists
+  {
+    std::vector<uvm_report_catcher*> severity[UVM_FATAL + 1];
+  };
+
+  m_dispatch_lists m_dispatch_any;
+
+  typedef std::map<std::string, m_dispatch_lists> dispatch_mapT;
+  dispatch_mapT m_dispatch_ids;
+
+  bool m_dispatch_valid;
+
 }; // class uvm_report_catcher_data
 
 } // namespace uvm
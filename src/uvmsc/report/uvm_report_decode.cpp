@@ -0,0 +1,152 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+//
+// uvm-report-decode: prints the messages of a log written by the
+// uvm_binary_report_server, as the uvm_default_report_server would have
+// displayed them.
+//
+//   uvm-report-decode <log> [-id ID] [-severity SEVERITY]
+//                           [-from TIME] [-to TIME]
+//
+// where SEVERITY is the minimum severity (UVM_INFO, UVM_WARNING,
+// UVM_ERROR or UVM_FATAL) and TIME is a number with a unit, e.g. 15ns.
+// A log is written by any simulation when the environment variable
+// UVM_SYSTEMC_REPORT_BINARY names the log file.
+//
+// The tool only uses the uvm_binary_report_reader; it is not linked
+// against SystemC or the rest of the library.
+//
+// Returns 0 on success, 1 if the log cannot be read and 2 for a usage
+// error.
+//----------------------------------------------------------------------
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "uvmsc/report/uvm_binary_report_reader.h"
+
+using uvm::uvm_binary_report_reader;
+using uvm::uvm_binary_report_record;
+
+static int usage()
+{
+  std::cerr << "Usage: uvm-report-decode <log> [-id ID] [-severity SEVERITY]"
+            << " [-from TIME] [-to TIME]" << std::endl;
+  return 2;
+}
+
+// converts a time with a unit to seconds; returns false for a bad unit
+static bool parse_time( const char* str, double& seconds )
+{
+  static const char* units[] = { "fs", "ps", "ns", "us", "ms", "s" };
+
+  char* unit = NULL;
+  double t = std::strtod(str, &unit);
+  if (unit == str)
+    return false;
+
+  double scale = 1e-15;
+  for (int i = 0; i < 6; i++, scale *= 1000)
+    if (std::strcmp(unit, units[i]) == 0)
+    {
+      seconds = t * scale;
+      return true;
+    }
+  return false;
+}
+
+int main( int argc, char* argv[] )
+{
+  if (argc < 2 || argv[1][0] == '-')
+    return usage();
+
+  std::string id;
+  int severity = 0;
+  double from = -1.0;
+  double to = -1.0;
+
+  for (int i = 2; i < argc; i += 2)
+  {
+    if (i + 1 == argc)
+    {
+      std::cerr << "Missing value for option '" << argv[i] << "'" << std::endl;
+      return usage();
+    }
+
+    if (std::strcmp(argv[i], "-id") == 0)
+      id = argv[i + 1];
+    else if (std::strcmp(argv[i], "-severity") == 0)
+    {
+      const char* name = NULL;
+      for (severity = 0; (name = uvm_binary_report_reader::severity_name(severity)) != NULL; severity++)
+        if (std::strcmp(argv[i + 1], name) == 0)
+          break;
+
+      if (name == NULL)
+      {
+        std::cerr << "Unknown severity '" << argv[i + 1] << "'" << std::endl;
+        return usage();
+      }
+    }
+    else if (std::strcmp(argv[i], "-from") == 0 || std::strcmp(argv[i], "-to") == 0)
+    {
+      double& t = (argv[i][1] == 'f') ? from : to;
+      if (!parse_time(argv[i + 1], t))
+      {
+        std::cerr << "Bad time '" << argv[i + 1] << "'" << std::endl;
+        return usage();
+      }
+    }
+    else
+    {
+      std::cerr << "Unknown option '" << argv[i] << "'" << std::endl;
+      return usage();
+    }
+  }
+
+  uvm_binary_report_reader reader;
+  if (!reader.open(argv[1]))
+  {
+    std::cerr << reader.get_error() << std::endl;
+    return 1;
+  }
+
+  uvm_binary_report_record rec;
+  while (reader.next(rec))
+  {
+    double t = uvm_binary_report_reader::time_seconds(rec);
+
+    if ( rec.severity < severity ||
+         (!id.empty() && reader.get_string(rec.id) != id) ||
+         (from >= 0.0 && t < from) ||
+         (to >= 0.0 && t > to) )
+      continue;
+
+    std::cout << reader.compose(rec) << std::endl;
+  }
+
+  if (!reader.get_error().empty())
+  {
+    std::cerr << reader.get_error() << std::endl;
+    return 1;
+  }
+  return 0;
+}
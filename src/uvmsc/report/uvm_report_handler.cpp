@@ -48,11 +48,47 @@ namespace uvm {
 //----------------------------------------------------------------------------
 
 uvm_report_handler::uvm_report_handler( const std::string name )
-: uvm_object(name)
+: uvm_object(name),
+  m_id_settings_table(),
+  m_id_settings_count(0),
+  m_settings_version(1),
+  m_full_name_cache(),
+  m_full_name_valid(false)
 {
   initialize();
 }
 
+//----------------------------------------------------------------------------
+// member function: set_name (virtual)
+//
+//! Sets the instance name of the handler, and drops the cached full name.
+//----------------------------------------------------------------------------
+
+void uvm_report_handler::set_name( const std::string& name )
+{
+  uvm_object::set_name(name);
+  m_full_name_valid = false;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_get_full_name
+//
+//! Implementation-defined member function
+//! Returns the full name of the handler without copying it. The name is
+//! cached on first use, as it is part of every message composed for the
+//! handler.
+//----------------------------------------------------------------------------
+
+const std::string& uvm_report_handler::m_get_full_name() const
+{
+  if (!m_full_name_valid)
+  {
+    m_full_name_cache = get_full_name();
+    m_full_name_valid = true;
+  }
+  return m_full_name_cache;
+}
+
 
 //----------------------------------------------------------------------------
 // member function: do_print (virtual)
@@ -366,31 +402,21 @@ void uvm_report_handler::process_report_message(uvm_report_message* report_messa
 {
   uvm_report_server* srvr = uvm_report_server::get_server();
 
-  std::string id = report_message->get_id();
   uvm_severity severity = report_message->get_severity();
+  const m_id_settings& settings = m_get_id_settings(report_message->get_id());
 
   // Check for severity overrides and apply them before calling the server.
-  // An id specific override has precedence over a generic severity override.
+  // An id specific override has precedence over a generic severity override;
+  // both are already folded into the resolved settings of this id.
 
-  if(sev_id_overrides.find(id) != sev_id_overrides.end()) //exists
+  if(settings.sev_override[severity] != severity)
   {
-    if(sev_id_overrides[id].find(severity) != sev_id_overrides[id].end()) //exists
-    {
-      severity = sev_id_overrides[id][severity];
-      report_message->set_severity(severity);
-    }
-  }
-  else
-  {
-    if(sev_overrides.find(severity) != sev_overrides.end()) //exists
-    {
-      severity = sev_overrides[severity];
-      report_message->set_severity(severity);
-    }
+    severity = settings.sev_override[severity];
+    report_message->set_severity(severity);
   }
-  report_message->set_file(get_file_handle(severity, id));
+  report_message->set_file(settings.file[severity]);
   report_message->set_report_handler(this);
-  report_message->set_action(get_action(severity, id));
+  report_message->set_action(settings.action[severity]);
   srvr->process_report_message(report_message);
 }
 
@@ -407,20 +433,7 @@ void uvm_report_handler::process_report_message(uvm_report_message* report_messa
 int uvm_report_handler::get_verbosity_level( uvm_severity severity,
                                              const std::string& id )
 {
-  uvm_id_verbosities_array array;
-  std::string loc_id = id;
-
-  if( severity_id_verbosities.find(severity) != severity_id_verbosities.end() ) //exists
-  {
-    array = severity_id_verbosities[severity];
-    if(array.find(loc_id) != array.end())
-      return array[loc_id];
-  }
-
-  if(id_verbosities.find(loc_id) != id_verbosities.end())
-    return id_verbosities[loc_id];
-
-  return m_max_verbosity_level;
+  return m_get_id_settings(id).verbosity[severity];
 }
 
 //----------------------------------------------------------------------------
@@ -437,20 +450,7 @@ int uvm_report_handler::get_verbosity_level( uvm_severity severity,
 uvm_action uvm_report_handler::get_action( uvm_severity severity,
                                            const std::string& id )
 {
-  uvm_id_actions_array array;
-  std::string loc_id = id;
-
-  if(severity_id_actions.find(severity) != severity_id_actions.end())
-  {
-    array = severity_id_actions[severity];
-    if(array.find(loc_id) != array.end())
-      return array[loc_id];
-  }
-
-  if(id_actions.find(loc_id) != id_actions.end())
-    return id_actions[loc_id];
-
-  return severity_actions[severity];
+  return m_get_id_settings(id).action[severity];
 }
 
 //----------------------------------------------------------------------------
@@ -467,28 +467,7 @@ uvm_action uvm_report_handler::get_action( uvm_severity severity,
 UVM_FILE uvm_report_handler::get_file_handle( uvm_severity severity,
                                               const std::string& id )
 {
-  UVM_FILE file;
-  std::string loc_id = id;
-
-  file = get_severity_id_file(severity, id);
-  if (file != 0)
-    return file;
-
-  if (id_file_handles.find(loc_id) != id_file_handles.end())
-  {
-    file = id_file_handles[loc_id];
-    if (file != 0)
-      return file;
-  }
-
-  if (severity_file_handles.find(severity) != severity_file_handles.end()) //exists
-  {
-    file = severity_file_handles[severity];
-    if(file != 0)
-      return file;
-  }
-
-  return default_file_handle;
+  return m_get_id_settings(id).file[severity];
 }
 
 //----------------------------------------------------------------------------
@@ -518,12 +497,13 @@ void uvm_report_handler::report( uvm_severity severity,
   if (client == NULL)
     client = cs->get_root();
 
-  l_report_message = uvm_report_message::new_report_message();
+  l_report_message = uvm_report_message::m_get_report_message();
   l_report_message->set_report_message(severity, id, message,
                                       verbosity_level, filename, line, name);
   l_report_message->set_report_object(client);
   l_report_message->set_action(get_action(severity,id));
   process_report_message(l_report_message);
+  uvm_report_message::m_free_report_message(l_report_message);
 }
 
 //----------------------------------------------------------------------------
@@ -580,7 +560,7 @@ uvm_report_handler::~uvm_report_handler()
 void uvm_report_handler::initialize()
 {
   set_default_file(0);
-  m_max_verbosity_level = UVM_MEDIUM;
+  set_verbosity_level(UVM_MEDIUM);
 
   set_severity_action(UVM_INFO,    UVM_DISPLAY);
   set_severity_action(UVM_WARNING, UVM_DISPLAY);
@@ -600,27 +580,236 @@ void uvm_report_handler::initialize()
 //----------------------------------------------------------------------------
 
 UVM_FILE uvm_report_handler::get_severity_id_file( uvm_severity severity,
-                                                   const std::string& id )
+                                                   const std::string& id ) const
 {
-  uvm_id_file_array array;
-  std::string loc_id = id;
-
-  if(severity_id_file_handles.find(severity) != severity_id_file_handles.end() ) // exists
+  severity_id_file_handles_mapcitt sit = severity_id_file_handles.find(severity);
+  if(sit != severity_id_file_handles.end()) // exists
   {
-    array = severity_id_file_handles[severity];
-    if(array.find(loc_id) != array.end())
-      return array[loc_id];
+    id_file_handles_mapcitt it = sit->second.find(id);
+    if(it != sit->second.end())
+      return it->second;
   }
 
-  if(id_file_handles.find(loc_id) != id_file_handles.end())
-    return id_file_handles[loc_id];
+  id_file_handles_mapcitt iit = id_file_handles.find(id);
+  if(iit != id_file_handles.end())
+    return iit->second;
 
-  if(severity_file_handles.find(severity) != severity_file_handles.end()) // exists
-    return severity_file_handles[severity];
+  severity_file_handles_mapcitt fit = severity_file_handles.find(severity);
+  if(fit != severity_file_handles.end()) // exists
+    return fit->second;
 
   return default_file_handle;
 }
 
+//----------------------------------------------------------------------------
+// member function: m_get_id_settings
+//
+//! Implementation-defined member function
+//!
+//! Returns the resolved verbosity, action, file and severity override of
+//! message \p id for all severities. Entries are resolved on first use and
+//! again after any set_* call changed the configuration of this handler.
+//!
+//! The entries are kept in an open addressing hash table, so a lookup
+//! hashes \p id once and normally compares it with a single entry. At most
+//! m_max_id_settings ids get an entry, which bounds the memory used when
+//! ids are built at run time (e.g. with a transaction number in them).
+//! Later ids are reported correctly, but resolved on every call.
+//----------------------------------------------------------------------------
+
+const uvm_report_handler::m_id_settings&
+uvm_report_handler::m_get_id_settings( const std::string& id )
+{
+  std::size_t hash = m_hash_id(id);
+  std::size_t slot = m_find_id_slot(id, hash);
+
+  if(slot == m_id_settings_table.size() || !m_id_settings_table[slot].used)
+  {
+    if(m_id_settings_count >= m_max_id_settings)
+    {
+      m_resolve_id_settings(id, m_id_settings_uncached);
+      return m_id_settings_uncached;
+    }
+
+    // keep the table at most half full
+    if(2 * (m_id_settings_count + 1) > m_id_settings_table.size())
+    {
+      m_id_settings empty;
+      empty.used = false;
+      empty.hash = 0;
+      empty.version = 0;
+
+      id_settings_tableT old(m_id_settings_table.empty() ? 64 : 2 * m_id_settings_table.size(), empty);
+      old.swap(m_id_settings_table);
+
+      for(std::size_t i = 0; i < old.size(); i++)
+        if(old[i].used)
+          m_id_settings_table[m_find_id_slot(old[i].id, old[i].hash)] = old[i];
+
+      slot = m_find_id_slot(id, hash);
+    }
+
+    m_id_settings& entry = m_id_settings_table[slot];
+    entry.used = true;
+    entry.hash = hash;
+    entry.id = id;
+    entry.version = 0; // never matches m_settings_version
+    m_id_settings_count++;
+  }
+
+  m_id_settings& settings = m_id_settings_table[slot];
+  if(settings.version != m_settings_version)
+    m_resolve_id_settings(id, settings);
+
+  return settings;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_hash_id (static)
+//
+//! Implementation-defined member function
+//! Returns the FNV-1a hash of \p id.
+//----------------------------------------------------------------------------
+
+std::size_t uvm_report_handler::m_hash_id( const std::string& id )
+{
+  std::size_t hash = 2166136261u;
+  for(std::string::size_type i = 0; i < id.size(); i++)
+  {
+    hash ^= static_cast<unsigned char>(id[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_find_id_slot
+//
+//! Implementation-defined member function
+//! Returns the slot of \p id in the settings table, or the free slot
+//! where it would be inserted. Returns the size of the table if the
+//! table is still empty.
+//----------------------------------------------------------------------------
+
+std::size_t uvm_report_handler::m_find_id_slot( const std::string& id,
+                                                std::size_t hash ) const
+{
+  if(m_id_settings_table.empty())
+    return 0;
+
+  std::size_t mask = m_id_settings_table.size() - 1;
+  std::size_t i = hash & mask;
+  while(m_id_settings_table[i].used &&
+        (m_id_settings_table[i].hash != hash || m_id_settings_table[i].id != id))
+    i = (i + 1) & mask;
+  return i;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_resolve_id_settings
+//
+//! Implementation-defined member function
+//!
+//! Fills \p settings from the configuration maps, using the same precedence
+//! as the LRM lookups: (severity,id) first, then id, then severity, then
+//! the handler default.
+//----------------------------------------------------------------------------
+
+void uvm_report_handler::m_resolve_id_settings( const std::string& id,
+                                                m_id_settings& settings ) const
+{
+  id_verbosities_mapcitt vit = id_verbosities.find(id);
+  id_actions_mapcitt ait = id_actions.find(id);
+  id_file_handles_mapcitt fit = id_file_handles.find(id);
+  sev_id_overrides_mapcitt oit = sev_id_overrides.find(id);
+
+  for(int i = UVM_INFO; i <= UVM_FATAL; i++)
+  {
+    uvm_severity severity = static_cast<uvm_severity>(i);
+
+    // verbosity
+    settings.verbosity[i] = m_max_verbosity_level;
+    if(vit != id_verbosities.end())
+      settings.verbosity[i] = vit->second;
+
+    severity_id_verbosities_mapcitt svit = severity_id_verbosities.find(severity);
+    if(svit != severity_id_verbosities.end())
+    {
+      id_verbosities_mapcitt it = svit->second.find(id);
+      if(it != svit->second.end())
+        settings.verbosity[i] = it->second;
+    }
+
+    // action
+    settings.action[i] = UVM_NO_ACTION;
+    severity_actions_mapcitt sait = severity_actions.find(severity);
+    if(sait != severity_actions.end())
+      settings.action[i] = sait->second;
+
+    if(ait != id_actions.end())
+      settings.action[i] = ait->second;
+
+    severity_id_actions_mapcitt siait = severity_id_actions.find(severity);
+    if(siait != severity_id_actions.end())
+    {
+      id_actions_mapcitt it = siait->second.find(id);
+      if(it != siait->second.end())
+        settings.action[i] = it->second;
+    }
+
+    // file: first non-null handle in order of precedence
+    UVM_FILE file = get_severity_id_file(severity, id);
+
+    if(file == 0 && fit != id_file_handles.end())
+      file = fit->second;
+
+    if(file == 0)
+    {
+      severity_file_handles_mapcitt sfit = severity_file_handles.find(severity);
+      if(sfit != severity_file_handles.end())
+        file = sfit->second;
+    }
+
+    if(file == 0)
+      file = default_file_handle;
+
+    settings.file[i] = file;
+
+    // severity override: an id specific override table hides the
+    // generic severity overrides, even for severities it does not list
+    settings.sev_override[i] = severity;
+    if(oit != sev_id_overrides.end())
+    {
+      sev_overrides_mapcitt it = oit->second.find(severity);
+      if(it != oit->second.end())
+        settings.sev_override[i] = it->second;
+    }
+    else
+    {
+      sev_overrides_mapcitt it = sev_overrides.find(severity);
+      if(it != sev_overrides.end())
+        settings.sev_override[i] = it->second;
+    }
+  }
+
+  settings.version = m_settings_version;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_settings_changed
+//
+//! Implementation-defined member function
+//!
+//! Invalidates all resolved id settings; called by every set_* method.
+//----------------------------------------------------------------------------
+
+void uvm_report_handler::m_settings_changed()
+{
+  // version 0 is reserved for unresolved entries
+  if(++m_settings_version == 0)
+    m_settings_version = 1;
+}
+
 
 //----------------------------------------------------------------------------
 // member function: set_verbosity_level
@@ -631,6 +820,7 @@ UVM_FILE uvm_report_handler::get_severity_id_file( uvm_severity severity,
 void uvm_report_handler::set_verbosity_level(int verbosity_level)
 {
   m_max_verbosity_level = verbosity_level;
+  m_settings_changed();
 }
 
 
@@ -644,6 +834,7 @@ void uvm_report_handler::set_severity_action( uvm_severity severity,
                           uvm_action action )
 {
   severity_actions[severity] = action;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -656,6 +847,7 @@ void uvm_report_handler::set_id_action( const std::string& id,
                                         uvm_action action )
 {
   id_actions[id] = action;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -673,6 +865,7 @@ void uvm_report_handler::set_severity_id_action( uvm_severity severity,
 
   // TODO check - no need to new item?
   severity_id_actions[severity][id] = action;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -685,6 +878,7 @@ void uvm_report_handler::set_id_verbosity( const std::string& id,
                                            int verbosity )
 {
   id_verbosities[id] = verbosity;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -702,6 +896,7 @@ void uvm_report_handler::set_severity_id_verbosity( uvm_severity severity,
 
   // TODO check - no need to new item?
   severity_id_verbosities[severity][id] = verbosity;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -713,6 +908,7 @@ void uvm_report_handler::set_severity_id_verbosity( uvm_severity severity,
 void uvm_report_handler::set_default_file( UVM_FILE file )
 {
   default_file_handle = file;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -725,6 +921,7 @@ void uvm_report_handler::set_severity_file( uvm_severity severity,
                                             UVM_FILE file )
 {
   severity_file_handles[severity] = file;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -737,6 +934,7 @@ void uvm_report_handler::set_id_file( const std::string& id,
                                       UVM_FILE file )
 {
   id_file_handles[id] = file;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -754,6 +952,7 @@ void uvm_report_handler::set_severity_id_file( uvm_severity severity,
 
   // TODO check - no need to new item?
   severity_id_file_handles[severity][id] = file;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -766,6 +965,7 @@ void uvm_report_handler::set_severity_override( uvm_severity cur_severity,
                                                 uvm_severity new_severity)
 {
   sev_overrides[cur_severity] = new_severity;
+  m_settings_changed();
 }
 
 //----------------------------------------------------------------------------
@@ -781,6 +981,7 @@ void uvm_report_handler::set_severity_id_override( uvm_severity cur_severity,
   // has precedence over set_severity_override
   // silently override previous setting
   sev_id_overrides[id][cur_severity] = new_severity;
+  m_settings_changed();
 }
 
 
@@ -26,6 +26,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 /*
 #include "uvmsc/base/uvm_object_globals.h"
@@ -80,6 +81,8 @@ class uvm_report_handler : public uvm_object
 
   void do_print( const uvm_printer& printer ) const;
 
+  virtual void set_name( const std::string& name );
+
   //--------------------------------------------------------------------
   // Group: Message processing
   //--------------------------------------------------------------------
@@ -117,12 +120,41 @@ class uvm_report_handler : public uvm_object
 
   virtual ~uvm_report_handler();
 
+  const std::string& m_get_full_name() const;
+
  private:
 
+  // at most this many ids get a slot in the settings table
+  static const unsigned int m_max_id_settings = 4096;
+
+  // resolved settings for one id, one slot per severity
+  struct m_id_settings
+  {
+    bool used;
+    std::size_t hash;
+    std::string id;
+    unsigned int version;
+    int verbosity[UVM_FATAL+1];
+    uvm_action action[UVM_FATAL+1];
+    UVM_FILE file[UVM_FATAL+1];
+    uvm_severity sev_override[UVM_FATAL+1];
+  };
+
+  const m_id_settings& m_get_id_settings( const std::string& id );
+
+  static std::size_t m_hash_id( const std::string& id );
+
+  std::size_t m_find_id_slot( const std::string& id, std::size_t hash ) const;
+
+  void m_resolve_id_settings( const std::string& id,
+                              m_id_settings& settings ) const;
+
+  void m_settings_changed();
+
   void initialize();
 
   UVM_FILE get_severity_id_file( uvm_severity severity,
-                                 const std::string& id );
+                                 const std::string& id ) const;
 
   void set_verbosity_level( int verbosity_level );
 
@@ -207,6 +239,20 @@ class uvm_report_handler : public uvm_object
   typedef severity_id_file_handles_mapt::const_iterator severity_id_file_handles_mapcitt;
   severity_id_file_handles_mapt severity_id_file_handles;
 
+  // open addressing hash table of the settings per id, resolved lazily
+  // per entry whenever m_settings_version no longer matches. It never
+  // holds more than m_max_id_settings ids; later ids are resolved into
+  // m_id_settings_uncached on every use.
+  typedef std::vector<m_id_settings> id_settings_tableT;
+  id_settings_tableT m_id_settings_table;
+  unsigned int m_id_settings_count;
+  m_id_settings m_id_settings_uncached;
+  unsigned int m_settings_version;
+
+  // full name as used in composed messages, cached on first use
+  mutable std::string m_full_name_cache;
+  mutable bool m_full_name_valid;
+
 }; // class uvm_report_handler
 
 } // namespace uvm
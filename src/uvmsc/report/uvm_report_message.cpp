@@ -22,6 +22,15 @@
 
 #include <systemc>
 #include <string>
+#include <vector>
+
+#if !defined(_MSC_VER)
+#include "config.h"
+#endif
+
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
 
 #include "uvmsc/report/uvm_report_message.h"
 #include "uvmsc/base/uvm_object_globals.h"
@@ -376,6 +385,7 @@ unsigned int uvm_report_message_element_container::size() const
 
 void uvm_report_message_element_container::do_delete(int index)
 {
+  m_recycle(m_elements[index]);
   m_elements.erase(m_elements.begin()+index);
 }
 
@@ -387,6 +397,8 @@ void uvm_report_message_element_container::do_delete(int index)
 
 void uvm_report_message_element_container::delete_elements()
 {
+  for (unsigned int i = 0; i < m_elements.size(); i++)
+    m_recycle(m_elements[i]);
   m_elements.clear();
 }
 
@@ -429,7 +441,13 @@ void uvm_report_message_element_container::add_int(
   //if (p != null)
     //rand_state = p.get_randstate();
 
-  urme = new uvm_report_message_int_element();
+  if (m_free_int_elements.empty())
+    urme = new uvm_report_message_int_element();
+  else
+  {
+    urme = m_free_int_elements.back();
+    m_free_int_elements.pop_back();
+  }
 
   //if (p != null)
     //p.set_randstate(rand_state);
@@ -462,7 +480,13 @@ void uvm_report_message_element_container::add_string(
   //if (p != null)
     //rand_state = p.get_randstate();
 
-  urme = new uvm_report_message_string_element();
+  if (m_free_string_elements.empty())
+    urme = new uvm_report_message_string_element();
+  else
+  {
+    urme = m_free_string_elements.back();
+    m_free_string_elements.pop_back();
+  }
 
   //if (p != null)
   //  p.set_randstate(rand_state);
@@ -494,7 +518,13 @@ void uvm_report_message_element_container::add_object(
   //if (p != null)
   //  rand_state = p.get_randstate();
 
-  urme = new uvm_report_message_object_element();
+  if (m_free_object_elements.empty())
+    urme = new uvm_report_message_object_element();
+  else
+  {
+    urme = m_free_object_elements.back();
+    m_free_object_elements.pop_back();
+  }
 
   //if (p != null)
   //  p.set_randstate(rand_state);
@@ -553,6 +583,30 @@ void uvm_report_message_element_container::do_copy( const uvm_object& rhs )
     m_elements.push_back(urme_container->m_elements[i]->clone()); // TODO check
 }
 
+//----------------------------------------------------------------------
+// Member function: m_recycle
+//
+// Implementation defined
+// Keeps a deleted element for reuse by the add_* member functions.
+// Elements cannot be destroyed, as their destructors are private.
+//----------------------------------------------------------------------
+
+void uvm_report_message_element_container::m_recycle( uvm_report_message_element_base* element )
+{
+  if (uvm_report_message_int_element* e =
+        dynamic_cast<uvm_report_message_int_element*>(element))
+    m_free_int_elements.push_back(e);
+  else if (uvm_report_message_string_element* e =
+             dynamic_cast<uvm_report_message_string_element*>(element))
+    m_free_string_elements.push_back(e);
+  else if (uvm_report_message_object_element* e =
+             dynamic_cast<uvm_report_message_object_element*>(element))
+  {
+    e->set_value(NULL);
+    m_free_object_elements.push_back(e);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Class: uvm_report_message
 //------------------------------------------------------------------------------
@@ -567,13 +621,101 @@ uvm_report_message::uvm_report_message( const std::string& name )
 : uvm_object(name)
 {
   m_report_message_element_container = new uvm_report_message_element_container();
+  m_reset();
+}
+
+//------------------------------------------------------------------------------
+// Destructor
+//------------------------------------------------------------------------------
+
+uvm_report_message::~uvm_report_message()
+{
+  delete m_report_message_element_container;
 }
 
+//------------------------------------------------------------------------------
+// Free list of report messages
+//
+// Implementation defined
+// Messages returned by m_free_report_message are kept per thread, so that
+// a report issued while another one is processed (e.g. from a report
+// catcher or a do_print member function) gets its own message object,
+// without allocating one for each report.
+//
+// The messages handed out by new_report_message are owned by the pool as
+// well: they are taken in turn from a fixed ring, and never freed by the
+// caller.
+//------------------------------------------------------------------------------
+
+// upper bound of the number of free messages kept per thread, and size of
+// the ring used by new_report_message
+static const unsigned int UVM_REPORT_MESSAGE_POOL_SIZE = 16;
+
+struct report_message_poolT
+{
+  std::vector<uvm_report_message*> free;
+  std::vector<uvm_report_message*> ring;
+  unsigned int next;
+
+  report_message_poolT() : free(), ring(), next(0) {}
+
+  ~report_message_poolT()
+  {
+    for (unsigned int i = 0; i < free.size(); i++)
+      delete free[i];
+    for (unsigned int i = 0; i < ring.size(); i++)
+      delete ring[i];
+  }
+};
+
+#if defined(HAVE_PTHREAD)
+
+static pthread_key_t report_message_pool_key;
+static pthread_once_t report_message_pool_once = PTHREAD_ONCE_INIT;
+
+static void uvm_report_message_pool_delete( void* pool )
+{
+  delete static_cast<report_message_poolT*>(pool);
+}
+
+static void uvm_report_message_pool_key_create()
+{
+  pthread_key_create(&report_message_pool_key, uvm_report_message_pool_delete);
+}
+
+static report_message_poolT& report_message_pool()
+{
+  pthread_once(&report_message_pool_once, uvm_report_message_pool_key_create);
+
+  void* pool = pthread_getspecific(report_message_pool_key);
+  if (pool == NULL)
+  {
+    pool = new report_message_poolT();
+    pthread_setspecific(report_message_pool_key, pool);
+  }
+  return *static_cast<report_message_poolT*>(pool);
+}
+
+#else
+
+static report_message_poolT& report_message_pool()
+{
+  static report_message_poolT pool;
+  return pool;
+}
+
+#endif
+
 //------------------------------------------------------------------------------
 // Member function: new_report_message (static)
 //
 // Creates a new uvm_report_message object.
 // This function is the same as new(), but keeps the random stability.
+//
+// The message is owned by the library, as before: the caller must not
+// delete it. Each call on a thread returns the next message of a ring of
+// 16 messages, reset to its initial fields, so up to 16 messages obtained
+// this way can be in use at the same time.
 //------------------------------------------------------------------------------
 
 uvm_report_message* uvm_report_message::new_report_message( const std::string& name )
@@ -585,12 +727,100 @@ uvm_report_message* uvm_report_message::new_report_message( const std::string& n
 
   //if (p != null)
   //  rand_state = p.get_randstate();
-  static uvm_report_message* msg = new uvm_report_message(name);
+  report_message_poolT& pool = report_message_pool();
+
+  if (pool.ring.size() < UVM_REPORT_MESSAGE_POOL_SIZE)
+  {
+    pool.ring.push_back(new uvm_report_message(name));
+    return pool.ring.back();
+  }
+
+  uvm_report_message* msg = pool.ring[pool.next];
+  pool.next = (pool.next + 1) % UVM_REPORT_MESSAGE_POOL_SIZE;
+
+  msg->m_reset();
+  if (msg->get_name() != name)
+    msg->set_name(name);
+
   return msg;
   //if (p != null)
   //  p.set_randstate(rand_state);
 }
 
+//------------------------------------------------------------------------------
+// Member function: m_get_report_message (static)
+//
+// Implementation defined
+// Returns a message owned by the caller, which must hand it back with
+// m_free_report_message once it has been processed. A message which was
+// freed before is reused when available.
+//------------------------------------------------------------------------------
+
+uvm_report_message* uvm_report_message::m_get_report_message( const std::string& name )
+{
+  report_message_poolT& pool = report_message_pool();
+
+  if (pool.free.empty())
+    return new uvm_report_message(name);
+
+  uvm_report_message* msg = pool.free.back();
+  pool.free.pop_back();
+
+  if (msg->get_name() != name)
+    msg->set_name(name);
+
+  return msg;
+}
+
+//------------------------------------------------------------------------------
+// Member function: m_free_report_message (static)
+//
+// Implementation defined
+// Returns a message obtained with m_get_report_message, after it has been
+// processed. Its fields are reset and its element container is emptied,
+// keeping the allocated storage for the next report.
+//------------------------------------------------------------------------------
+
+void uvm_report_message::m_free_report_message( uvm_report_message* report_message )
+{
+  if (report_message == NULL)
+    return;
+
+  report_message_poolT& pool = report_message_pool();
+
+  if (pool.free.size() < UVM_REPORT_MESSAGE_POOL_SIZE)
+  {
+    report_message->m_reset();
+    pool.free.push_back(report_message);
+  }
+  else
+    delete report_message;
+}
+
+//------------------------------------------------------------------------------
+// Member function: m_reset
+//
+// Implementation defined
+// Restores the fields of a new message.
+//------------------------------------------------------------------------------
+
+void uvm_report_message::m_reset()
+{
+  m_report_object = NULL;
+  m_report_handler = NULL;
+  m_report_server = NULL;
+  m_severity = UVM_INFO;
+  m_id.clear();
+  m_message.clear();
+  m_verbosity = UVM_MEDIUM;
+  m_filename.clear();
+  m_line = 0;
+  m_context_name.clear();
+  m_action = UVM_NO_ACTION;
+  m_file = 0;
+  m_report_message_element_container->delete_elements();
+}
+
 
 //------------------------------------------------------------------------------
 // Member function: print (virtual)
@@ -217,8 +217,15 @@ class uvm_report_message_element_container : public uvm_object
   virtual void do_copy( const uvm_object& rhs );
 
  private:
+   void m_recycle( uvm_report_message_element_base* element );
+
    std::vector<uvm_report_message_element_base*> m_elements;
 
+   // deleted elements, kept for reuse by the add_* member functions
+   std::vector<uvm_report_message_int_element*> m_free_int_elements;
+   std::vector<uvm_report_message_string_element*> m_free_string_elements;
+   std::vector<uvm_report_message_object_element*> m_free_object_elements;
+
 };
 
 
@@ -238,12 +245,20 @@ class uvm_report_message_element_container : public uvm_object
 
 class uvm_report_message : public uvm_object
 {
+  friend class uvm_default_report_server;
+
 public:
 
   uvm_report_message(const std::string& name = "uvm_report_message");
 
   static uvm_report_message* new_report_message(const std::string& name = "uvm_report_message");
 
+  static uvm_report_message* m_get_report_message(const std::string& name = "uvm_report_message");
+
+  static void m_free_report_message( uvm_report_message* report_message );
+
+  virtual ~uvm_report_message();
+
   virtual void do_print( const uvm_printer& printer ) const;
 
   UVM_OBJECT_UTILS(uvm_report_message);
@@ -352,6 +367,8 @@ public:
                            uvm_action action = (UVM_LOG | UVM_RM_RECORD) );
 
 private:
+  void m_reset();
+
   uvm_report_object* m_report_object;
   uvm_report_handler* m_report_handler;
   uvm_report_server* m_report_server;
@@ -28,6 +28,7 @@
 #include "uvmsc/report/uvm_report_object.h"
 #include "uvmsc/report/uvm_report_handler.h"
 #include "uvmsc/report/uvm_report_message.h"
+#include "uvmsc/report/uvm_report_profiler.h"
 
 namespace uvm {
 
@@ -78,10 +79,12 @@ bool uvm_report_object::uvm_report_enabled( int verbosity,
                                             uvm_severity severity,
                                             const std::string& id ) const
 {
-  if (get_report_verbosity_level(severity, id) < verbosity )
-    return false;
-  else
-    return true;
+  bool enabled = (get_report_verbosity_level(severity, id) >= verbosity);
+
+  if (uvm_report_profiler::m_enabled)
+    uvm_report_profiler::get()->m_check(id, enabled);
+
+  return enabled;
 }
 
 //----------------------------------------------------------------------
@@ -110,11 +113,12 @@ void uvm_report_object::uvm_report( uvm_severity severity,
       return;
   }
 
-  l_report_message = uvm_report_message::new_report_message();
+  l_report_message = uvm_report_message::m_get_report_message();
   l_report_message->set_report_message(severity, id, message,
                                       verbosity, filename, line, context_name);
 
   uvm_process_report_message(l_report_message);
+  uvm_report_message::m_free_report_message(l_report_message);
 }
 
 //----------------------------------------------------------------------
@@ -0,0 +1,299 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/time.h>
+#endif
+
+#include "uvmsc/report/uvm_report_profiler.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Class: uvm_report_profile_entry
+//----------------------------------------------------------------------------
+
+uvm_report_profile_entry::uvm_report_profile_entry()
+: checked(0), filtered(0), reports(0), caught(0), displayed(0),
+  compose_time(0.0), write_time(0.0)
+{}
+
+//----------------------------------------------------------------------------
+// Class: uvm_report_profiler
+//----------------------------------------------------------------------------
+
+bool uvm_report_profiler::m_enabled = false;
+const char* uvm_report_profiler::m_site_file = NULL;
+int uvm_report_profiler::m_site_line = 0;
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+uvm_report_profiler::uvm_report_profiler()
+{}
+
+//----------------------------------------------------------------------------
+// member function: get (static)
+//
+//! Returns the profiler singleton.
+//----------------------------------------------------------------------------
+
+uvm_report_profiler* uvm_report_profiler::get()
+{
+  static uvm_report_profiler* inst = new uvm_report_profiler();
+  return inst;
+}
+
+//----------------------------------------------------------------------------
+// member function: enable
+//----------------------------------------------------------------------------
+
+void uvm_report_profiler::enable( bool on )
+{
+  m_enabled = on;
+}
+
+//----------------------------------------------------------------------------
+// member function: is_enabled
+//----------------------------------------------------------------------------
+
+bool uvm_report_profiler::is_enabled() const
+{
+  return m_enabled;
+}
+
+//----------------------------------------------------------------------------
+// member function: set_csv_file
+//
+//! Sets the file to which the report server writes the counts at the end
+//! of the test. An empty name disables the CSV output.
+//----------------------------------------------------------------------------
+
+void uvm_report_profiler::set_csv_file( const std::string& filename )
+{
+  m_csv_file = filename;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_csv_file
+//----------------------------------------------------------------------------
+
+const std::string& uvm_report_profiler::get_csv_file() const
+{
+  return m_csv_file;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_entry
+//
+//! Returns the counts of the call site \p filename, \p line and \p id.
+//! Verbosity checks which were not done by a reporting macro are found
+//! under an empty file name and line 0.
+//----------------------------------------------------------------------------
+
+uvm_report_profile_entry uvm_report_profiler::get_entry( const std::string& filename,
+                                                         int line,
+                                                         const std::string& id ) const
+{
+  site_mapT::const_iterator it =
+    m_sites.find(site_t(std::make_pair(filename, line), id));
+  return (it == m_sites.end()) ? uvm_report_profile_entry() : it->second;
+}
+
+//----------------------------------------------------------------------------
+// Ranking of the call sites
+//----------------------------------------------------------------------------
+
+typedef std::pair<std::pair<std::string, int>, std::string> uvm_report_site_t;
+typedef std::pair<const uvm_report_site_t*, const uvm_report_profile_entry*> uvm_report_site_ref;
+
+static unsigned long uvm_report_site_weight( const uvm_report_profile_entry& e )
+{
+  return e.checked + e.reports;
+}
+
+static bool uvm_report_site_order( const uvm_report_site_ref& a,
+                                   const uvm_report_site_ref& b )
+{
+  unsigned long wa = uvm_report_site_weight(*a.second);
+  unsigned long wb = uvm_report_site_weight(*b.second);
+  if (wa != wb)
+    return wa > wb;
+  return (a.second->compose_time + a.second->write_time) >
+         (b.second->compose_time + b.second->write_time);
+}
+
+//----------------------------------------------------------------------------
+// member function: print_ranked
+//
+//! Prints at most \p max_rows call sites, ordered by the number of checks
+//! and reports, most frequent first. Times are given in microseconds.
+//----------------------------------------------------------------------------
+
+void uvm_report_profiler::print_ranked( std::ostream& os, unsigned int max_rows ) const
+{
+  std::vector<uvm_report_site_ref> sites;
+  for (site_mapT::const_iterator it = m_sites.begin(); it != m_sites.end(); ++it)
+    sites.push_back(uvm_report_site_ref(&it->first, &it->second));
+
+  std::sort(sites.begin(), sites.end(), uvm_report_site_order);
+
+  os << "** Report profile (" << sites.size() << " call sites)\n"
+     << std::setw(10) << "checked" << std::setw(10) << "filtered"
+     << std::setw(10) << "reports" << std::setw(10) << "caught"
+     << std::setw(10) << "displayed" << std::setw(12) << "compose us"
+     << std::setw(12) << "write us" << "  call site\n";
+
+  for (unsigned int i = 0; i < sites.size() && i < max_rows; i++)
+  {
+    const uvm_report_profile_entry& e = *sites[i].second;
+    const uvm_report_site_t& site = *sites[i].first;
+
+    std::ostringstream location;
+    if (site.first.first.empty())
+      location << "-";
+    else
+      location << site.first.first << "(" << site.first.second << ")";
+
+    os << std::setw(10) << e.checked << std::setw(10) << e.filtered
+       << std::setw(10) << e.reports << std::setw(10) << e.caught
+       << std::setw(10) << e.displayed
+       << std::setw(12) << std::fixed << std::setprecision(1) << e.compose_time * 1e6
+       << std::setw(12) << e.write_time * 1e6
+       << "  " << location.str() << " [" << site.second << "]\n";
+  }
+}
+
+// quotes a CSV field, as it may contain commas or quotes
+static std::string uvm_report_csv_quote( const std::string& field )
+{
+  std::string quoted = "\"";
+  for (std::string::size_type i = 0; i < field.size(); i++)
+  {
+    if (field[i] == '"')
+      quoted += '"';
+    quoted += field[i];
+  }
+  quoted += '"';
+  return quoted;
+}
+
+//----------------------------------------------------------------------------
+// member function: write_csv
+//
+//! Writes the counts of all call sites to the CSV file \p filename, with a
+//! header line. Returns false if the file cannot be written.
+//----------------------------------------------------------------------------
+
+bool uvm_report_profiler::write_csv( const std::string& filename ) const
+{
+  std::ofstream csv(filename.c_str());
+  if (!csv)
+    return false;
+
+  csv << "file,line,id,checked,filtered,reports,caught,displayed,compose_us,write_us\n";
+
+  for (site_mapT::const_iterator it = m_sites.begin(); it != m_sites.end(); ++it)
+  {
+    const uvm_report_profile_entry& e = it->second;
+
+    csv << uvm_report_csv_quote(it->first.first.first) << ","
+        << it->first.first.second << ","
+        << uvm_report_csv_quote(it->first.second) << ","
+        << e.checked << "," << e.filtered << ","
+        << e.reports << "," << e.caught << "," << e.displayed << ","
+        << std::fixed << std::setprecision(3) << e.compose_time * 1e6 << ","
+        << e.write_time * 1e6 << "\n";
+  }
+
+  return csv.good();
+}
+
+//----------------------------------------------------------------------------
+// member function: clear
+//----------------------------------------------------------------------------
+
+void uvm_report_profiler::clear()
+{
+  m_sites.clear();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_entry
+//
+//! Implementation-defined member function
+//! Returns the counts of a call site, creating them on first use.
+//----------------------------------------------------------------------------
+
+uvm_report_profile_entry& uvm_report_profiler::m_entry( const std::string& filename,
+                                                        int line,
+                                                        const std::string& id )
+{
+  return m_sites[site_t(std::make_pair(filename, line), id)];
+}
+
+//----------------------------------------------------------------------------
+// member function: m_check
+//
+//! Implementation-defined member function
+//! Counts a verbosity check of id \p id, which failed if \p enabled is
+//! false, for the call site given to #m_at, if any.
+//----------------------------------------------------------------------------
+
+void uvm_report_profiler::m_check( const std::string& id, bool enabled )
+{
+  const char* filename = m_site_file;
+  int line = m_site_line;
+  m_site_file = NULL;
+  m_site_line = 0;
+
+  uvm_report_profile_entry& e =
+    m_entry((filename != NULL) ? filename : "", line, id);
+  e.checked++;
+  if (!enabled)
+    e.filtered++;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_now (static)
+//
+//! Implementation-defined member function
+//! Returns a wall clock time stamp in seconds, for measuring intervals.
+//----------------------------------------------------------------------------
+
+double uvm_report_profiler::m_now()
+{
+#if !defined(_WIN32)
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+  return double(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+} // namespace uvm
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_REPORT_PROFILER_H_
+#define UVM_REPORT_PROFILER_H_
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_report_profile_entry
+//
+//! Implementation-defined class holding the counts of one call site, i.e.
+//! the combination of file name, line number and id of a report.
+//----------------------------------------------------------------------------
+
+struct uvm_report_profile_entry
+{
+  uvm_report_profile_entry();
+
+  // number of uvm_report_enabled checks, and how many of them failed
+  unsigned long checked;
+  unsigned long filtered;
+
+  // reports which reached the report server, were caught by a report
+  // catcher, and were displayed or logged
+  unsigned long reports;
+  unsigned long caught;
+  unsigned long displayed;
+
+  // time spent composing and writing the messages, in seconds
+  double compose_time;
+  double write_time;
+};
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_report_profiler
+//
+//! Implementation-defined singleton which counts, per call site, how many
+//! reports were checked, filtered, caught and displayed, and how much time
+//! was spent composing and writing them. The reporting macros pass their
+//! file and line to #uvm_report_object::uvm_report_enabled through
+//! #m_at, so their checks are counted with the reports of the same call
+//! site. Checks done by calling uvm_report_enabled directly are counted
+//! per id, under an empty file name and line 0.
+//!
+//! Profiling is off by default; each hook then costs a test of a flag.
+//! It is enabled by #enable, or by the #uvm_default_report_server when the
+//! environment variable UVM_SYSTEMC_REPORT_PROFILE is set. A value other
+//! than "1" names a CSV file to which the counts are written. The report
+//! server prints the call sites ranked by the number of checks and reports
+//! in its summary, and writes the CSV file.
+//----------------------------------------------------------------------------
+
+class uvm_report_profiler
+{
+ public:
+  static uvm_report_profiler* get();
+
+  void enable( bool on = true );
+
+  bool is_enabled() const;
+
+  void set_csv_file( const std::string& filename );
+
+  const std::string& get_csv_file() const;
+
+  uvm_report_profile_entry get_entry( const std::string& filename,
+                                      int line,
+                                      const std::string& id ) const;
+
+  void print_ranked( std::ostream& os, unsigned int max_rows = 20 ) const;
+
+  bool write_csv( const std::string& filename ) const;
+
+  void clear();
+
+  /////////////////////////////////////////////////////
+  // Implementation-defined member functions below,
+  // not part of UVM Class reference / LRM
+  /////////////////////////////////////////////////////
+
+  static bool m_enabled;
+
+  uvm_report_profile_entry& m_entry( const std::string& filename,
+                                     int line,
+                                     const std::string& id );
+
+  void m_check( const std::string& id, bool enabled );
+
+  static bool m_at( const char* filename, int line )
+  {
+    if (m_enabled)
+    {
+      m_site_file = filename;
+      m_site_line = line;
+    }
+    return true;
+  }
+
+  // call site of the next verbosity check, set by m_at
+  static const char* m_site_file;
+  static int m_site_line;
+
+  static double m_now();
+
+ private:
+  uvm_report_profiler();
+
+  // disabled
+  uvm_report_profiler( const uvm_report_profiler& );
+  uvm_report_profiler& operator=( const uvm_report_profiler& );
+
+  typedef std::pair<std::pair<std::string, int>, std::string> site_t;
+  typedef std::map<site_t, uvm_report_profile_entry> site_mapT;
+  site_mapT m_sites;
+
+  std::string m_csv_file;
+
+}; // class uvm_report_profiler
+
+} // namespace uvm
+
+#endif // UVM_REPORT_PROFILER_H_
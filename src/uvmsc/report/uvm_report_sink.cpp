@@ -0,0 +1,481 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+
+#if !defined(_MSC_VER)
+#include "config.h"
+#endif
+
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include "uvmsc/report/uvm_report_sink.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// Class: uvm_report_sink
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+uvm_report_sink::uvm_report_sink()
+{}
+
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+uvm_report_sink::~uvm_report_sink()
+{}
+
+//----------------------------------------------------------------------------
+// member function: write (virtual)
+//
+//! Writes the message \p str as one line to the console if \p file is 0,
+//! or to \p file otherwise.
+//----------------------------------------------------------------------------
+
+void uvm_report_sink::write( UVM_FILE file, const std::string& str )
+{
+  if (file == 0) // NULL pointer
+    std::cout << str << std::endl;
+  else
+    *file << str << std::endl;
+}
+
+//----------------------------------------------------------------------------
+// member function: flush (virtual)
+//
+//! Writes all pending output. The default sink has no pending output.
+//----------------------------------------------------------------------------
+
+void uvm_report_sink::flush()
+{}
+
+
+//----------------------------------------------------------------------------
+// Class: uvm_buffered_report_sink
+//----------------------------------------------------------------------------
+
+struct uvm_buffered_report_sink::m_thread_state
+{
+#if defined(HAVE_PTHREAD)
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t work;    // a buffer was queued, or the writer must stop
+  pthread_cond_t drained; // the writer finished writing a batch
+  int fd;                 // duplicate of the standard output, owned
+#endif
+  bool running;
+};
+
+namespace {
+
+class m_sink_lock
+{
+ public:
+#if defined(HAVE_PTHREAD)
+  explicit m_sink_lock( pthread_mutex_t& mutex ) : m_mutex(mutex)
+  {
+    pthread_mutex_lock(&m_mutex);
+  }
+
+  ~m_sink_lock()
+  {
+    pthread_mutex_unlock(&m_mutex);
+  }
+
+ private:
+  pthread_mutex_t& m_mutex;
+#endif
+};
+
+} // anonymous namespace
+
+#if defined(HAVE_PTHREAD)
+#define UVM_SINK_LOCK m_sink_lock l_lock(m_thread->mutex)
+#else
+#define UVM_SINK_LOCK
+#endif
+
+//----------------------------------------------------------------------------
+// Constructor
+//
+//! Creates a sink with buffers of \p buffer_size bytes. Buffers which are
+//! not full are written after \p flush_interval_ms milliseconds; an
+//! interval of 0 disables the timed flush.
+//----------------------------------------------------------------------------
+
+uvm_buffered_report_sink::uvm_buffered_report_sink( std::size_t buffer_size,
+                                                    unsigned int flush_interval_ms )
+: m_buffer_size(buffer_size),
+  m_flush_interval(flush_interval_ms),
+  m_active(NULL),
+  m_full(),
+  m_free(),
+  m_writing(false),
+  m_stop(false),
+  m_thread(new m_thread_state)
+{
+  m_active = m_get_free_buffer();
+  m_thread->running = false;
+
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_init(&m_thread->mutex, NULL);
+  pthread_cond_init(&m_thread->work, NULL);
+  pthread_cond_init(&m_thread->drained, NULL);
+
+  // without a writer thread the sink falls back to synchronous writes
+  m_thread->fd = dup(STDOUT_FILENO);
+  if (m_thread->fd >= 0)
+    m_thread->running =
+      (pthread_create(&m_thread->thread, NULL, &m_writer_main, this) == 0);
+#endif
+
+  static bool at_exit_registered = false;
+  std::vector<uvm_buffered_report_sink*>& sinks = m_live_sinks();
+  if (!at_exit_registered)
+  {
+    std::atexit(&m_flush_all_at_exit);
+    at_exit_registered = true;
+  }
+  sinks.push_back(this);
+}
+
+//----------------------------------------------------------------------------
+// Destructor
+//
+//! Writes all pending output and stops the writer thread.
+//----------------------------------------------------------------------------
+
+uvm_buffered_report_sink::~uvm_buffered_report_sink()
+{
+  flush();
+
+#if defined(HAVE_PTHREAD)
+  if (m_thread->running)
+  {
+    {
+      UVM_SINK_LOCK;
+      m_stop = true;
+      pthread_cond_signal(&m_thread->work);
+    }
+    pthread_join(m_thread->thread, NULL);
+  }
+  if (m_thread->fd >= 0)
+    close(m_thread->fd);
+  pthread_cond_destroy(&m_thread->drained);
+  pthread_cond_destroy(&m_thread->work);
+  pthread_mutex_destroy(&m_thread->mutex);
+#endif
+
+  delete m_thread;
+
+  delete m_active;
+  for (std::size_t i = 0; i < m_free.size(); i++)
+    delete m_free[i];
+
+  std::vector<uvm_buffered_report_sink*>& sinks = m_live_sinks();
+  sinks.erase(std::remove(sinks.begin(), sinks.end(), this), sinks.end());
+}
+
+//----------------------------------------------------------------------------
+// member function: write (virtual)
+//
+//! Appends the console message \p str to the active buffer. When the
+//! buffer is full, it is handed to the writer thread. A message for
+//! \p file is written to that stream directly.
+//----------------------------------------------------------------------------
+
+void uvm_buffered_report_sink::write( UVM_FILE file, const std::string& str )
+{
+  if (file != 0) // NULL pointer
+  {
+    *file << str << '\n';
+    return;
+  }
+
+  UVM_SINK_LOCK;
+
+  m_buffer& buf = *m_active;
+  buf.text.append(str);
+  buf.text.push_back('\n');
+
+  if (buf.text.size() < m_buffer_size)
+    return;
+
+  if (m_thread->running)
+  {
+    m_queue_active_buffer();
+#if defined(HAVE_PTHREAD)
+    pthread_cond_signal(&m_thread->work);
+#endif
+  }
+  else
+  {
+    m_write_buffer(m_active);
+    m_active->text.clear();
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: flush (virtual)
+//
+//! Writes all pending output, and returns when it has been written.
+//----------------------------------------------------------------------------
+
+void uvm_buffered_report_sink::flush()
+{
+  // console output written through std::cout goes first
+  std::cout.flush();
+
+  UVM_SINK_LOCK;
+
+  m_queue_active_buffer();
+
+#if defined(HAVE_PTHREAD)
+  if (m_thread->running)
+  {
+    pthread_cond_signal(&m_thread->work);
+    while (!m_full.empty() || m_writing)
+      pthread_cond_wait(&m_thread->drained, &m_thread->mutex);
+    return;
+  }
+#endif
+
+  while (!m_full.empty())
+  {
+    m_buffer* buf = m_full.front();
+    m_full.pop_front();
+    m_write_buffer(buf);
+    buf->text.clear();
+    m_free.push_back(buf);
+  }
+}
+
+//----------------------------------------------------------------------------
+// member function: get_buffer_size
+//
+//! Returns the size in bytes at which a buffer is handed to the writer
+//----------------------------------------------------------------------------
+
+std::size_t uvm_buffered_report_sink::get_buffer_size() const
+{
+  return m_buffer_size;
+}
+
+//----------------------------------------------------------------------------
+// member function: get_flush_interval
+//
+//! Returns the interval in milliseconds after which pending output is
+//! written, or 0 if the timed flush is disabled
+//----------------------------------------------------------------------------
+
+unsigned int uvm_buffered_report_sink::get_flush_interval() const
+{
+  return m_flush_interval;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_get_free_buffer
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+uvm_buffered_report_sink::m_buffer* uvm_buffered_report_sink::m_get_free_buffer()
+{
+  if (!m_free.empty())
+  {
+    m_buffer* buf = m_free.back();
+    m_free.pop_back();
+    return buf;
+  }
+
+  m_buffer* buf = new m_buffer;
+  buf->text.reserve(m_buffer_size + 256);
+  return buf;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_queue_active_buffer
+//
+//! Implementation-defined member function
+//!
+//! Moves the active buffer to the write queue if it holds any output.
+//! Must be called with the lock held.
+//----------------------------------------------------------------------------
+
+void uvm_buffered_report_sink::m_queue_active_buffer()
+{
+  if (m_active->text.empty())
+    return;
+
+  m_full.push_back(m_active);
+  m_active = m_get_free_buffer();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_write_buffer
+//
+//! Implementation-defined member function
+//!
+//! Writes the console output of \p buf. The writer thread writes to its
+//! own standard output descriptor; the synchronous fallback uses std::cout.
+//----------------------------------------------------------------------------
+
+void uvm_buffered_report_sink::m_write_buffer( m_buffer* buf )
+{
+#if defined(HAVE_PTHREAD)
+  if (m_thread->running)
+  {
+    const char* data = buf->text.data();
+    std::size_t left = buf->text.size();
+
+    while (left > 0)
+    {
+      ssize_t n = ::write(m_thread->fd, data, left);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        break; // output closed; drop the rest as std::cout would
+      data += n;
+      left -= static_cast<std::size_t>(n);
+    }
+    return;
+  }
+#endif
+
+  std::cout.write(buf->text.data(), buf->text.size());
+  std::cout.flush();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_writer_main (static)
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void* uvm_buffered_report_sink::m_writer_main( void* arg )
+{
+  static_cast<uvm_buffered_report_sink*>(arg)->m_writer_loop();
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// member function: m_writer_loop
+//
+//! Implementation-defined member function
+//!
+//! Body of the writer thread. Waits for full buffers, or for the flush
+//! interval to expire, and writes the queued buffers outside the lock.
+//----------------------------------------------------------------------------
+
+void uvm_buffered_report_sink::m_writer_loop()
+{
+#if defined(HAVE_PTHREAD)
+  UVM_SINK_LOCK;
+
+  while (true)
+  {
+    while (m_full.empty() && !m_stop)
+    {
+      if (m_flush_interval == 0)
+      {
+        pthread_cond_wait(&m_thread->work, &m_thread->mutex);
+        continue;
+      }
+
+      struct timeval now;
+      gettimeofday(&now, NULL);
+
+      long usec = now.tv_usec + (long)(m_flush_interval % 1000) * 1000L;
+      struct timespec deadline;
+      deadline.tv_sec = now.tv_sec + m_flush_interval / 1000 + usec / 1000000L;
+      deadline.tv_nsec = (usec % 1000000L) * 1000L;
+
+      if (pthread_cond_timedwait(&m_thread->work, &m_thread->mutex, &deadline) == ETIMEDOUT)
+        m_queue_active_buffer();
+    }
+
+    if (m_full.empty() && m_stop)
+      break;
+
+    std::deque<m_buffer*> batch;
+    batch.swap(m_full);
+    m_writing = true;
+
+    pthread_mutex_unlock(&m_thread->mutex);
+
+    for (std::size_t i = 0; i < batch.size(); i++)
+      m_write_buffer(batch[i]);
+
+    pthread_mutex_lock(&m_thread->mutex);
+
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+      batch[i]->text.clear();
+      m_free.push_back(batch[i]);
+    }
+
+    m_writing = false;
+    pthread_cond_broadcast(&m_thread->drained);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+// member function: m_flush_all_at_exit (static)
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+void uvm_buffered_report_sink::m_flush_all_at_exit()
+{
+  std::vector<uvm_buffered_report_sink*>& sinks = m_live_sinks();
+
+  for (std::size_t i = 0; i < sinks.size(); i++)
+    sinks[i]->flush();
+}
+
+//----------------------------------------------------------------------------
+// member function: m_live_sinks (static)
+//
+//! Implementation-defined member function
+//----------------------------------------------------------------------------
+
+std::vector<uvm_buffered_report_sink*>& uvm_buffered_report_sink::m_live_sinks()
+{
+  // function-local to avoid static initialization order issues
+  static std::vector<uvm_buffered_report_sink*> sinks;
+  return sinks;
+}
+
+#undef UVM_SINK_LOCK
+
+} // namespace uvm
@@ -0,0 +1,136 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_REPORT_SINK_H_
+#define UVM_REPORT_SINK_H_
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+#include "uvmsc/base/uvm_object_globals.h"
+
+namespace uvm {
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_report_sink
+//
+//! Implementation-defined class to which the #uvm_default_report_server
+//! hands its composed messages. The default sink writes every message
+//! directly to the console or to the message file, and flushes the stream
+//! after each line.
+//----------------------------------------------------------------------------
+
+class uvm_report_sink
+{
+ public:
+  uvm_report_sink();
+
+  virtual ~uvm_report_sink();
+
+  virtual void write( UVM_FILE file, const std::string& str );
+
+  virtual void flush();
+
+}; // class uvm_report_sink
+
+//----------------------------------------------------------------------------
+// CLASS: uvm_buffered_report_sink
+//
+//! Implementation-defined report sink which appends console messages to
+//! large in-memory buffers. Full buffers are written by a background
+//! thread, so the simulation does not wait for the console.
+//!
+//! The background thread only writes to output it owns: a duplicate of
+//! the standard output file descriptor, written without going through
+//! std::cout. It never touches a user stream, so there is no race with
+//! the simulation thread. Messages for a UVM_FILE are written to that
+//! stream by the simulation thread before #write returns, without a flush
+//! per line. The sink keeps no reference to the stream afterwards, so the
+//! stream may be closed or deleted at any time.
+//!
+//! Pending console output is written when #flush is called, when a buffer
+//! has not been written for the configured flush interval, and when the
+//! sink is destroyed or the program exits. Other output written to
+//! std::cout in the meantime may appear before it; call #flush first when
+//! the order matters. Without POSIX threads, full buffers are written
+//! synchronously through std::cout.
+//----------------------------------------------------------------------------
+
+class uvm_buffered_report_sink : public uvm_report_sink
+{
+ public:
+  explicit uvm_buffered_report_sink( std::size_t buffer_size = 1 << 20,
+                                     unsigned int flush_interval_ms = 100 );
+
+  virtual ~uvm_buffered_report_sink();
+
+  virtual void write( UVM_FILE file, const std::string& str );
+
+  virtual void flush();
+
+  std::size_t get_buffer_size() const;
+
+  unsigned int get_flush_interval() const;
+
+ private:
+  // disabled
+  uvm_buffered_report_sink( const uvm_buffered_report_sink& );
+  uvm_buffered_report_sink& operator=( const uvm_buffered_report_sink& );
+
+  // console output of one buffer
+  struct m_buffer
+  {
+    std::string text;
+  };
+
+  struct m_thread_state;
+
+  m_buffer* m_get_free_buffer();
+
+  void m_queue_active_buffer();
+
+  void m_write_buffer( m_buffer* buf );
+
+  static void* m_writer_main( void* arg );
+
+  void m_writer_loop();
+
+  static void m_flush_all_at_exit();
+
+  std::size_t m_buffer_size;
+  unsigned int m_flush_interval;
+
+  m_buffer* m_active;
+  std::deque<m_buffer*> m_full;
+  std::vector<m_buffer*> m_free;
+
+  bool m_writing;
+  bool m_stop;
+
+  m_thread_state* m_thread;
+
+  static std::vector<uvm_buffered_report_sink*>& m_live_sinks();
+
+}; // class uvm_buffered_report_sink
+
+} // namespace uvm
+
+#endif // UVM_REPORT_SINK_H_
@@ -23,6 +23,7 @@
 //----------------------------------------------------------------------
 
 #include <sstream>
+#include <algorithm>
 #include <systemc>
 #include "sysc/kernel/sc_dynamic_processes.h"
 
@@ -38,6 +39,22 @@ using namespace sc_core;
 
 namespace uvm {
 
+// free entry of the response index
+static const unsigned long M_RESPONSE_NO_SLOT = ~0UL;
+
+// spreads the transaction ids, which are often consecutive, over the
+// response index
+static unsigned long m_response_hash( int transaction_id )
+{
+  unsigned int x = static_cast<unsigned int>(transaction_id);
+  x ^= x >> 16;
+  x *= 0x7feb352dU;
+  x ^= x >> 15;
+  x *= 0x846ca68bU;
+  x ^= x >> 16;
+  return x;
+}
+
 //----------------------------------------------------------------------
 // constructor
 //----------------------------------------------------------------------
@@ -57,8 +74,13 @@ uvm_sequence_base::uvm_sequence_base( uvm_object_name name_ )
   response_queue_error_report_disabled = false;
 
   response_queue.clear();
+  m_response_head = 0;
+  m_response_tail = 0;
+  m_response_count = 0;
   m_tr_handle = 0;
 
+  m_ancestor_ids_valid = false;
+
   is_rel_default = true;
   wait_rel_default = false;
 }
@@ -173,6 +195,8 @@ void uvm_sequence_base::start(
   // Remove all sqr_seq_ids
   m_sqr_seq_ids.clear();
 
+  m_cache_ancestors();
+
   // Register the sequence with the sequencer if defined
   if (get_sequencer() != NULL)
     get_sequencer()->m_register_sequence(this);
@@ -356,8 +380,10 @@ int uvm_sequence_base::get_priority() const
 //! unblocked sequence to see if it is relevant. If a false is returned, then the
 //! sequence will not be chosen.
 //!
-//! If all requesting sequences are not relevant, then the sequencer will call
-//! #wait_for_relevant on all sequences and re-arbitrate upon its return.
+//! If no requesting sequence is relevant, then the sequencer will call
+//! #wait_for_relevant on each non-relevant sequence, and re-arbitrate as soon
+//! as one of these calls returns or a new request arrives. A pending
+//! #wait_for_relevant call is not repeated on the next arbitration pass.
 //!
 //! Any sequence that implements #is_relevant must also implement
 //! wait_for_relevant so that the sequencer has a way to wait for a
@@ -834,6 +860,15 @@ bool uvm_sequence_base::get_response_queue_error_report_disabled() const
  void uvm_sequence_base::set_response_queue_depth( int value )
  {
    response_queue_depth = value;
+
+   // a bounded response queue gets its ring storage up front
+   if (value > 0)
+   {
+     if (m_response_tail - m_response_head > (unsigned long)value)
+       m_response_compact();
+     if (m_response_tail - m_response_head <= (unsigned long)value)
+       m_response_resize(value);
+   }
  }
 
 //----------------------------------------------------------------------
@@ -855,10 +890,16 @@ bool uvm_sequence_base::get_response_queue_error_report_disabled() const
 
 void uvm_sequence_base::clear_response_queue()
 {
-  if (response_queue.size() != 0)
+  if (m_response_count != 0)
     uvm_report_error(get_full_name(), "Response queue was not empty from previous runs! Response queue is now cleared for upcoming transactions.", UVM_NONE);
 
-  response_queue.clear();
+  // keep the ring storage for the next run
+  std::fill(response_queue.begin(), response_queue.end(),
+            static_cast<const uvm_sequence_item*>(NULL));
+  m_response_index_rebuild();
+  m_response_head = 0;
+  m_response_tail = 0;
+  m_response_count = 0;
 }
 
 
@@ -866,6 +907,22 @@ void uvm_sequence_base::clear_response_queue()
 //////// Implementation-defined member functions start here ////////////
 ////////////////////////////////////////////////////////////////////////
 
+//----------------------------------------------------------------------
+// member function: get_stats
+//
+//! Returns the throughput and latency statistics collected for this
+//! sequence by its sequencer, or NULL if the sequencer does not collect
+//! statistics (see uvm_sequencer_base::enable_stats).
+//----------------------------------------------------------------------
+
+const uvm_sequence_stats* uvm_sequence_base::get_stats() const
+{
+  if (m_sequencer == NULL || !m_sequencer->is_stats_enabled())
+    return NULL;
+
+  return m_sequencer->get_sequence_stats(get_full_name());
+}
+
 //----------------------------------------------------------------------
 // member function: m_start_core
 //
@@ -920,6 +977,28 @@ void uvm_sequence_base::m_start_core( uvm_sequence_base* parent_sequence,
     sc_core::wait(SC_ZERO_TIME);
 }
 
+//----------------------------------------------------------------------
+// member function: m_cache_ancestors
+//
+//! Implementation-defined member function
+//! Stores the instance ids of the parent sequences, root sequence first.
+//! The id of the ancestor at depth d is found at index d, so a sequence is
+//! a child of another if its path holds the other's id at the other's depth.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_cache_ancestors()
+{
+  m_ancestor_ids.clear();
+
+  for (uvm_sequence_base* seq = m_parent_sequence;
+       seq != NULL;
+       seq = seq->get_parent_sequence())
+    m_ancestor_ids.push_back(seq->get_inst_id());
+
+  std::reverse(m_ancestor_ids.begin(), m_ancestor_ids.end());
+  m_ancestor_ids_valid = true;
+}
+
 //----------------------------------------------------------------------
 // member function: put_response
 //
@@ -940,40 +1019,58 @@ void uvm_sequence_base::put_response( const uvm_sequence_item& response )
 void uvm_sequence_base::get_base_response( const uvm_sequence_item*& response_item,
                                            int transaction_id )
 {
-  while (response_queue.size() == 0)
-  {
-   sc_core::wait(response_queue_event);
-  }
-
   // if transaction id has no unique ID, we simply take the first
   // element from the response queue
   if (transaction_id == -1)
   {
-    const uvm_sequence_item* item = response_queue.front(); // read first element
-    response_queue.pop_front(); // and remove first element afterwards
+    while (m_response_count == 0)
+      sc_core::wait(response_queue_event);
 
-    response_item = dynamic_cast<const uvm_sequence_item*>(item);
+    response_item = m_response_pop_front();
     return;
   }
 
-  for(;;)
+  const uvm_sequence_item* item = m_response_take(transaction_id);
+
+  if (item == NULL)
   {
-    for (response_queue_listT::iterator
-        it = response_queue.begin();
-        it != response_queue.end();
-        it++)
+    // register as waiter for this transaction id, so only a matching
+    // response will wake us up
+    m_response_waiter* waiter = NULL;
+    response_waiter_mapT::iterator it = m_response_waiters.find(transaction_id);
+
+    if (it != m_response_waiters.end())
+      waiter = it->second;
+    else
     {
-      if ((*it)->get_transaction_id() == transaction_id)
+      if (m_response_waiter_pool.empty())
+        waiter = new m_response_waiter();
+      else
       {
-          response_item = dynamic_cast<const uvm_sequence_item*>(*it);
-          response_queue.erase(it);
-          // TODO also delete sequence item here?
-          return; // immediate exit loop as size has changed
+        waiter = m_response_waiter_pool.back();
+        m_response_waiter_pool.pop_back();
       }
+      waiter->count = 0;
+      m_response_waiters[transaction_id] = waiter;
     }
-    sc_core::wait(response_queue_event);
+
+    waiter->count++;
+
+    // deregister also when the process is killed while it waits, in
+    // which case the wait unwinds through this guard
+    struct waiter_guard
+    {
+      uvm_sequence_base* seq;
+      int id;
+      ~waiter_guard() { seq->m_response_release_waiter(id); }
+    } guard = { this, transaction_id };
+
+    while ((item = m_response_take(transaction_id)) == NULL)
+      sc_core::wait(waiter->ev);
   }
 
+  response_item = item;
+  // TODO also delete sequence item here?
 }
 
 //----------------------------------------------------------------------
@@ -985,10 +1082,17 @@ void uvm_sequence_base::get_base_response( const uvm_sequence_item*& response_it
 void uvm_sequence_base::put_base_response( const uvm_sequence_item& response )
 {
   if ( (response_queue_depth == -1) ||
-       ((int)response_queue.size() < response_queue_depth)
+       (m_response_count < response_queue_depth)
      )
   {
-    response_queue.push_back(&response);
+    m_response_push(&response);
+
+    // wake up a process waiting for this particular transaction id
+    response_waiter_mapT::iterator it =
+      m_response_waiters.find(response.get_transaction_id());
+    if (it != m_response_waiters.end())
+      it->second->ev.notify();
+
     response_queue_event.notify();
     return;
   }
@@ -1066,12 +1170,294 @@ void uvm_sequence_base::m_kill()
 
 void uvm_sequence_base::m_clear()
 {
-  for( response_queue_listT::iterator
-       it = response_queue.begin();
-       it != response_queue.end();
+  for (unsigned long i = m_response_head; i != m_response_tail; i++)
+    delete response_queue[i % response_queue.size()];
+
+  for( response_waiter_mapT::iterator
+       it = m_response_waiters.begin();
+       it != m_response_waiters.end();
        it++)
-    delete *it;
+    delete it->second;
+
+  for (unsigned int i = 0; i < m_response_waiter_pool.size(); i++)
+    delete m_response_waiter_pool[i];
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_push
+//
+//! Implementation-defined member function
+//! Appends a response to the ring buffer and indexes it by transaction id.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_push( const uvm_sequence_item* response )
+{
+  if (m_response_tail - m_response_head == response_queue.size())
+  {
+    // reclaim the slots of responses taken out of order before growing
+    if ((unsigned long)m_response_count < response_queue.size())
+      m_response_compact();
+    else
+      m_response_resize(response_queue.empty() ? 8 : 2 * response_queue.size());
+  }
+
+  response_queue[m_response_tail % response_queue.size()] = response;
+  m_response_index_insert(response->get_transaction_id(), m_response_tail);
+  m_response_tail++;
+  m_response_count++;
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_pop_front
+//
+//! Implementation-defined member function
+//! Removes and returns the oldest pending response. The response queue
+//! shall not be empty.
+//----------------------------------------------------------------------
+
+const uvm_sequence_item* uvm_sequence_base::m_response_pop_front()
+{
+  unsigned long slot = m_response_head;
+  const uvm_sequence_item* response = response_queue[slot % response_queue.size()];
+
+  m_response_index_erase(m_response_index_find(response->get_transaction_id(), slot));
+
+  response_queue[slot % response_queue.size()] = NULL;
+  m_response_count--;
+
+  // skip the slots of responses already taken out of order
+  while (m_response_head != m_response_tail &&
+         response_queue[m_response_head % response_queue.size()] == NULL)
+    m_response_head++;
+
+  return response;
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_release_waiter
+//
+//! Implementation-defined member function
+//! Deregisters one process waiting for \p transaction_id. The waiter is
+//! returned to the pool when no process waits for the id any more.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_release_waiter( int transaction_id )
+{
+  response_waiter_mapT::iterator it = m_response_waiters.find(transaction_id);
+  if (it == m_response_waiters.end())
+    return;
+
+  m_response_waiter* waiter = it->second;
+  if (--waiter->count == 0)
+  {
+    m_response_waiters.erase(it);
+    m_response_waiter_pool.push_back(waiter);
+  }
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_take
+//
+//! Implementation-defined member function
+//! Removes and returns the oldest pending response with the given
+//! transaction id, or NULL if there is none.
+//----------------------------------------------------------------------
+
+const uvm_sequence_item* uvm_sequence_base::m_response_take( int transaction_id )
+{
+  long pos = m_response_index_find(transaction_id, M_RESPONSE_NO_SLOT);
+
+  if (pos < 0)
+    return NULL;
+
+  unsigned long slot = m_response_index[pos].slot;
+  m_response_index_erase(pos);
+
+  const uvm_sequence_item* response = response_queue[slot % response_queue.size()];
+  response_queue[slot % response_queue.size()] = NULL;
+  m_response_count--;
+
+  while (m_response_head != m_response_tail &&
+         response_queue[m_response_head % response_queue.size()] == NULL)
+    m_response_head++;
+
+  return response;
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_resize
+//
+//! Implementation-defined member function
+//! Reallocates the ring buffer; capacity shall not be smaller than the
+//! number of occupied slots.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_resize( unsigned long capacity )
+{
+  if (capacity == response_queue.size())
+    return;
+
+  response_queue_vectorT ring(capacity, static_cast<const uvm_sequence_item*>(NULL));
+
+  for (unsigned long i = m_response_head; i != m_response_tail; i++)
+    ring[i % capacity] = response_queue[i % response_queue.size()];
+
+  response_queue.swap(ring);
+  m_response_index_rebuild();
 }
+
+//----------------------------------------------------------------------
+// member function: m_response_compact
+//
+//! Implementation-defined member function
+//! Moves the pending responses together, reclaiming the slots of
+//! responses taken out of order, and rebuilds the transaction id index.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_compact()
+{
+  if (response_queue.empty())
+    return;
+
+  unsigned long size = response_queue.size();
+  unsigned long next = m_response_head;
+
+  for (unsigned long i = m_response_head; i != m_response_tail; i++)
+  {
+    const uvm_sequence_item* response = response_queue[i % size];
+    if (response == NULL)
+      continue;
+    response_queue[i % size] = NULL;
+    response_queue[next % size] = response;
+    next++;
+  }
+  m_response_tail = next;
+
+  m_response_index_rebuild();
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_index_insert
+//
+//! Implementation-defined member function
+//! Adds the response in \p slot to the transaction id index. The index
+//! shall have been sized for the ring by #m_response_index_rebuild.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_index_insert( int transaction_id, unsigned long slot )
+{
+  unsigned long mask = m_response_index.size() - 1;
+  unsigned long pos = m_response_hash(transaction_id) & mask;
+
+  while (m_response_index[pos].slot != M_RESPONSE_NO_SLOT)
+    pos = (pos + 1) & mask;
+
+  m_response_index[pos].slot = slot;
+  m_response_index[pos].transaction_id = transaction_id;
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_index_find
+//
+//! Implementation-defined member function
+//! Returns the index position of the response in \p slot, or of the
+//! oldest pending response with \p transaction_id if \p slot is
+//! M_RESPONSE_NO_SLOT; -1 if there is none.
+//----------------------------------------------------------------------
+
+long uvm_sequence_base::m_response_index_find( int transaction_id, unsigned long slot ) const
+{
+  if (m_response_index.empty())
+    return -1;
+
+  unsigned long mask = m_response_index.size() - 1;
+  unsigned long pos = m_response_hash(transaction_id) & mask;
+  long found = -1;
+
+  for (; m_response_index[pos].slot != M_RESPONSE_NO_SLOT; pos = (pos + 1) & mask)
+  {
+    const m_response_index_entry& e = m_response_index[pos];
+    if (e.transaction_id != transaction_id)
+      continue;
+    if (e.slot == slot)
+      return static_cast<long>(pos);
+    if (slot == M_RESPONSE_NO_SLOT &&
+        (found < 0 || e.slot < m_response_index[found].slot))
+      found = static_cast<long>(pos);
+  }
+
+  return found;
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_index_erase
+//
+//! Implementation-defined member function
+//! Frees the index entry at \p pos, moving back the entries which follow
+//! it in the probe sequence so that no tombstones are needed.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_index_erase( unsigned long pos )
+{
+  unsigned long mask = m_response_index.size() - 1;
+  unsigned long next = pos;
+
+  while (true)
+  {
+    m_response_index[pos].slot = M_RESPONSE_NO_SLOT;
+
+    while (true)
+    {
+      next = (next + 1) & mask;
+      if (m_response_index[next].slot == M_RESPONSE_NO_SLOT)
+        return;
+
+      // an entry can move back to pos if pos lies between its home
+      // position and its current position
+      unsigned long home = m_response_hash(m_response_index[next].transaction_id) & mask;
+      if (((next - home) & mask) >= ((next - pos) & mask))
+        break;
+    }
+
+    m_response_index[pos] = m_response_index[next];
+    pos = next;
+  }
+}
+
+//----------------------------------------------------------------------
+// member function: m_response_index_rebuild
+//
+//! Implementation-defined member function
+//! Sizes the index for the ring capacity and indexes the pending
+//! responses.
+//----------------------------------------------------------------------
+
+void uvm_sequence_base::m_response_index_rebuild()
+{
+  unsigned long size = 16;
+  while (size < 2 * response_queue.size())
+    size *= 2;
+
+  m_response_index_entry free_entry;
+  free_entry.slot = M_RESPONSE_NO_SLOT;
+  free_entry.transaction_id = 0;
+
+  if (m_response_index.size() == size)
+    std::fill(m_response_index.begin(), m_response_index.end(), free_entry);
+  else
+    response_index_vectorT(size, free_entry).swap(m_response_index);
+
+  if (response_queue.empty())
+    return;
+
+  for (unsigned long i = m_response_head; i != m_response_tail; i++)
+  {
+    const uvm_sequence_item* response = response_queue[i % response_queue.size()];
+    if (response != NULL)
+      m_response_index_insert(response->get_transaction_id(), i);
+  }
+}
+
 /*
 void uvm_sequence_base::m_copy( const uvm_sequence_base& obj )
 {
@@ -25,9 +25,11 @@
 
 #include <systemc>
 #include <iostream>
-#include <list>
+#include <map>
+#include <vector>
 
 #include "uvmsc/seq/uvm_sequence_item.h"
+#include "uvmsc/seq/uvm_sequence_stats.h"
 #include "uvmsc/base/uvm_object_globals.h"
 #include "uvmsc/factory/uvm_factory.h"
 #include "uvmsc/phasing/uvm_phase.h"
@@ -140,6 +142,8 @@ class uvm_sequence_base: public uvm_sequence_item
   // not part of UVM Class reference / LRM
   /////////////////////////////////////////////////////
 
+  const uvm_sequence_stats* get_stats() const;
+
 protected:
 
   virtual void put_response ( const uvm_sequence_item& response );
@@ -149,11 +153,24 @@ protected:
 private:
   void m_start_core( uvm_sequence_base* parent_sequence, bool call_pre_post );
 
+  void m_cache_ancestors();
+
   int m_get_sqr_sequence_id( int sequencer_id, bool update_sequence_id );
   void m_set_sqr_sequence_id( int sequencer_id, int sequence_id );
 
   void m_clear();
   void m_kill();
+
+  void m_response_push( const uvm_sequence_item* response );
+  const uvm_sequence_item* m_response_pop_front();
+  const uvm_sequence_item* m_response_take( int transaction_id );
+  void m_response_release_waiter( int transaction_id );
+  void m_response_resize( unsigned long capacity );
+  void m_response_compact();
+  void m_response_index_insert( int transaction_id, unsigned long slot );
+  long m_response_index_find( int transaction_id, unsigned long slot ) const;
+  void m_response_index_erase( unsigned long pos );
+  void m_response_index_rebuild();
   //  void m_copy(); // TODO
 
   // TODO do we need our own constructor?
@@ -188,12 +205,47 @@ private:
   int response_queue_depth;
   bool response_queue_error_report_disabled;
 
-  typedef std::list<const uvm_sequence_item*> response_queue_listT;
-
-  response_queue_listT response_queue;
+  // The response queue is a ring buffer holding the responses in arrival
+  // order. Slots are addressed by an absolute (ever increasing) index; a
+  // response taken out of order by transaction id leaves a NULL slot behind.
+  // When response_queue_depth is set, the ring is sized to that depth once
+  // and no further allocation takes place.
+  typedef std::vector<const uvm_sequence_item*> response_queue_vectorT;
+  response_queue_vectorT response_queue;
+
+  unsigned long m_response_head; // absolute index of oldest slot
+  unsigned long m_response_tail; // absolute index of next free slot
+  int m_response_count;          // number of pending responses
+
+  // Open-addressed index from transaction id to the slot of each pending
+  // response, with linear probing. It has a power of two entries, at least
+  // twice the ring capacity, and is rebuilt whenever the ring is resized
+  // or compacted, so that indexing a response does not allocate.
+  struct m_response_index_entry
+  {
+    unsigned long slot; // M_RESPONSE_NO_SLOT if the entry is free
+    int transaction_id;
+  };
+  typedef std::vector<m_response_index_entry> response_index_vectorT;
+  response_index_vectorT m_response_index;
+
+  // processes waiting for a specific transaction id, each with its own event
+  struct m_response_waiter
+  {
+    sc_core::sc_event ev;
+    int count;
+  };
+  typedef std::map<int, m_response_waiter*> response_waiter_mapT;
+  response_waiter_mapT m_response_waiters;
+  std::vector<m_response_waiter*> m_response_waiter_pool;
 
   int m_tr_handle;
 
+  // instance ids of all parent sequences, root sequence first, cached when
+  // the sequence is started; used by the sequencer for lock/grab checks
+  std::vector<int> m_ancestor_ids;
+  bool m_ancestor_ids_valid;
+
   mutable bool is_rel_default;
   mutable bool wait_rel_default;
 };
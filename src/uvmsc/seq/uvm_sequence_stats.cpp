@@ -0,0 +1,198 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#include <sstream>
+
+#include "uvmsc/seq/uvm_sequence_stats.h"
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// Class: uvm_seq_histogram - implementation
+//------------------------------------------------------------------------------
+
+void uvm_seq_histogram::add( sc_dt::uint64 value )
+{
+  unsigned int bucket = 0;
+
+  while (value != 0)
+  {
+    value >>= 1;
+    bucket++;
+  }
+
+  if (bucket >= m_buckets.size())
+    m_buckets.resize(bucket + 1, 0);
+
+  m_buckets[bucket]++;
+}
+
+unsigned int uvm_seq_histogram::num_buckets() const
+{
+  return m_buckets.size();
+}
+
+unsigned long uvm_seq_histogram::get_count( unsigned int bucket ) const
+{
+  if (bucket >= m_buckets.size())
+    return 0;
+  return m_buckets[bucket];
+}
+
+sc_dt::uint64 uvm_seq_histogram::bucket_low( unsigned int bucket )
+{
+  if (bucket == 0)
+    return 0;
+  return sc_dt::uint64(1) << (bucket - 1);
+}
+
+sc_dt::uint64 uvm_seq_histogram::bucket_high( unsigned int bucket )
+{
+  if (bucket == 0)
+    return 0;
+  return (bucket_low(bucket) << 1) - 1;
+}
+
+void uvm_seq_histogram::clear()
+{
+  m_buckets.clear();
+}
+
+//------------------------------------------------------------------------------
+// Class: uvm_seq_time_stat - implementation
+//------------------------------------------------------------------------------
+
+uvm_seq_time_stat::uvm_seq_time_stat()
+{
+  clear();
+}
+
+void uvm_seq_time_stat::add( const sc_core::sc_time& t )
+{
+  if (m_count == 0 || t < m_min)
+    m_min = t;
+  if (m_count == 0 || t > m_max)
+    m_max = t;
+
+  m_count++;
+  m_total += t;
+  m_histogram.add(t.value());
+}
+
+unsigned long uvm_seq_time_stat::get_count() const
+{
+  return m_count;
+}
+
+sc_core::sc_time uvm_seq_time_stat::get_total() const
+{
+  return m_total;
+}
+
+sc_core::sc_time uvm_seq_time_stat::get_min() const
+{
+  return m_min;
+}
+
+sc_core::sc_time uvm_seq_time_stat::get_max() const
+{
+  return m_max;
+}
+
+sc_core::sc_time uvm_seq_time_stat::get_mean() const
+{
+  if (m_count == 0)
+    return sc_core::SC_ZERO_TIME;
+  return m_total / double(m_count);
+}
+
+const uvm_seq_histogram& uvm_seq_time_stat::get_histogram() const
+{
+  return m_histogram;
+}
+
+void uvm_seq_time_stat::clear()
+{
+  m_count = 0;
+  m_total = sc_core::SC_ZERO_TIME;
+  m_min = sc_core::SC_ZERO_TIME;
+  m_max = sc_core::SC_ZERO_TIME;
+  m_histogram.clear();
+}
+
+std::string uvm_seq_time_stat::convert2string() const
+{
+  std::ostringstream str;
+
+  str << "count " << m_count;
+  if (m_count > 0)
+    str << ", mean " << get_mean()
+        << ", min " << m_min
+        << ", max " << m_max
+        << ", total " << m_total;
+
+  return str.str();
+}
+
+//------------------------------------------------------------------------------
+// Class: uvm_sequence_stats - implementation
+//------------------------------------------------------------------------------
+
+uvm_sequence_stats::uvm_sequence_stats()
+{
+  clear();
+}
+
+void uvm_sequence_stats::clear()
+{
+  grants = 0;
+  grant_wait.clear();
+  driver_time.clear();
+  response_latency.clear();
+  queue_depth.clear();
+}
+
+std::string uvm_sequence_stats::convert2string() const
+{
+  std::ostringstream str;
+
+  str << "  grants           : " << grants << std::endl
+      << "  grant wait       : " << grant_wait.convert2string() << std::endl
+      << "  driver time      : " << driver_time.convert2string() << std::endl
+      << "  response latency : " << response_latency.convert2string() << std::endl
+      << "  queue depth      :";
+
+  for (unsigned int i = 0; i < queue_depth.num_buckets(); i++)
+  {
+    if (queue_depth.get_count(i) == 0)
+      continue;
+
+    str << " ";
+    if (uvm_seq_histogram::bucket_low(i) == uvm_seq_histogram::bucket_high(i))
+      str << uvm_seq_histogram::bucket_low(i);
+    else
+      str << uvm_seq_histogram::bucket_low(i) << "-"
+          << uvm_seq_histogram::bucket_high(i);
+    str << ":" << queue_depth.get_count(i);
+  }
+
+  return str.str();
+}
+
+} // namespace uvm
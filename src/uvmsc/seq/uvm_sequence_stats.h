@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------
+//   Copyright 2026 NXP B.V.
+//   All Rights Reserved Worldwide
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//----------------------------------------------------------------------
+
+#ifndef UVM_SEQUENCE_STATS_H_
+#define UVM_SEQUENCE_STATS_H_
+
+#include <systemc>
+#include <string>
+#include <vector>
+
+namespace uvm {
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_seq_histogram
+//
+//! Implementation-defined class counting samples in power-of-two buckets.
+//! Bucket 0 holds the value 0, bucket k (k > 0) the values in the range
+//! [2^(k-1), 2^k - 1].
+//------------------------------------------------------------------------------
+
+class uvm_seq_histogram
+{
+ public:
+  void add( sc_dt::uint64 value );
+
+  unsigned int num_buckets() const;
+  unsigned long get_count( unsigned int bucket ) const;
+
+  static sc_dt::uint64 bucket_low( unsigned int bucket );
+  static sc_dt::uint64 bucket_high( unsigned int bucket );
+
+  void clear();
+
+ private:
+  std::vector<unsigned long> m_buckets;
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_seq_time_stat
+//
+//! Implementation-defined class accumulating count, total, minimum and
+//! maximum of a series of durations, plus a histogram of the durations
+//! expressed in units of the time resolution.
+//------------------------------------------------------------------------------
+
+class uvm_seq_time_stat
+{
+ public:
+  uvm_seq_time_stat();
+
+  void add( const sc_core::sc_time& t );
+
+  unsigned long get_count() const;
+  sc_core::sc_time get_total() const;
+  sc_core::sc_time get_min() const;
+  sc_core::sc_time get_max() const;
+  sc_core::sc_time get_mean() const;
+  const uvm_seq_histogram& get_histogram() const;
+
+  void clear();
+
+  std::string convert2string() const;
+
+ private:
+  unsigned long m_count;
+  sc_core::sc_time m_total;
+  sc_core::sc_time m_min;
+  sc_core::sc_time m_max;
+  uvm_seq_histogram m_histogram;
+};
+
+//------------------------------------------------------------------------------
+// CLASS: uvm_sequence_stats
+//
+//! Implementation-defined class holding the throughput and latency figures
+//! collected by a sequencer when its instrumentation is enabled, either for
+//! the sequencer as a whole or for a single sequence running on it.
+//------------------------------------------------------------------------------
+
+class uvm_sequence_stats
+{
+ public:
+  uvm_sequence_stats();
+
+  //! Number of requests granted
+  unsigned long grants;
+
+  //! Time from the request (start_item) until the grant
+  uvm_seq_time_stat grant_wait;
+
+  //! Time from handing the item to the driver until item_done
+  uvm_seq_time_stat driver_time;
+
+  //! Time from handing the item to the driver until its response arrives
+  uvm_seq_time_stat response_latency;
+
+  //! Size of the arbitration queue, sampled at every request
+  uvm_seq_histogram queue_depth;
+
+  void clear();
+
+  std::string convert2string() const;
+};
+
+} // namespace uvm
+
+#endif /* UVM_SEQUENCE_STATS_H_ */
@@ -208,6 +208,9 @@ void uvm_sequencer<REQ,RSP>::item_done(const RSP& item, bool use_item)
     this->m_wait_for_item_sequence_id = req.get_sequence_id();
     this->m_wait_for_item_sequence_ev.notify();
     this->m_wait_for_item_transaction_id = req.get_transaction_id();
+
+    if (this->m_stats_enabled)
+      this->m_stats_item_done(req.get_sequence_id(), req.get_transaction_id());
   }
 
   if (use_item)
@@ -24,6 +24,7 @@
 //----------------------------------------------------------------------
 
 #include <systemc>
+#include <climits>
 
 #include "uvmsc/base/uvm_component.h"
 #include "uvmsc/base/uvm_component_name.h"
@@ -37,14 +38,6 @@
 
 namespace uvm {
 
-// TODO - replace by proven RNG
-unsigned int urandom_range( unsigned int max, unsigned int min)
-{
-  if (min == max) return min;
-  unsigned int i = (unsigned int)(rand() % (max - min) + min + 1);
-  return i;
-}
-
 //------------------------------------------------------------------------------
 // static data member initialization
 //------------------------------------------------------------------------------
@@ -75,8 +68,9 @@ uvm_sequencer_base::uvm_sequencer_base( uvm_component_name name_ )
 
   m_lock_arb_size = -1;
   m_arb_size = -1;
-
-  srand(25); // TODO make global function to specify seed for RNG
+  m_lock_list_version = 0;
+  m_relevant_count = 0;
+  m_stats_enabled = false;
 }
 
 //----------------------------------------------------------------------
@@ -120,6 +114,14 @@ bool uvm_sequencer_base::is_child( uvm_sequence_base* parent,
   if (parent == NULL)
     uvm_report_fatal("uvm_sequencer", "is_child passed NULL parent", UVM_NONE);
 
+  // use the ancestor paths cached when the sequences were started
+  if (parent->m_ancestor_ids_valid && child->m_ancestor_ids_valid)
+  {
+    unsigned int depth = parent->m_ancestor_ids.size();
+    return (child->m_ancestor_ids.size() > depth) &&
+           (child->m_ancestor_ids[depth] == parent->get_inst_id());
+  }
+
   child_parent = child->get_parent_sequence();
 
   while (child_parent != NULL) {
@@ -216,21 +218,21 @@ void uvm_sequencer_base::start_phase_sequence( uvm_phase& phase )
 
     else
     {
-      std::ostringstream msg;
-      msg << "No default phase sequence for phase '"
-          << phase.get_name() << "' found for " << get_full_name();
-      UVM_INFO("PHASESEQ", msg.str(), UVM_FULL);
+      UVM_INFO_STREAM("PHASESEQ",
+          "No default phase sequence for phase '"
+          << phase.get_name() << "' found for " << get_full_name(),
+          UVM_FULL);
       return;
     }
   }
 
-  std::ostringstream msg;
-  msg << "Starting default sequence '"
+  UVM_INFO_STREAM("PHASESEQ",
+      "Starting default sequence '"
       << seq->get_type_name()
       << "' for phase '"
       << phase.get_name()
-      << "' for sequencer " << get_full_name();
-  uvm_report_info("PHASESEQ", msg.str(), UVM_FULL);
+      << "' for sequencer " << get_full_name(),
+      UVM_FULL);
 
   seq->print_sequence_info = true;
   seq->set_sequencer(this);
@@ -281,6 +283,10 @@ void uvm_sequencer_base::wait_for_grant(uvm_sequence_base* sequence_ptr,
     uvm_report_fatal("uvm_sequencer_base",
        "wait_for_grant passed NULL sequence_ptr", UVM_NONE);
 
+  sc_core::sc_time request_time;
+  if (m_stats_enabled)
+    request_time = sc_core::sc_time_stamp();
+
   my_seq_id = m_register_sequence(sequence_ptr);
 
   // If lock_request is asserted, then issue a lock.  Don't wait for the response, since
@@ -307,10 +313,27 @@ void uvm_sequencer_base::wait_for_grant(uvm_sequence_base* sequence_ptr,
   arb_sequence_q.push_back(req_s);
   m_update_lists();
 
+  if (m_stats_enabled)
+  {
+    m_stats.queue_depth.add(arb_sequence_q.size());
+    m_stats_of(sequence_ptr).queue_depth.add(arb_sequence_q.size());
+  }
+
   // Wait until this entry is granted
   // Continue to point to the element, since location in queue will change
   m_wait_for_arbitration_completed(req_s->request_id);
 
+  if (m_stats_enabled)
+  {
+    sc_core::sc_time wait_time = sc_core::sc_time_stamp() - request_time;
+    uvm_sequence_stats& seq_stats = m_stats_of(sequence_ptr);
+
+    m_stats.grants++;
+    m_stats.grant_wait.add(wait_time);
+    seq_stats.grants++;
+    seq_stats.grant_wait.add(wait_time);
+  }
+
   // The wait_for_grant_semaphore is used only to check that send_request
   // is only called after wait_for_grant.  This is not a complete check, since
   // requests might be done in parallel, but it will catch basic errors
@@ -533,7 +556,7 @@ bool uvm_sequencer_base::has_do_available()
   for (unsigned int i = 0; i < arb_sequence_q.size(); i++)
   {
     if ( (arb_sequence_q[i]->sequence_ptr->is_relevant()) &&
-         (!is_blocked(arb_sequence_q[i]->sequence_ptr) )
+         (!m_is_blocked(arb_sequence_q[i]) )
        )
       return true;
   }
@@ -783,6 +806,7 @@ void uvm_sequencer_base::remove_sequence_from_queues(uvm_sequence_base* sequence
           UVM_ERROR("SEQFINERR", str.str() );
         }
         lock_list.erase(lock_list.begin()+i);
+        m_lock_list_version++;
         m_update_lists();
       }
       else
@@ -791,6 +815,9 @@ void uvm_sequencer_base::remove_sequence_from_queues(uvm_sequence_base* sequence
   }
   while (i < lock_list.size() );
 
+  // Stop waiting for the sequence to become relevant
+  m_kill_relevance_watcher(sequence_ptr);
+
   // Unregister the sequence_id, so that any returning data is dropped
   m_unregister_sequence(sequence_ptr->m_get_sqr_sequence_id(m_sequencer_id, true));
 }
@@ -803,6 +830,9 @@ void uvm_sequencer_base::remove_sequence_from_queues(uvm_sequence_base* sequence
 
 void uvm_sequencer_base::m_unregister_sequence(int sequence_id)
 {
+  m_stats_in_driver.erase_sequence(sequence_id);
+  m_stats_pending_rsp.erase_sequence(sequence_id);
+
 
   if (reg_sequences.find(sequence_id) == reg_sequences.end()) // not exists
     return;
@@ -845,7 +875,7 @@ void uvm_sequencer_base::grant_queued_locks()
             continue;
          }
          */
-         temp = (is_blocked(arb_sequence_q[i]->sequence_ptr) == 0);
+         temp = (m_is_blocked(arb_sequence_q[i]) == 0);
       }
     }
 
@@ -855,6 +885,7 @@ void uvm_sequencer_base::grant_queued_locks()
     while (temp)
     {
       lock_list.push_back(arb_sequence_q[i]->sequence_ptr);
+      m_lock_list_version++;
       m_set_arbitration_completed(arb_sequence_q[i]->request_id);
       arb_sequence_q.erase(arb_sequence_q.begin()+i);
       m_update_lists();
@@ -863,7 +894,7 @@ void uvm_sequencer_base::grant_queued_locks()
       if (i < arb_sequence_q.size())
       {
         if (arb_sequence_q[i]->request == SEQ_TYPE_LOCK)
-          temp = is_blocked(arb_sequence_q[i]->sequence_ptr) == 0;
+          temp = m_is_blocked(arb_sequence_q[i]) == 0;
       }
     }
 
@@ -951,7 +982,7 @@ int uvm_sequencer_base::m_choose_next_request()
 
     if ( i < arb_sequence_q.size() )
       if (arb_sequence_q[i]->request == SEQ_TYPE_REQ)
-        if (!is_blocked(arb_sequence_q[i]->sequence_ptr))
+        if (!m_is_blocked(arb_sequence_q[i]))
           if (arb_sequence_q[i]->sequence_ptr->is_relevant())
           {
             if (m_arbitration == SEQ_ARB_FIFO)
@@ -977,7 +1008,7 @@ int uvm_sequencer_base::m_choose_next_request()
   {
     for (i = 0; i < avail_sequences.size(); i++)
     {
-      if (is_blocked(arb_sequence_q[avail_sequences[i]]->sequence_ptr))
+      if (m_is_blocked(arb_sequence_q[avail_sequences[i]]))
       {
         avail_sequences.erase(avail_sequences.begin()+i);
         i--;
@@ -998,7 +1029,7 @@ int uvm_sequencer_base::m_choose_next_request()
     for (i = 0; i < avail_sequences.size(); i++)
       sum_priority_val += m_get_seq_item_priority(arb_sequence_q[avail_sequences[i]]);
 
-    temp = urandom_range(sum_priority_val-1, 0);
+    temp = get_random_stream().urandom_range(sum_priority_val-1, 0);
 
     sum_priority_val = 0;
 
@@ -1015,7 +1046,7 @@ int uvm_sequencer_base::m_choose_next_request()
   //  Random Distribution
   if (m_arbitration == SEQ_ARB_RANDOM)
   {
-    i = urandom_range(avail_sequences.size()-1, 0);
+    i = get_random_stream().urandom_range(avail_sequences.size()-1, 0);
     return avail_sequences[i];
   }
 
@@ -1043,7 +1074,7 @@ int uvm_sequencer_base::m_choose_next_request()
     if (m_arbitration == SEQ_ARB_STRICT_FIFO)
       return(highest_sequences[0]);
 
-    i = urandom_range(highest_sequences.size()-1, 0); // TODO improve random function (see above)
+    i = get_random_stream().urandom_range(highest_sequences.size()-1, 0);
     return highest_sequences[i];
   }
 
@@ -1086,7 +1117,8 @@ int uvm_sequencer_base::m_choose_next_request()
 void uvm_sequencer_base::m_wait_for_available_sequence()
 {
   unsigned int i;
-  std::list<int> is_relevant_entries;
+  bool has_non_relevant = false;
+  int relevant_count = m_relevant_count;
 
   // This routine will wait for a change in the request list, or for
   // wait_for_relevant to return on any non-relevant, non-blocked sequence
@@ -1096,25 +1128,85 @@ void uvm_sequencer_base::m_wait_for_available_sequence()
   {
     if (arb_sequence_q[i]->request == SEQ_TYPE_REQ)
     {
-      if (!is_blocked(arb_sequence_q[i]->sequence_ptr))
+      if (!m_is_blocked(arb_sequence_q[i]))
       {
         if (!arb_sequence_q[i]->sequence_ptr->is_relevant())
-          is_relevant_entries.push_back(i);
+        {
+          has_non_relevant = true;
+          m_watch_relevance(arb_sequence_q[i]->sequence_ptr);
+        }
       }
     }
   }
 
-  // Typical path - don't need fork if all queued entries are relevant
-  if (is_relevant_entries.size() == 0)
+  // Typical path - don't need to watch relevance if all queued entries
+  // are relevant
+  if (!has_non_relevant)
   {
     m_wait_arb_not_equal();
     return;
   }
 
-  // TODO - selection in case not all queued entries are relevant...
+  // Wait until the request list changes, or until the wait_for_relevant
+  // of one of the watched sequences returns. The watcher processes stay
+  // alive across arbitration passes, so a sequence which remains
+  // non-relevant is not watched twice.
+  do
+  {
+    sc_core::wait (m_lock_arb_size_changed | m_relevant_changed);
+  }
+  while ( (m_arb_size == m_lock_arb_size) &&
+          (m_relevant_count == relevant_count) );
+}
+
+//----------------------------------------------------------------------
+// member function: m_watch_relevance
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_watch_relevance( uvm_sequence_base* sequence_ptr )
+{
+  if (m_relevance_watchers.find(sequence_ptr) != m_relevance_watchers.end())
+    return; // already waiting for this sequence
 
-  std::cout << "FATAL: PROGRAM INCOMPLETE AND SHOULD NOT GET HERE - report to development team !!" << std::endl;
-  exit(-1);
+  m_relevance_watchers[sequence_ptr] =
+    sc_core::sc_spawn(sc_bind(&uvm_sequencer_base::m_relevance_watcher_proc, this, sequence_ptr));
+}
+
+//----------------------------------------------------------------------
+// member function: m_relevance_watcher_proc
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_relevance_watcher_proc( uvm_sequence_base* sequence_ptr )
+{
+  sequence_ptr->wait_for_relevant();
+
+  m_relevance_watchers.erase(sequence_ptr);
+  m_relevant_count++;
+  m_relevant_changed.notify();
+}
+
+//----------------------------------------------------------------------
+// member function: m_kill_relevance_watcher
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_kill_relevance_watcher( uvm_sequence_base* sequence_ptr )
+{
+  relevance_watcher_mapT::iterator it = m_relevance_watchers.find(sequence_ptr);
+
+  if (it == m_relevance_watchers.end())
+    return;
+
+  sc_core::sc_process_handle watcher = it->second;
+  m_relevance_watchers.erase(it);
+
+  if (watcher.valid() && !watcher.terminated())
+    watcher.kill();
 }
 
 //----------------------------------------------------------------------
@@ -1270,6 +1362,7 @@ void uvm_sequencer_base::m_unlock_req( uvm_sequence_base* sequence_ptr )
     if (lock_list[i]->get_inst_id() == sequence_ptr->get_inst_id())
     {
       lock_list.erase(lock_list.begin()+i);
+      m_lock_list_version++;
       m_update_lists();
       return;
     }
@@ -1292,4 +1385,248 @@ void uvm_sequencer_base::m_start_default_seq_proc(uvm_sequence_base* seq)
   seq->start(this, NULL);
 }
 
+//----------------------------------------------------------------------
+// member function: m_is_blocked
+//
+// Implementation defined
+// Returns whether the sequence of a queued request is blocked by a lock
+// or grab. The result is kept in the request and only recomputed after
+// the lock_list has changed.
+//----------------------------------------------------------------------
+
+bool uvm_sequencer_base::m_is_blocked( uvm_sequence_request* seq_q_entry )
+{
+  if (lock_list.size() == 0)
+    return false;
+
+  if (seq_q_entry->lock_list_version != m_lock_list_version)
+  {
+    seq_q_entry->blocked = is_blocked(seq_q_entry->sequence_ptr);
+    seq_q_entry->lock_list_version = m_lock_list_version;
+  }
+
+  return seq_q_entry->blocked;
+}
+
+//----------------------------------------------------------------------
+// member function: enable_stats
+//
+//! Enables or disables the collection of throughput and latency
+//! statistics for this sequencer and the sequences running on it.
+//! When disabled, which is the default, the instrumentation only costs
+//! a test of the enable flag.
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::enable_stats( bool enable )
+{
+  m_stats_enabled = enable;
+}
+
+//----------------------------------------------------------------------
+// member function: is_stats_enabled
+//
+//! Returns true if statistics collection is enabled
+//----------------------------------------------------------------------
+
+bool uvm_sequencer_base::is_stats_enabled() const
+{
+  return m_stats_enabled;
+}
+
+//----------------------------------------------------------------------
+// member function: get_stats
+//
+//! Returns the statistics collected over all sequences on this sequencer
+//----------------------------------------------------------------------
+
+const uvm_sequence_stats& uvm_sequencer_base::get_stats() const
+{
+  return m_stats;
+}
+
+//----------------------------------------------------------------------
+// member function: get_sequence_stats
+//
+//! Returns the statistics collected for the sequence with full name
+//! \p seq_name, or NULL if no statistics were collected for it. Sequences
+//! with the same full name are accumulated in the same record.
+//----------------------------------------------------------------------
+
+const uvm_sequence_stats* uvm_sequencer_base::get_sequence_stats( const std::string& seq_name ) const
+{
+  seq_stats_mapT::const_iterator it = m_seq_stats.find(seq_name);
+
+  if (it == m_seq_stats.end())
+    return NULL;
+
+  return &it->second;
+}
+
+//----------------------------------------------------------------------
+// member function: clear_stats
+//
+//! Discards all statistics collected so far
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::clear_stats()
+{
+  m_stats.clear();
+  m_seq_stats.clear();
+  m_stats_in_driver.clear();
+  m_stats_pending_rsp.clear();
+}
+
+//----------------------------------------------------------------------
+// member function: report_phase
+//
+//! Prints a summary of the collected statistics, when enabled
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::report_phase( uvm_phase& )
+{
+  if (!m_stats_enabled)
+    return;
+
+  std::ostringstream str;
+  str << "Sequencer statistics" << std::endl
+      << m_stats.convert2string();
+
+  for( seq_stats_mapT::const_iterator it = m_seq_stats.begin();
+       it != m_seq_stats.end();
+       it++ )
+    str << std::endl << "Sequence '" << it->first << "'" << std::endl
+        << it->second.convert2string();
+
+  uvm_report_info("SQRSTATS", str.str(), UVM_LOW);
+}
+
+//----------------------------------------------------------------------
+// member function: m_stats_of
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+uvm_sequence_stats& uvm_sequencer_base::m_stats_of( uvm_sequence_base* sequence_ptr )
+{
+  return m_seq_stats[sequence_ptr->get_full_name()];
+}
+
+//----------------------------------------------------------------------
+// member function: m_stats_item_sent
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_stats_item_sent( uvm_sequence_base* sequence_ptr,
+                                            int transaction_id )
+{
+  int sequence_id = sequence_ptr->m_get_sqr_sequence_id(m_sequencer_id, false);
+  m_stats_pending_times::keyT key(sequence_id, transaction_id);
+
+  m_stats_in_driver.add(key, sc_core::sc_time_stamp());
+  m_stats_pending_rsp.add(key, sc_core::sc_time_stamp());
+}
+
+//----------------------------------------------------------------------
+// member function: m_stats_item_done
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_stats_item_done( int sequence_id, int transaction_id )
+{
+  sc_core::sc_time send_time;
+
+  if (!m_stats_in_driver.take(std::make_pair(sequence_id, transaction_id), send_time))
+    return;
+
+  sc_core::sc_time driver_time = sc_core::sc_time_stamp() - send_time;
+
+  m_stats.driver_time.add(driver_time);
+
+  if (reg_sequences.find(sequence_id) != reg_sequences.end())
+    m_stats_of(reg_sequences[sequence_id]).driver_time.add(driver_time);
+}
+
+//----------------------------------------------------------------------
+// member function: m_stats_response
+//
+// Implementation-defined member function
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_stats_response( int sequence_id, int transaction_id )
+{
+  sc_core::sc_time send_time;
+
+  if (!m_stats_pending_rsp.take(std::make_pair(sequence_id, transaction_id), send_time))
+    return;
+
+  sc_core::sc_time latency = sc_core::sc_time_stamp() - send_time;
+
+  m_stats.response_latency.add(latency);
+
+  if (reg_sequences.find(sequence_id) != reg_sequences.end())
+    m_stats_of(reg_sequences[sequence_id]).response_latency.add(latency);
+}
+
+//----------------------------------------------------------------------
+// Implementation-defined class: m_stats_pending_times
+//----------------------------------------------------------------------
+
+void uvm_sequencer_base::m_stats_pending_times::add( const keyT& key,
+                                                     const sc_core::sc_time& t )
+{
+  // drop the oldest entry still pending when full
+  while (times.size() >= max_pending && !order.empty())
+  {
+    time_mapT::iterator it = times.find(order.front().first);
+    if (it != times.end() && it->second.seq == order.front().second)
+      times.erase(it);
+    order.pop_front();
+  }
+
+  entry& e = times[key];
+  e.time = t;
+  e.seq = next_seq++;
+  order.push_back(std::make_pair(key, e.seq));
+
+  // forget the entries already taken once they outnumber the pending ones
+  if (order.size() > 2 * times.size() + 64)
+  {
+    std::deque<std::pair<keyT, unsigned long> > live;
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+      time_mapT::const_iterator it = times.find(order[i].first);
+      if (it != times.end() && it->second.seq == order[i].second)
+        live.push_back(order[i]);
+    }
+    order.swap(live);
+  }
+}
+
+bool uvm_sequencer_base::m_stats_pending_times::take( const keyT& key,
+                                                      sc_core::sc_time& t )
+{
+  time_mapT::iterator it = times.find(key);
+  if (it == times.end())
+    return false;
+
+  t = it->second.time;
+  times.erase(it);
+  return true;
+}
+
+void uvm_sequencer_base::m_stats_pending_times::erase_sequence( int sequence_id )
+{
+  if (!times.empty())
+    times.erase( times.lower_bound(std::make_pair(sequence_id, INT_MIN)),
+                 times.upper_bound(std::make_pair(sequence_id, INT_MAX)) );
+}
+
+void uvm_sequencer_base::m_stats_pending_times::clear()
+{
+  times.clear();
+  order.clear();
+}
+
 } /* namespace uvm */
@@ -24,7 +24,10 @@
 #define UVM_SEQUENCER_BASE_H_
 
 
+#include <deque>
 #include <list>
+#include <map>
+#include <utility>
 #include <vector>
 
 #include "uvmsc/base/uvm_component.h"
@@ -33,6 +36,7 @@
 #include "uvmsc/phasing/uvm_process.h"
 #include "uvmsc/report/uvm_report_object.h"
 #include "uvmsc/seq/uvm_sequence_item.h"
+#include "uvmsc/seq/uvm_sequence_stats.h"
 
 
 namespace uvm {
@@ -115,6 +119,14 @@ public:
 
   virtual const std::string get_type_name() const;
 
+  void enable_stats( bool enable = true );
+  bool is_stats_enabled() const;
+  const uvm_sequence_stats& get_stats() const;
+  const uvm_sequence_stats* get_sequence_stats( const std::string& seq_name ) const;
+  void clear_stats();
+
+  virtual void report_phase( uvm_phase& phase );
+
  private:
 
   int m_register_sequence(uvm_sequence_base* sequence_ptr);
@@ -130,6 +142,9 @@ public:
   void m_set_arbitration_completed(int request_id);
   void m_wait_for_available_sequence();
   void m_wait_arb_not_equal();
+  void m_watch_relevance( uvm_sequence_base* sequence_ptr );
+  void m_relevance_watcher_proc( uvm_sequence_base* sequence_ptr );
+  void m_kill_relevance_watcher( uvm_sequence_base* sequence_ptr );
   uvm_sequence_base* m_find_sequence(int sequence_id);
   void m_kill_sequence( uvm_sequence_base* sequence_ptr );
   virtual void do_print( const uvm_printer& printer ) const;
@@ -139,6 +154,13 @@ public:
 
   void m_start_default_seq_proc(uvm_sequence_base* seq);
 
+  bool m_is_blocked( uvm_sequence_request* seq_q_entry );
+
+  void m_stats_item_sent( uvm_sequence_base* sequence_ptr, int transaction_id );
+  void m_stats_item_done( int sequence_id, int transaction_id );
+  void m_stats_response( int sequence_id, int transaction_id );
+  uvm_sequence_stats& m_stats_of( uvm_sequence_base* sequence_ptr );
+
   // member variables
 
   int m_wait_for_item_sequence_id;
@@ -150,6 +172,50 @@ public:
   int m_lock_arb_size;
   int m_arb_size;
 
+  // processes waiting in wait_for_relevant of non-relevant sequences;
+  // m_relevant_count is incremented each time one of them returns
+  typedef std::map<uvm_sequence_base*, sc_core::sc_process_handle> relevance_watcher_mapT;
+  relevance_watcher_mapT m_relevance_watchers;
+  int m_relevant_count;
+  sc_core::sc_event m_relevant_changed;
+
+  // instrumentation, only updated when m_stats_enabled is set
+  bool m_stats_enabled;
+  uvm_sequence_stats m_stats;
+  typedef std::map<std::string, uvm_sequence_stats> seq_stats_mapT;
+  seq_stats_mapT m_seq_stats;
+
+  // send times of the items still in the driver, or still waiting for a
+  // response, by (sequence id, transaction id). At most max_pending
+  // entries are kept; the oldest one is dropped first, for drivers which
+  // never complete or answer an item.
+  struct m_stats_pending_times
+  {
+    typedef std::pair<int, int> keyT;
+    struct entry
+    {
+      sc_core::sc_time time;
+      unsigned long seq; // arrival number
+    };
+    typedef std::map<keyT, entry> time_mapT;
+
+    static const std::size_t max_pending = 1024;
+
+    time_mapT times;
+    std::deque<std::pair<keyT, unsigned long> > order; // arrival order
+    unsigned long next_seq;
+
+    m_stats_pending_times() : next_seq(0) {}
+
+    void add( const keyT& key, const sc_core::sc_time& t );
+    bool take( const keyT& key, sc_core::sc_time& t );
+    void erase_sequence( int sequence_id );
+    void clear();
+  };
+
+  m_stats_pending_times m_stats_in_driver;
+  m_stats_pending_times m_stats_pending_rsp;
+
  protected:
   int m_sequencer_id;
   std::map<int, bool> arb_completed;
@@ -164,6 +230,10 @@ public:
   typedef std::vector<uvm_sequence_base*> lock_vectorT;
   lock_vectorT lock_list;
 
+  // incremented on every change of the lock_list, invalidating the
+  // blocked state cached in the queued requests
+  int m_lock_list_version;
+
   static int g_sequencer_id;
   static int g_sequence_id;
   static int g_request_id;
@@ -179,6 +249,11 @@ public:
 class uvm_sequence_request
 {
  public:
+  uvm_sequence_request()
+  : grant(false), sequence_id(-1), request_id(-1), item_priority(-1),
+    sequence_ptr(NULL), blocked(false), lock_list_version(-1)
+  {}
+
   bool grant;
   int sequence_id;
   int request_id;
@@ -186,6 +261,10 @@ class uvm_sequence_request
   uvm_process process_id;
   uvm_sequencer_base::seq_req_t request;
   uvm_sequence_base* sequence_ptr;
+
+  // blocked state of the sequence, valid for the given lock_list version
+  bool blocked;
+  int lock_list_version;
 };
 
 /////////////////////////////////////////////
@@ -214,6 +214,9 @@ void uvm_sequencer_param_base<REQ,RSP>::send_request( uvm_sequence_base* sequenc
 
   m_num_reqs_sent++;
 
+  if (this->m_stats_enabled)
+    this->m_stats_item_sent(sequence_ptr, param_t.get_transaction_id());
+
   // Grant any locks as soon as possible
   grant_queued_locks();
 }
@@ -258,6 +261,9 @@ void uvm_sequencer_param_base<REQ,RSP>::put_response_base(const RSP& rsp)
   m_last_rsp_push_front(&rsp);
   m_num_rsps_received++;
 
+  if (this->m_stats_enabled)
+    this->m_stats_response(rsp.get_sequence_id(), rsp.get_transaction_id());
+
   // Check that set_id_info() was called
   if (rsp.get_sequence_id() == -1)
     uvm_report_fatal("SQRPUT", "Driver put a response with invalid sequence_id", UVM_NONE);